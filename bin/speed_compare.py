@@ -0,0 +1,157 @@
+#! /usr/bin/env python3
+# SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+# SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+# SPDX-FileContributor: 2003-26 Bradley M. Bell
+# ----------------------------------------------------------------------------
+# Compare two csv speed result files; see the speed_main documentation.
+# ----------------------------------------------------------------------------
+import sys
+import math
+#
+# usage
+usage = '''usage: bin/speed_compare.py one two [relative]
+one:      csv output from a speed program (the reference results)
+two:      csv output from a speed program (the results being checked)
+relative: minimum relative rate difference that is flagged (default 0.05)
+'''
+#
+# header
+header = 'package,test,option_list,size,sample,rate,' + \
+    'inuse,tape_size,optimize_seconds'
+#
+# t_975
+# 0.975 quantile of the Student t distribution with df = 1, ..., 30
+# degrees of freedom (two sided test at the 5% level).
+t_975 = [
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+]
+# ----------------------------------------------------------------------------
+# result = read_csv(file_name)
+# result[key] is a dict with the following keys:
+# 'rate':      list of the rates for this key,
+# 'inuse':     maximum of the inuse values for this key,
+# 'tape_size': maximum of the tape_size values for this key.
+# where key = (package, test, option_list, size)
+def read_csv(file_name) :
+    try :
+        file_obj = open(file_name, 'r')
+    except OSError :
+        sys.exit( f'speed_compare.py: cannot open {file_name}' )
+    n_field = len( header.split(',') )
+    result  = dict()
+    for line in file_obj :
+        line  = line.strip()
+        field = line.split(',')
+        if line == header or len(field) != n_field :
+            continue
+        try :
+            key       = tuple( field[0 : 3] + [ int( field[3] ) ] )
+            rate      = float( field[5] )
+            inuse     = int( field[6] )
+            tape_size = int( field[7] )
+        except ValueError :
+            continue
+        if key not in result :
+            result[key] = { 'rate' : list(), 'inuse' : 0, 'tape_size' : 0 }
+        result[key]['rate'].append(rate)
+        result[key]['inuse']     = max( result[key]['inuse'], inuse )
+        result[key]['tape_size'] = max( result[key]['tape_size'], tape_size )
+    file_obj.close()
+    return result
+# ----------------------------------------------------------------------------
+# mean, var = mean_var(sample)
+# var is the variance of the mean (None if there are less than two samples)
+def mean_var(sample) :
+    n    = len(sample)
+    mean = sum(sample) / n
+    if n < 2 :
+        return mean, None
+    var = sum( (s - mean) * (s - mean) for s in sample ) / (n - 1)
+    return mean, var / n
+# ----------------------------------------------------------------------------
+# significant = welch_test(sample_one, sample_two)
+# is the difference between the means significant at the 5% level
+def welch_test(sample_one, sample_two) :
+    mean_one, var_one = mean_var(sample_one)
+    mean_two, var_two = mean_var(sample_two)
+    #
+    # not enough samples to estimate the variance
+    if var_one == None or var_two == None :
+        return True
+    #
+    var = var_one + var_two
+    if var == 0.0 :
+        return mean_one != mean_two
+    t = (mean_two - mean_one) / math.sqrt(var)
+    #
+    # Welch-Satterthwaite degrees of freedom
+    n_one = len(sample_one)
+    n_two = len(sample_two)
+    df    = var * var / (
+        var_one * var_one / (n_one - 1) + var_two * var_two / (n_two - 1)
+    )
+    df    = max(1, int(df) )
+    if df <= len(t_975) :
+        t_crit = t_975[df - 1]
+    else :
+        t_crit = 1.960
+    return abs(t) > t_crit
+# ----------------------------------------------------------------------------
+def main() :
+    if len(sys.argv) < 3 or 4 < len(sys.argv) :
+        sys.exit(usage)
+    relative = 0.05
+    if len(sys.argv) == 4 :
+        relative = float( sys.argv[3] )
+    #
+    # result_one, result_two
+    result_one = read_csv( sys.argv[1] )
+    result_two = read_csv( sys.argv[2] )
+    #
+    # key_list
+    key_list = sorted( set( result_one.keys() ) | set( result_two.keys() ) )
+    if len(key_list) == 0 :
+        sys.exit( 'speed_compare.py: no csv speed results found' )
+    #
+    print( 'test,option_list,size,rate_one,rate_two,change,flag' )
+    n_regression = 0
+    for key in key_list :
+        package, test, option_list, size = key
+        name = f'{test},{option_list},{size}'
+        if key not in result_one :
+            print( f'{name},,,,only in two' )
+            continue
+        if key not in result_two :
+            print( f'{name},,,,only in one' )
+            continue
+        one = result_one[key]
+        two = result_two[key]
+        #
+        # change
+        mean_one, var_one = mean_var( one['rate'] )
+        mean_two, var_two = mean_var( two['rate'] )
+        change = (mean_two - mean_one) / mean_one
+        #
+        # flag
+        flag = ''
+        if abs(change) > relative :
+            if welch_test( one['rate'], two['rate'] ) :
+                if change < 0.0 :
+                    flag = 'regression'
+                    n_regression += 1
+                else :
+                    flag = 'improvement'
+        for field in [ 'inuse', 'tape_size' ] :
+            if one[field] != two[field] :
+                flag += f' {field}: {one[field]} -> {two[field]}'
+        flag = flag.strip()
+        #
+        print( f'{name},{mean_one:.6g},{mean_two:.6g},{change:+.3f},{flag}' )
+    #
+    if 0 < n_regression :
+        sys.exit( f'speed_compare.py: {n_regression} regressions' )
+    print( 'speed_compare.py: OK' )
+#
+main()
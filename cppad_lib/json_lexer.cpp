@@ -1,18 +1,37 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
-# include <cctype>
+# include <algorithm>
+# include <cstdlib>
+# include <cppad/configure.hpp>
 # include <cppad/local/graph/json_lexer.hpp>
 # include <cppad/local/graph/cpp_graph_op.hpp>
 # include <cppad/utility/error_handler.hpp>
 # include <cppad/utility/to_string.hpp>
 # include <cppad/utility/thread_alloc.hpp>
+# if CPPAD_USE_CPLUSPLUS_2017
+# include <charconv>
+# endif
 
 
 // BEGIN_CPPAD_LOCAL_GRAPH_NAMESPACE
 namespace CppAD { namespace local { namespace graph {
 
+// character classes that do not depend on the locale
+namespace {
+    bool is_space(char ch)
+    {   return ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r'
+            || ch == '\f' || ch == '\v';
+    }
+    bool is_digit(char ch)
+    {   return '0' <= ch && ch <= '9'; }
+    bool is_float(char ch)
+    {   return is_digit(ch) || ch == '.' || ch == '+' || ch == '-'
+            || ch == 'e' || ch == 'E';
+    }
+}
+
 // report_error
 void json_lexer::report_error(
     const std::string& expected ,
@@ -23,7 +42,8 @@ void json_lexer::report_error(
     {   --pos;
         count_newline += json_[pos] == '\n';
     }
-    std::string recent_input = json_.substr( pos, index_ - pos + 1);
+    size_t end = std::min(index_ + 1, size_);
+    std::string recent_input( json_ + pos, end - pos );
 
     std::string msg = "Error occurred while parsing Json AD graph";
     if( function_name_ != "" )
@@ -48,7 +68,7 @@ void json_lexer::report_error(
 
 // next_index
 void json_lexer::next_index(void)
-{   CPPAD_ASSERT_UNKNOWN( index_ < json_.size() );
+{   CPPAD_ASSERT_UNKNOWN( index_ < size_ );
     if( json_[index_] == '\n' )
     {   ++line_number_;
         char_number_ = 0;
@@ -57,29 +77,118 @@ void json_lexer::next_index(void)
     ++char_number_;
 }
 
+// read_chunk
+bool json_lexer::read_chunk(size_t k)
+{   if( is_ == nullptr )
+        return false;
+    //
+    // number of characters kept before the current one (for report_error)
+    size_t n_keep = std::min(index_, size_t(256));
+    buffer_.erase(0, index_ - n_keep);
+    index_ = n_keep;
+    //
+    // read chunks until there are enough characters or end of stream
+    const size_t chunk_size = 65536;
+    while( buffer_.size() <= index_ + k && is_->good() )
+    {   size_t old_size = buffer_.size();
+        buffer_.resize(old_size + chunk_size);
+        is_->read(&buffer_[old_size], std::streamsize(chunk_size) );
+        buffer_.resize( old_size + size_t( is_->gcount() ) );
+    }
+    json_ = buffer_.data();
+    size_ = buffer_.size();
+    return index_ + k < size_;
+}
+
+// available
+bool json_lexer::available(size_t k)
+{   if( index_ + k < size_ )
+        return true;
+    return read_chunk(k);
+}
+
 // skip_white_space
 void json_lexer::skip_white_space(void)
-{   while( index_ < json_.size() && isspace( json_[index_] ) )
-        next_index();
+{   bool more = available(0);
+    while( more )
+    {   // white space in the current chunk
+        while( index_ < size_ && is_space( json_[index_] ) )
+            next_index();
+        more = index_ == size_ && available(0);
+    }
 }
 
-// constructor
+// scan_token
+void json_lexer::scan_token( bool (*in_token)(char) )
+{   CPPAD_ASSERT_UNKNOWN( index_ < size_ && in_token( json_[index_] ) );
+    token_.resize(0);
+    bool more = true;
+    while( more )
+    {   // end of the token characters that are in json_
+        size_t end = index_ + 1;
+        while( end < size_ && in_token( json_[end] ) )
+            ++end;
+        //
+        // a token does not contain a new line character
+        token_.append( json_ + index_, end - index_ );
+        char_number_ += end - 1 - index_;
+        index_        = end - 1;
+        //
+        // check if the token continues in the next chunk
+        more = end == size_ && available(1) && in_token( json_[index_ + 1] );
+        if( more )
+            next_index();
+    }
+}
+
+// constructors
 json_lexer::json_lexer(const std::string& json)
 :
-json_(json),
+is_(nullptr),
+buffer_(""),
+json_( json.data() ),
+size_( json.size() ),
+index_(0),
+line_number_(1),
+char_number_(1),
+token_(""),
+function_name_("")
+{   initialize(); }
+json_lexer::json_lexer(const char* data, size_t size)
+:
+is_(nullptr),
+buffer_(""),
+json_(data),
+size_(size),
+index_(0),
+line_number_(1),
+char_number_(1),
+token_(""),
+function_name_("")
+{   initialize(); }
+json_lexer::json_lexer(std::istream& is)
+:
+is_(&is),
+buffer_(""),
+json_( buffer_.data() ),
+size_(0),
 index_(0),
 line_number_(1),
 char_number_(1),
 token_(""),
 function_name_("")
+{   initialize(); }
+
+// initialize
+void json_lexer::initialize(void)
 {
     skip_white_space();
-    if( index_ < json_.size() )
+    if( available(0) )
         token_ = json_[index_];
     if( token_ != "{" )
     {   std::string expected = "'{'";
         std::string found    = "'";
-        if( index_ < json_.size() )
+        if( available(0) )
             found += json_[index_];
         found += "'";
         report_error(expected, found);
@@ -106,21 +215,41 @@ void json_lexer::set_function_name(const std::string& function_name)
 
 // token2size_t
 size_t json_lexer::token2size_t(void) const
-{   return size_t( std::atoi( token_.c_str() ) ); }
+{   size_t value = 0;
+# ifdef __cpp_lib_to_chars
+    const char* first = token_.data();
+    std::from_chars(first, first + token_.size(), value);
+# else
+    value = size_t( std::strtoul( token_.c_str(), nullptr, 10 ) );
+# endif
+    return value;
+}
 
 // token2double
 double json_lexer::token2double(void) const
-{   return std::atof( token_.c_str() ); }
+{   double value = 0.0;
+# ifdef __cpp_lib_to_chars
+    // from_chars does not accept a leading plus sign
+    const char* first = token_.data();
+    const char* last  = first + token_.size();
+    if( first < last && *first == '+' )
+        ++first;
+    std::from_chars(first, last, value);
+# else
+    value = std::strtod( token_.c_str(), nullptr );
+# endif
+    return value;
+}
 
 // check_next_char
 void json_lexer::check_next_char(char ch)
 {   // advance to next character
-    if( index_ < json_.size() )
+    if( available(0) )
         next_index();
     skip_white_space();
     //
     bool ok = false;
-    if( index_ < json_.size() )
+    if( available(0) )
     {   token_.resize(1);
         token_[0] = json_[index_];
         ok = (token_[0] == ch) || (ch == '\0');
@@ -134,7 +263,7 @@ void json_lexer::check_next_char(char ch)
         }
         //
         std::string found = "'";
-        if( index_ < json_.size() )
+        if( available(0) )
             found += json_[index_];;
         found += "'";
         report_error(expected, found);
@@ -144,11 +273,11 @@ void json_lexer::check_next_char(char ch)
 // check_next_string
 void json_lexer::check_next_string(const std::string& expected)
 {   // advance to next character
-    bool found_first_quote = index_ < json_.size();
+    bool found_first_quote = available(0);
     if( found_first_quote )
     {   next_index();
         skip_white_space();
-        found_first_quote = index_ < json_.size();
+        found_first_quote = available(0);
     }
     // check for "
     if( found_first_quote )
@@ -158,14 +287,14 @@ void json_lexer::check_next_string(const std::string& expected)
     token_.resize(0);
     if( found_first_quote )
     {   next_index();
-        while( index_ < json_.size() && json_[index_] != '"' )
+        while( available(0) && json_[index_] != '"' )
         {   token_.push_back( json_[index_] );
             next_index();
         }
     }
     // check for "
     bool found_second_quote = false;
-    if( found_first_quote && index_ < json_.size() )
+    if( found_first_quote && available(0) )
         found_second_quote = json_[index_] == '"';
     //
     bool ok = found_first_quote & found_second_quote;
@@ -184,7 +313,7 @@ void json_lexer::check_next_string(const std::string& expected)
         std::string found;
         if( ! found_first_quote )
         {   found = "'";
-            if( index_ < json_.size() )
+            if( available(0) )
                 found += json_[index_];
             found += "'";
         }
@@ -201,71 +330,47 @@ void json_lexer::check_next_string(const std::string& expected)
 // next_non_neg_int
 void json_lexer::next_non_neg_int(void)
 {   // advance to next character
-    bool ok = index_ < json_.size();
+    bool ok = available(0);
     if( ok )
     {   next_index();
         skip_white_space();
-        ok = index_ < json_.size();
+        ok = available(0);
     }
     if( ok )
-        ok = std::isdigit( json_[index_] );
+        ok = is_digit( json_[index_] );
     if( ! ok )
     {   std::string expected_token = "non-negative integer";
         std::string found = "'";
-        if( index_ < json_.size() )
+        if( available(0) )
             found += json_[index_];
         found += "'";
         report_error(expected_token, found);
     }
     //
-    token_.resize(0);
-    while( ok )
-    {   token_.push_back( json_[index_] );
-        ok = index_ + 1 < json_.size();
-        if( ok )
-            ok = isdigit( json_[index_ + 1] );
-        if( ok )
-            next_index();
-    }
+    scan_token(is_digit);
 }
 
 // next_float
 void json_lexer::next_float(void)
 {   // advance to next character
-    bool ok = index_ < json_.size();
+    bool ok = available(0);
     if( ok )
     {   next_index();
         skip_white_space();
-        ok = index_ < json_.size();
+        ok = available(0);
     }
     if( ok )
-    {   char ch = json_[index_];
-        ok = std::isdigit(ch);
-        ok |= (ch == '.') || (ch == '+') || (ch == '-');
-        ok |= (ch == 'e') || (ch == 'E');
-    }
+        ok = is_float( json_[index_] );
     if( ! ok )
     {   std::string expected_token = "floating point number";
         std::string found = "'";
-        if( index_ < json_.size() )
+        if( available(0) )
             found += json_[index_];
         found += "'";
         report_error(expected_token, found);
     }
     //
-    token_.resize(0);
-    while( ok )
-    {   token_.push_back( json_[index_] );
-        ok = index_ + 1 < json_.size();
-        if( ok )
-        {   char ch  = json_[index_ + 1];
-            ok  = isdigit(ch);
-            ok |= (ch == '.') || (ch == '+') || (ch == '-');
-            ok |= (ch == 'e') || (ch == 'E');
-        }
-        if( ok )
-            next_index();
-    }
+    scan_token(is_float);
     return;
 }
 
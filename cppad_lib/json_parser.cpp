@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 
@@ -13,9 +13,14 @@
 // documentation for this routine is in the file below
 # include <cppad/local/graph/json_parser.hpp>
 
-void CppAD::local::graph::json_parser(
-    const std::string& json      ,
-    cpp_graph&         graph_obj )
+// BEGIN_CPPAD_LOCAL_GRAPH_NAMESPACE
+namespace CppAD { namespace local { namespace graph {
+
+// json_parser_lexer
+// parse the Json AD graph that json_lexer is reading
+static void json_parser_lexer(
+    json_lexer& json_lexer ,
+    cpp_graph&  graph_obj  )
 {   using std::string;
     //
     //
@@ -30,8 +35,7 @@ void CppAD::local::graph::json_parser(
     CppAD::vector<graph_op_enum> op_code2enum(1);
     //
     // -----------------------------------------------------------------------
-    // json_lexer constructor checks for { at beginning
-    CppAD::local::graph::json_lexer json_lexer(json);
+    // json_lexer constructor checked for { at beginning
     //
     // "function_name" : function_name
     json_lexer.check_next_string("function_name");
@@ -328,3 +332,27 @@ void CppAD::local::graph::json_parser(
     //
     return;
 }
+
+// json_parser
+// The json_lexer constructors check for { at beginning
+void json_parser(
+    const std::string& json      ,
+    cpp_graph&         graph_obj )
+{   json_lexer lexer(json);
+    json_parser_lexer(lexer, graph_obj);
+}
+void json_parser(
+    const char*        data      ,
+    size_t             size      ,
+    cpp_graph&         graph_obj )
+{   json_lexer lexer(data, size);
+    json_parser_lexer(lexer, graph_obj);
+}
+void json_parser(
+    std::istream&      is        ,
+    cpp_graph&         graph_obj )
+{   json_lexer lexer(is);
+    json_parser_lexer(lexer, graph_obj);
+}
+
+} } } // END_CPPAD_LOCAL_GRAPH_NAMESPACE
@@ -0,0 +1,288 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin atomic_four_batch.cpp}
+
+Batched Atomic Function Calls: Example and Test
+###############################################
+
+Purpose
+*******
+This example demonstrates the
+:ref:`forward_batch and reverse_batch<atomic_four_batch-name>` callbacks.
+
+Function
+********
+For this example, the atomic function
+:math:`g : \B{R}^2 \rightarrow \B{R}` is defined by
+:math:`g(x) = x_0 * x_1`.
+It is called *n_call* times with different independent variables,
+and then once more with a function of the results of the first two calls.
+The first *n_call* calls form one batch.
+
+Define Atomic Function
+**********************
+{xrst_literal
+    // BEGIN_DEFINE_ATOMIC_FUNCTION
+    // END_DEFINE_ATOMIC_FUNCTION
+}
+
+Use Atomic Function
+*******************
+{xrst_literal
+    // BEGIN_USE_ATOMIC_FUNCTION
+    // END_USE_ATOMIC_FUNCTION
+}
+
+{xrst_end atomic_four_batch.cpp}
+*/
+# include <cppad/cppad.hpp>
+
+// BEGIN_DEFINE_ATOMIC_FUNCTION
+// empty namespace
+namespace {
+    //
+    class atomic_batch : public CppAD::atomic_four<double> {
+    private:
+        // n_forward_batch_, n_reverse_batch_, max_batch_
+        size_t n_forward_batch_;
+        size_t n_reverse_batch_;
+        size_t max_batch_;
+    public:
+        atomic_batch(const std::string& name) :
+        CppAD::atomic_four<double>(name) ,
+        n_forward_batch_(0)              ,
+        n_reverse_batch_(0)              ,
+        max_batch_(0)
+        { }
+        // n_forward_batch, n_reverse_batch, max_batch
+        size_t n_forward_batch(void) const
+        {   return n_forward_batch_; }
+        size_t n_reverse_batch(void) const
+        {   return n_reverse_batch_; }
+        size_t max_batch(void) const
+        {   return max_batch_; }
+    private:
+        // for_type
+        bool for_type(
+            size_t                                     call_id     ,
+            const CppAD::vector<CppAD::ad_type_enum>&  type_x      ,
+            CppAD::vector<CppAD::ad_type_enum>&        type_y      ) override
+        {   assert( type_x.size() == 2 );
+            assert( type_y.size() == 1 );
+            type_y[0] = std::max(type_x[0], type_x[1]);
+            return true;
+        }
+        // forward_kernel: evaluates n_call calls
+        static bool forward_kernel(
+            size_t                                    n_call       ,
+            size_t                                    order_low    ,
+            size_t                                    order_up     ,
+            const CppAD::vector<double>&              tx           ,
+            CppAD::vector<double>&                    ty           )
+        {   // this example only implements up to first order forward mode
+            if( order_up > 1 )
+                return false;
+            size_t q = order_up + 1;
+            for(size_t ell = 0; ell < n_call; ++ell)
+            {   const double* x = tx.data() + ell * 2 * q;
+                double*       y = ty.data() + ell * q;
+                if( order_low <= 0 )
+                    y[0] = x[0 * q + 0] * x[1 * q + 0];
+                if( order_up >= 1 ) y[1] =
+                    x[0 * q + 1] * x[1 * q + 0] + x[0 * q + 0] * x[1 * q + 1];
+            }
+            return true;
+        }
+        // reverse_kernel: evaluates n_call calls
+        static bool reverse_kernel(
+            size_t                                    n_call       ,
+            size_t                                    order_up     ,
+            const CppAD::vector<double>&              tx           ,
+            CppAD::vector<double>&                    px           ,
+            const CppAD::vector<double>&              py           )
+        {   // this example only implements zero order reverse mode
+            if( order_up > 0 )
+                return false;
+            for(size_t ell = 0; ell < n_call; ++ell)
+            {   px[2 * ell + 0] = py[ell] * tx[2 * ell + 1];
+                px[2 * ell + 1] = py[ell] * tx[2 * ell + 0];
+            }
+            return true;
+        }
+        // forward
+        bool forward(
+            size_t                                    call_id      ,
+            const CppAD::vector<bool>&                select_y     ,
+            size_t                                    order_low    ,
+            size_t                                    order_up     ,
+            const CppAD::vector<double>&              tx           ,
+            CppAD::vector<double>&                    ty           ) override
+        {   return forward_kernel(1, order_low, order_up, tx, ty);
+        }
+        // reverse
+        bool reverse(
+            size_t                                    call_id      ,
+            const CppAD::vector<bool>&                select_x     ,
+            size_t                                    order_up     ,
+            const CppAD::vector<double>&              tx           ,
+            const CppAD::vector<double>&              ty           ,
+            CppAD::vector<double>&                    px           ,
+            const CppAD::vector<double>&              py           ) override
+        {   return reverse_kernel(1, order_up, tx, px, py);
+        }
+        // forward_batch
+        bool forward_batch(
+            const CppAD::vector<size_t>&              call_id      ,
+            const CppAD::vector<bool>&                select_y     ,
+            size_t                                    order_low    ,
+            size_t                                    order_up     ,
+            const CppAD::vector<double>&              tx           ,
+            CppAD::vector<double>&                    ty           ) override
+        {   size_t n_call = call_id.size();
+            assert( tx.size() == n_call * 2 * (order_up + 1) );
+            assert( ty.size() == n_call * 1 * (order_up + 1) );
+            ++n_forward_batch_;
+            max_batch_ = std::max(max_batch_, n_call);
+            return forward_kernel(n_call, order_low, order_up, tx, ty);
+        }
+        // reverse_batch
+        bool reverse_batch(
+            const CppAD::vector<size_t>&              call_id      ,
+            const CppAD::vector<bool>&                select_x     ,
+            size_t                                    order_up     ,
+            const CppAD::vector<double>&              tx           ,
+            const CppAD::vector<double>&              ty           ,
+            CppAD::vector<double>&                    px           ,
+            const CppAD::vector<double>&              py           ) override
+        {   size_t n_call = call_id.size();
+            assert( px.size() == n_call * 2 * (order_up + 1) );
+            assert( py.size() == n_call * 1 * (order_up + 1) );
+            ++n_reverse_batch_;
+            max_batch_ = std::max(max_batch_, n_call);
+            return reverse_kernel(n_call, order_up, tx, px, py);
+        }
+    };
+}
+// END_DEFINE_ATOMIC_FUNCTION
+
+// BEGIN_USE_ATOMIC_FUNCTION
+bool batch(void)
+{   // ok, eps
+    bool ok = true;
+    double eps = 10. * CppAD::numeric_limits<double>::epsilon();
+    //
+    // AD, NearEqual
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    //
+    // afun
+    atomic_batch afun("atomic_batch");
+    //
+    // n_call, n, m
+    size_t n_call = 5;
+    size_t n      = 2 * n_call;
+    size_t m      = n_call + 1;
+    //
+    // ax
+    CPPAD_TESTVECTOR( AD<double> ) ax(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+    //
+    // ay
+    // The first n_call calls are independent and form one batch.
+    CPPAD_TESTVECTOR( AD<double> ) ay(m), au(2), av(1);
+    for(size_t ell = 0; ell < n_call; ++ell)
+    {   au[0] = ax[2 * ell + 0];
+        au[1] = ax[2 * ell + 1];
+        afun(au, av);
+        ay[ell] = av[0];
+    }
+    // This call depends on the previous calls so it is not in the batch.
+    au[0] = ay[0] + 1.0;
+    au[1] = ay[1];
+    afun(au, av);
+    ay[n_call] = av[0];
+    //
+    // f
+    CppAD::ADFun<double> f(ax, ay);
+    ok &= afun.max_batch() == n_call;
+    //
+    // y = f(x)
+    CPPAD_TESTVECTOR(double) x(n), y(m);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = double(j + 2);
+    size_t n_forward = afun.n_forward_batch();
+    y = f.Forward(0, x);
+    ok &= afun.n_forward_batch() == n_forward + 1;
+    for(size_t ell = 0; ell < n_call; ++ell)
+    {   double check = x[2 * ell] * x[2 * ell + 1];
+        ok &= NearEqual(y[ell], check, eps, eps);
+    }
+    ok &= NearEqual(y[n_call], (y[0] + 1.0) * y[1], eps, eps);
+    //
+    // dy = f'(x) * dx
+    CPPAD_TESTVECTOR(double) dx(n), dy(m);
+    for(size_t j = 0; j < n; ++j)
+        dx[j] = 0.0;
+    dx[0] = 1.0;
+    dy = f.Forward(1, dx);
+    ok &= afun.n_forward_batch() == n_forward + 2;
+    ok &= NearEqual(dy[0], x[1], eps, eps);
+    for(size_t ell = 1; ell < n_call; ++ell)
+        ok &= dy[ell] == 0.0;
+    ok &= NearEqual(dy[n_call], x[1] * y[1], eps, eps);
+    //
+    // dw = w^T * f'(x)
+    CPPAD_TESTVECTOR(double) w(m), dw(n);
+    for(size_t i = 0; i < m; ++i)
+        w[i] = 0.0;
+    w[0] = 1.0;
+    w[2] = 1.0;
+    dw = f.Reverse(1, w);
+    ok &= afun.n_reverse_batch() == 1;
+    for(size_t j = 0; j < n; ++j)
+    {   double check = 0.0;
+        if( j == 0 )
+            check = x[1];
+        if( j == 1 )
+            check = x[0];
+        if( j == 4 )
+            check = x[5];
+        if( j == 5 )
+            check = x[4];
+        ok &= NearEqual(dw[j], check, eps, eps);
+    }
+    //
+    // subgraph_reverse
+    // The subgraph for the last component of y contains the first two calls
+    // and they are evaluated using one reverse_batch callback.
+    CPPAD_TESTVECTOR(bool) select_domain(n);
+    for(size_t j = 0; j < n; ++j)
+        select_domain[j] = true;
+    f.subgraph_reverse(select_domain);
+    CPPAD_TESTVECTOR(size_t) col;
+    size_t q = 1;
+    f.subgraph_reverse(q, n_call, col, dw);
+    ok &= afun.n_reverse_batch() == 2;
+    ok &= col.size() == 4;
+    for(size_t c = 0; c < size_t( col.size() ); ++c)
+    {   size_t j = col[c];
+        double check = 0.0;
+        if( j == 0 )
+            check = x[1] * y[1];
+        if( j == 1 )
+            check = x[0] * y[1];
+        if( j == 2 )
+            check = (y[0] + 1.0) * x[3];
+        if( j == 3 )
+            check = (y[0] + 1.0) * x[2];
+        ok &= NearEqual(dw[j], check, eps, eps);
+    }
+    //
+    return ok;
+}
+// END_USE_ATOMIC_FUNCTION
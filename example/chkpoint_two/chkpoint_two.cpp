@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin chkpoint_two.cpp}
@@ -45,6 +45,7 @@ extern bool compare(void);
 extern bool dynamic(void);
 extern bool get_started(void);
 extern bool ode(void);
+extern bool parallel_for(void);
 
 // main program that runs all the tests
 int main(void)
@@ -60,6 +61,7 @@ int main(void)
     Run( dynamic,             "dynamic"        );
     Run( get_started,         "get_started"    );
     Run( ode,                 "ode"            );
+    Run( parallel_for,        "parallel_for"   );
     //
     // check for memory leak
     bool memory_ok = CppAD::thread_alloc::free_all();
@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin chkpoint_two_parallel_for.cpp}
+
+Checkpoint Calls Evaluated as Parallel Tasks: Example and Test
+##############################################################
+
+Purpose
+*******
+This example uses a checkpoint function for a scenario calculation
+that is called for each of *n_call* scenarios.
+The calls are evaluated as tasks using
+:ref:`chkpoint_two_parallel_for-name` .
+
+parallel_for
+************
+In order to keep this example simple, and not depend on a particular
+threading system, the tasks are executed by a sequential loop.
+See :ref:`chkpoint_two_parallel_for@parallel` for an
+OpenMP version of this routine.
+
+Source Code
+***********
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end chkpoint_two_parallel_for.cpp}
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+namespace {
+    using CppAD::AD;
+    typedef CPPAD_TESTVECTOR(AD<double>)            ADVector;
+    //
+    // g_algo
+    void g_algo(const ADVector& x, ADVector& y)
+    {   y[0] = x[0] * x[1];
+        y[1] = sin( x[0] );
+    }
+    //
+    // n_task_total
+    size_t n_task_total = 0;
+    //
+    // sequential_for
+    void sequential_for(
+        size_t n_task, void (*task)(size_t i_task, void* info), void* info
+    )
+    {   for(size_t i_task = 0; i_task < n_task; ++i_task)
+        {   task(i_task, info);
+            ++n_task_total;
+        }
+    }
+}
+bool parallel_for(void)
+{   bool ok = true;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    // g_fun
+    size_t n = 2, m = 2;
+    ADVector ax(n), ay(m);
+    for(size_t j = 0; j < n; j++)
+        ax[j] = double(j + 1);
+    Independent(ax);
+    g_algo(ax, ay);
+    CppAD::ADFun<double> g_fun(ax, ay);
+    //
+    // g_chk
+    bool internal_bool    = false;
+    bool use_hes_sparsity = false;
+    bool use_base2ad      = false;
+    bool use_in_parallel  = true;
+    CppAD::chkpoint_two<double> g_chk( g_fun, "g_chk",
+        internal_bool, use_hes_sparsity, use_base2ad, use_in_parallel
+    );
+    g_chk.parallel_for(sequential_for);
+    //
+    // f, check_f
+    // The scenario calls do not depend on each other.
+    size_t n_call = 4;
+    ADVector au(n * n_call), av(m * n_call);
+    for(size_t j = 0; j < n * n_call; j++)
+        au[j] = double(j + 1);
+    CppAD::ADFun<double> f, check_f;
+    for(size_t use_chk = 0; use_chk < 2; ++use_chk)
+    {   Independent(au);
+        for(size_t ell = 0; ell < n_call; ++ell)
+        {   for(size_t j = 0; j < n; ++j)
+                ax[j] = au[ell * n + j];
+            if( use_chk == 1 )
+                g_chk(ax, ay);
+            else
+                g_algo(ax, ay);
+            for(size_t i = 0; i < m; ++i)
+                av[ell * m + i] = ay[i];
+        }
+        if( use_chk == 1 )
+            f.Dependent(au, av);
+        else
+            check_f.Dependent(au, av);
+    }
+    //
+    // zero order forward
+    size_t n_task = n_task_total;
+    CPPAD_TESTVECTOR(double) u(n * n_call), v(m * n_call), check(m * n_call);
+    for(size_t j = 0; j < n * n_call; ++j)
+        u[j] = 1.0 / double(j + 1);
+    v     = f.Forward(0, u);
+    check = check_f.Forward(0, u);
+    ok   &= n_task_total == n_task + n_call;
+    for(size_t i = 0; i < m * n_call; ++i)
+        ok &= NearEqual(v[i], check[i], eps99, eps99);
+    //
+    // first order forward
+    for(size_t j = 0; j < n * n_call; ++j)
+        u[j] = double(j % 3);
+    v     = f.Forward(1, u);
+    check = check_f.Forward(1, u);
+    ok   &= n_task_total == n_task + 2 * n_call;
+    for(size_t i = 0; i < m * n_call; ++i)
+        ok &= NearEqual(v[i], check[i], eps99, eps99);
+    //
+    // second order reverse
+    CPPAD_TESTVECTOR(double) w(m * n_call), du(2 * n * n_call), dcheck;
+    for(size_t i = 0; i < m * n_call; ++i)
+        w[i] = double(i + 1);
+    du     = f.Reverse(2, w);
+    dcheck = check_f.Reverse(2, w);
+    ok    &= n_task_total == n_task + 3 * n_call;
+    for(size_t j = 0; j < 2 * n * n_call; ++j)
+        ok &= NearEqual(du[j], dcheck[j], eps99, eps99);
+    //
+    return ok;
+}
+// END C++
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin base2float.cpp}
+
+Evaluating a Function Using float: Example and Test
+###################################################
+
+Purpose
+*******
+This example records a sum of squares using ``double`` ,
+optimizes it so that the summation becomes a cumulative summation,
+and then uses :ref:`base2float-name` to evaluate it using ``float`` .
+
+Source Code
+***********
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end base2float.cpp}
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+bool base2float(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    typedef CPPAD_TESTVECTOR(double)     d_vector;
+    typedef CPPAD_TESTVECTOR(float)      f_vector;
+    typedef CPPAD_TESTVECTOR(AD<double>) ad_vector;
+    //
+    // eps99
+    double eps99 = 99.0 * double( std::numeric_limits<float>::epsilon() );
+    //
+    // f
+    // y = (x_0 - 1)^2 + ... + (x_{n-1} - 1)^2
+    size_t n = 1000;
+    ad_vector ax(n), ay(1);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = 0.0;
+    CppAD::Independent(ax);
+    ay[0] = 0.0;
+    for(size_t j = 0; j < n; ++j)
+        ay[0] += (ax[j] - 1.0) * (ax[j] - 1.0);
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // optimize
+    // this converts the summation to a cumulative summation
+    f.optimize();
+    //
+    // ff, fd
+    CppAD::ADFun<float> ff = f.base2float();
+    CppAD::ADFun<float> fd = f.base2float(true);
+    ok &= ff.size_var()   == f.size_var();
+    ok &= ff.size_order() == 0;
+    //
+    // x, xf
+    d_vector x(n);
+    f_vector xf(n);
+    for(size_t j = 0; j < n; ++j)
+    {   xf[j] = float(j) / float(n);
+        x[j]  = double( xf[j] );
+    }
+    //
+    // check zero order forward
+    d_vector y  = f.Forward(0, x);
+    f_vector yf = ff.Forward(0, xf);
+    f_vector yd = fd.Forward(0, xf);
+    ok &= NearEqual( double(yf[0]), y[0], eps99, eps99);
+    ok &= NearEqual( double(yd[0]), y[0], eps99, eps99);
+    //
+    // check that summing using double is no worse than summing using float
+    double err_f = std::fabs( double(yf[0]) - y[0] );
+    double err_d = std::fabs( double(yd[0]) - y[0] );
+    ok &= err_d <= err_f;
+    //
+    // check first order reverse
+    d_vector w(1), dw;
+    f_vector wf(1), dwf;
+    w[0]  = 1.0;
+    wf[0] = 1.0f;
+    dw    = f.Reverse(1, w);
+    dwf   = ff.Reverse(1, wf);
+    for(size_t j = 0; j < n; ++j)
+        ok &= NearEqual( double(dwf[j]), dw[j], eps99, eps99);
+    //
+    return ok;
+}
+// END C++
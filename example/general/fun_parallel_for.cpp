@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin fun_parallel_for.cpp}
+
+Evaluating an ADFun Using Parallel Tasks: Example and Test
+##########################################################
+
+Purpose
+*******
+This example uses a function with many residuals that do not depend
+on each other, so its zero order forward and first order reverse
+calculations can be evaluated as tasks using :ref:`fun_parallel_for-name` .
+
+parallel_for
+************
+In order to keep this example simple, and not depend on a particular
+threading system, the tasks are executed by a sequential loop.
+See :ref:`fun_parallel_for@parallel` for an
+OpenMP version of this routine.
+
+Source Code
+***********
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end fun_parallel_for.cpp}
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+namespace {
+    //
+    // n_task_total
+    size_t n_task_total = 0;
+    //
+    // sequential_for
+    void sequential_for(
+        size_t n_task, void (*task)(size_t i_task, void* info), void* info
+    )
+    {   for(size_t i_task = 0; i_task < n_task; ++i_task)
+        {   task(i_task, info);
+            ++n_task_total;
+        }
+    }
+}
+bool fun_parallel_for(void)
+{   bool ok = true;
+    using CppAD::AD;
+    typedef CPPAD_TESTVECTOR(double)     d_vector;
+    typedef CPPAD_TESTVECTOR(AD<double>) ad_vector;
+    //
+    // f
+    // y_i = sin(x_i) * x_{i+1} + 2 where x_n = x_0
+    size_t n = 1000;
+    ad_vector ax(n), ay(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j) / double(n);
+    CppAD::Independent(ax);
+    for(size_t i = 0; i < n; ++i)
+        ay[i] = sin( ax[i] ) * ax[ (i + 1) % n ] + 2.0;
+    //
+    // a comparison that is included in the recording
+    if( ax[0] < 0.5 )
+        ay[0] += 1.0;
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // g
+    // a copy of f that evaluates the operations one at a time
+    CppAD::ADFun<double> g;
+    g = f;
+    //
+    // f.parallel_for
+    f.parallel_for(sequential_for);
+    //
+    // x
+    d_vector x(n);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = double(j + 1) / double(n);
+    //
+    // y, check
+    // the results using tasks are identical to the sequential results
+    d_vector y     = f.Forward(0, x);
+    d_vector check = g.Forward(0, x);
+    for(size_t i = 0; i < n; ++i)
+        ok &= y[i] == check[i];
+    //
+    // the operations in each level were executed as tasks
+    ok &= n_task_total > 0;
+    //
+    // the comparison changed because x_0 >= 0.5
+    x[0]  = 0.75;
+    y     = f.Forward(0, x);
+    check = g.Forward(0, x);
+    for(size_t i = 0; i < n; ++i)
+        ok &= y[i] == check[i];
+    ok &= f.compare_change_number() == 1;
+    ok &= g.compare_change_number() == 1;
+    //
+    // f.parallel_reverse
+    f.parallel_reverse("deterministic");
+    //
+    // dw, check
+    // first order reverse results using tasks are identical to the
+    // sequential results (x_{i+1} is used by the residuals i and i+1)
+    d_vector w(n);
+    for(size_t i = 0; i < n; ++i)
+        w[i] = 1.0 / double(i + 1);
+    size_t n_task = n_task_total;
+    d_vector dw   = f.Reverse(1, w);
+    check         = g.Reverse(1, w);
+    for(size_t j = 0; j < n; ++j)
+        ok &= dw[j] == check[j];
+    ok &= n_task < n_task_total;
+    //
+    return ok;
+}
+// END C++
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin general.cpp}
@@ -103,6 +103,7 @@ extern bool atan2(void);
 extern bool atanh(void);
 extern bool azmul(void);
 extern bool base2ad(void);
+extern bool base2float(void);
 extern bool base2vec_ad(void);
 extern bool base_require(void);
 extern bool capacity_order(void);
@@ -120,10 +121,13 @@ extern bool fabs(void);
 extern bool forward_dir(void);
 extern bool forward_order(void);
 extern bool fun_assign(void);
+extern bool fun_parallel_for(void);
 extern bool fun_property(void);
 extern bool function_name(void);
+extern bool hessian_dir(void);
 extern bool interp_onetape(void);
 extern bool interp_retape(void);
+extern bool lazy(void);
 extern bool log(void);
 extern bool log10(void);
 extern bool log1p(void);
@@ -144,8 +148,10 @@ extern bool rev_checkpoint(void);
 extern bool reverse_one(void);
 extern bool reverse_three(void);
 extern bool reverse_two(void);
+extern bool reuse_recording(void);
 extern bool sign(void);
 extern bool taylor_ode(void);
+extern bool tensor_dir(void);
 extern bool unary_minus(void);
 extern bool unary_plus(void);
 extern bool vec_ad(void);
@@ -220,6 +226,7 @@ int main(void)
     Run( atanh,             "atanh"            );
     Run( azmul,             "azmul"            );
     Run( base2ad,           "base2ad"          );
+    Run( base2float,        "base2float"       );
     Run( base2vec_ad,       "base2vec_ad"      );
     Run( base_require,      "base_require"     );
     Run( capacity_order,    "capacity_order"   );
@@ -234,10 +241,13 @@ int main(void)
     Run( forward_dir,       "forward_dir"      );
     Run( forward_order,     "forward_order"    );
     Run( fun_assign,        "fun_assign"       );
+    Run( fun_parallel_for,  "fun_parallel_for" );
     Run( fun_property,      "fun_property"     );
     Run( function_name,     "function_name"    );
+    Run( hessian_dir,       "hessian_dir"      );
     Run( interp_onetape,    "interp_onetape"   );
     Run( interp_retape,     "interp_retape"    );
+    Run( lazy,              "lazy"             );
     Run( log,               "log"              );
     Run( log10,             "log10"            );
     Run( log1p,             "log1p"            );
@@ -255,8 +265,10 @@ int main(void)
     Run( reverse_one,       "reverse_one"      );
     Run( reverse_three,     "reverse_three"    );
     Run( reverse_two,       "reverse_two"      );
+    Run( reuse_recording,   "reuse_recording"  );
     Run( sign,              "sign"             );
     Run( taylor_ode,        "ode_taylor"       );
+    Run( tensor_dir,        "tensor_dir"       );
     Run( unary_minus,       "unary_minus"      );
     Run( unary_plus,        "unary_plus"       );
     Run( vec_ad,            "vec_ad"           );
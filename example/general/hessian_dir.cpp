@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin hessian_dir.cpp}
+
+HessianDir: Example and Test
+############################
+
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end hessian_dir.cpp}
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+bool hessian_dir(void)
+{   bool ok = true;
+
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    typedef CPPAD_TESTVECTOR(double)     d_vector;
+    typedef CPPAD_TESTVECTOR(AD<double>) ad_vector;
+
+    // domain space vector
+    size_t n = 7;
+    ad_vector ax(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1) / double(n);
+
+    // declare independent variables and start recording
+    CppAD::Independent(ax);
+
+    // range space vector
+    // y[0] = sin( sum_j (j+1) x_j ), y[1] = sum_j x_j^3
+    size_t m = 2;
+    ad_vector ay(m);
+    AD<double> asum = 0.0;
+    ay[1] = 0.0;
+    for(size_t j = 0; j < n; ++j)
+    {   asum  += double(j + 1) * ax[j];
+        ay[1] += ax[j] * ax[j] * ax[j];
+    }
+    ay[0] = sin(asum);
+
+    // create f: x -> y and stop tape recording
+    CppAD::ADFun<double> f(ax, ay);
+
+    // point at which to evaluate the Hessian and range weights
+    d_vector x(n), w(m);
+    double sum = 0.0;
+    for(size_t j = 0; j < n; ++j)
+    {   x[j] = double(n - j) / double(n);
+        sum += double(j + 1) * x[j];
+    }
+    w[0] = 2.0;
+    w[1] = 3.0;
+
+    // check HessianDir using 3 directions per forward sweep
+    size_t   r   = 3;
+    d_vector hes = f.HessianDir(x, w, r);
+    d_vector check(n * n);
+    for(size_t i = 0; i < n; ++i)
+    {   for(size_t j = 0; j < n; ++j)
+        {   check[i * n + j] = - w[0] * double( (i + 1) * (j + 1) );
+            check[i * n + j]  *= std::sin(sum);
+            if( i == j )
+                check[i * n + j] += w[1] * 6.0 * x[j];
+            ok &= NearEqual(hes[i * n + j], check[i * n + j], eps99, eps99);
+        }
+    }
+
+    // check that HessianDir and Hessian give the same result
+    d_vector hes_check = f.Hessian(x, w);
+    for(size_t k = 0; k < n * n; ++k)
+        ok &= NearEqual(hes[k], hes_check[k], eps99, eps99);
+
+    // check a Hessian times matrix product where V is n by 2
+    size_t k = 2;
+    d_vector v(n * k);
+    for(size_t j = 0; j < n; ++j)
+    {   v[j * k + 0] = 1.0;
+        v[j * k + 1] = double(j);
+    }
+    d_vector hv = f.HessianDir(x, w, v, r);
+    for(size_t i = 0; i < n; ++i)
+    {   for(size_t ell = 0; ell < k; ++ell)
+        {   double sum_ij = 0.0;
+            for(size_t j = 0; j < n; ++j)
+                sum_ij += check[i * n + j] * v[j * k + ell];
+            ok &= NearEqual(hv[i * k + ell], sum_ij, eps99, eps99);
+        }
+    }
+
+    return ok;
+}
+
+// END C++
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin lazy.cpp}
+
+Lazy Recording of Sums: Example and Test
+########################################
+
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end lazy.cpp}
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+bool lazy(void)
+{   bool ok = true;
+
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    using CppAD::lazy;
+    double eps = 10. * std::numeric_limits<double>::epsilon();
+
+    // domain space vector
+    size_t n = 5;
+    CPPAD_TESTVECTOR(double)       x(n);
+    CPPAD_TESTVECTOR(AD<double>)   ax(n);
+    for(size_t j = 0; j < n; ++j)
+    {   x[j]  = double(j + 2);
+        ax[j] = x[j];
+    }
+
+    // declare independent variables and start tape recording
+    CppAD::Independent(ax);
+    AD<double> a = ax[0], b = ax[1], c = ax[2], d = ax[3], e = ax[4];
+
+    // range space vector
+    size_t m = 3;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+
+    // a * b + c * d - e using AD<double> operations
+    ay[0] = a * b + c * d - e;
+
+    // a * b + c * d - e using one cumulative summation
+    ay[1] = lazy(a) * b + lazy(c) * d - e;
+
+    // convert to AD<double> before calling a function templated on Base
+    ay[2] = exp( AD<double>( lazy(a) - 2.0 * (lazy(b) - c) + d ) );
+
+    // create f: x -> y and stop tape recording
+    CppAD::ADFun<double> f(ax, ay);
+
+    // The operators in the tape are: BeginOp, 5 * InvOp,
+    // 2 * MulvvOp, AddvvOp, SubvvOp for ay[0],
+    // 2 * MulvvOp, CSumOp for ay[1],
+    // SubvvOp, MulpvOp, CSumOp, ExpOp for ay[2], and EndOp.
+    // Note that b - c has only two terms so it uses SubvvOp.
+    ok &= f.size_op() == 1 + 5 + 4 + 3 + 4 + 1;
+
+    // check values
+    CPPAD_TESTVECTOR(double) y = f.Forward(0, x);
+    double check = x[0] * x[1] + x[2] * x[3] - x[4];
+    ok &= NearEqual(y[0], check, eps, eps);
+    ok &= NearEqual(y[1], check, eps, eps);
+    check = std::exp( x[0] - 2.0 * (x[1] - x[2]) + x[3] );
+    ok &= NearEqual(y[2], check, eps, eps);
+
+    // check derivatives
+    CPPAD_TESTVECTOR(double) w(m), dw(n);
+    w[0] = 0.0;
+    w[1] = 1.0;
+    w[2] = 0.0;
+    dw   = f.Reverse(1, w);
+    ok  &= NearEqual(dw[0], x[1], eps, eps);
+    ok  &= NearEqual(dw[1], x[0], eps, eps);
+    ok  &= NearEqual(dw[2], x[3], eps, eps);
+    ok  &= NearEqual(dw[3], x[2], eps, eps);
+    ok  &= NearEqual(dw[4], -1.0, eps, eps);
+    w[1] = 0.0;
+    w[2] = 1.0;
+    dw   = f.Reverse(1, w);
+    ok  &= NearEqual(dw[0],        check, eps, eps);
+    ok  &= NearEqual(dw[1], -2.0 * check, eps, eps);
+    ok  &= NearEqual(dw[2],  2.0 * check, eps, eps);
+    ok  &= NearEqual(dw[3],        check, eps, eps);
+    ok  &= NearEqual(dw[4],          0.0, eps, eps);
+
+    return ok;
+}
+
+// END C++
@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin reuse_recording.cpp}
+
+Reuse Recording Memory: Example and Test
+########################################
+
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end reuse_recording.cpp}
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+namespace {
+    // number of terms in the series for exp(x) that are greater than eps;
+    // i.e., the control flow depends on the value of x.
+    template <class Scalar>
+    Scalar exp_series(const Scalar& x, double eps, size_t& n_term)
+    {   Scalar term = 1.0;
+        Scalar sum  = 1.0;
+        n_term      = 1;
+        while( eps < CppAD::Value( CppAD::Var2Par(term) ) )
+        {   term = term * x / double(n_term);
+            sum  = sum + term;
+            ++n_term;
+        }
+        return sum;
+    }
+}
+
+bool reuse_recording(void)
+{   bool ok = true;
+
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    using CppAD::thread_alloc;
+    double eps = 10. * std::numeric_limits<double>::epsilon();
+
+    // vectors used to record and evaluate the function
+    CPPAD_TESTVECTOR(AD<double>) ax(1), ay(1);
+    CPPAD_TESTVECTOR(double)     x(1), y(1), dx(1), dy(1);
+
+    // memory in use by this thread before recording
+    size_t thread   = thread_alloc::thread_num();
+    size_t inuse_0  = thread_alloc::inuse(thread);
+
+    // keep the memory used by each recording for the next recording
+    AD<double>::reuse_recording(true);
+
+    // retape the function for each argument value
+    size_t n_term_previous = 0;
+    {   CppAD::ADFun<double> f;
+        for(size_t k = 0; k < 4; ++k)
+        {   x[0]  = 0.25 * double(k + 1);
+            ax[0] = x[0];
+            CppAD::Independent(ax);
+            size_t n_term;
+            ay[0] = exp_series(ax[0], 1e-10, n_term);
+            f.Dependent(ax, ay);
+            //
+            // the operation sequence depends on the value of x
+            ok &= n_term_previous < n_term;
+            n_term_previous = n_term;
+            //
+            // check the function value and its derivative
+            y     = f.Forward(0, x);
+            dx[0] = 1.0;
+            dy    = f.Forward(1, dx);
+            ok   &= NearEqual(y[0], std::exp(x[0]), 1e-9, eps);
+            ok   &= NearEqual(dy[0], y[0], 1e-9, eps);
+        }
+    } // the memory for f is freed here
+
+    // memory for the last recording is being kept for this thread
+    ok &= inuse_0 < thread_alloc::inuse(thread);
+
+    // stop reusing recording memory and free the memory being kept
+    AD<double>::reuse_recording(false);
+    ok &= inuse_0 == thread_alloc::inuse(thread);
+
+    return ok;
+}
+
+// END C++
@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin tensor_dir.cpp}
+
+TensorDir: Example and Test
+###########################
+
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end tensor_dir.cpp}
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+bool tensor_dir(void)
+{   bool ok = true;
+
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    typedef CPPAD_TESTVECTOR(double)     d_vector;
+    typedef CPPAD_TESTVECTOR(AD<double>) ad_vector;
+
+    // domain space vector
+    size_t n = 3;
+    ad_vector ax(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = 0.0;
+
+    // declare independent variables and start recording
+    CppAD::Independent(ax);
+
+    // range space vector
+    // y[0] = x_0 * x_1 * x_2 + x_0^3
+    // y[1] = exp(x_0 + 2 * x_1 - x_2)
+    size_t m = 2;
+    ad_vector ay(m);
+    ay[0] = ax[0] * ax[1] * ax[2] + ax[0] * ax[0] * ax[0];
+    ay[1] = exp( ax[0] + 2.0 * ax[1] - ax[2] );
+
+    // create f: x -> y and stop tape recording
+    CppAD::ADFun<double> f(ax, ay);
+
+    // point at which to evaluate the derivatives
+    d_vector x(n);
+    x[0] = 0.5;
+    x[1] = 0.25;
+    x[2] = -0.125;
+    double e = std::exp( x[0] + 2.0 * x[1] - x[2] );
+    double c[3] = { 1.0, 2.0, -1.0};
+
+    // all third order partials using 4 directions per forward sweep
+    size_t   d   = 3;
+    size_t   r   = 4;
+    d_vector ten = f.TensorDir(x, d, r);
+
+    // number of index sequences 0 <= j_1 <= j_2 <= j_3 < n
+    size_t N = 10;
+    ok &= ten.size() == m * N;
+
+    // check the results in the order
+    // (0,0,0),(0,0,1),(0,0,2),(0,1,1),(0,1,2),
+    // (0,2,2),(1,1,1),(1,1,2),(1,2,2),(2,2,2)
+    size_t a = 0;
+    for(size_t j1 = 0; j1 < n; ++j1)
+    {   for(size_t j2 = j1; j2 < n; ++j2)
+        {   for(size_t j3 = j2; j3 < n; ++j3)
+            {   // partial of y[0]
+                double check = 0.0;
+                if( j1 == 0 && j2 == 0 && j3 == 0 )
+                    check = 6.0;
+                if( j1 == 0 && j2 == 1 && j3 == 2 )
+                    check = 1.0;
+                ok &= NearEqual(ten[0 * N + a], check, eps99, eps99);
+                //
+                // partial of y[1]
+                check = c[j1] * c[j2] * c[j3] * e;
+                ok &= NearEqual(ten[1 * N + a], check, eps99, eps99);
+                ++a;
+            }
+        }
+    }
+    ok &= a == N;
+
+    // second order partials of G(z) = F(x + S z) where S is n by 1;
+    // i.e., second directional derivative in the direction S
+    size_t   p   = 1;
+    d_vector s(n * p);
+    s[0] = 1.0;
+    s[1] = 1.0;
+    s[2] = 0.0;
+    d     = 2;
+    ten   = f.TensorDir(x, s, d, r);
+    ok   &= ten.size() == m * 1;
+    //
+    // G_0(z) = (x_0 + z) (x_1 + z) x_2 + (x_0 + z)^3
+    double check = 2.0 * x[2] + 6.0 * x[0];
+    ok &= NearEqual(ten[0], check, eps99, eps99);
+    //
+    // G_1(z) = exp(x_0 + 2 x_1 - x_2 + 3 z)
+    check = 9.0 * e;
+    ok &= NearEqual(ten[1], check, eps99, eps99);
+
+    return ok;
+}
+
+// END C++
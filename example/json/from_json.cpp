@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin from_json.cpp}
@@ -18,6 +18,7 @@ Source Code
 {xrst_end from_json.cpp}
 */
 // BEGIN C++
+# include <sstream>
 # include <cppad/cppad.hpp>
 
 bool from_json(void)
@@ -71,6 +72,19 @@ bool from_json(void)
     ok &= jac[0] == 2.0 * (p[0] + x[0] + x[1]);
     ok &= jac[1] == 2.0 * (p[0] + x[0] + x[1]);
     //
+    // Same function using a character array and size
+    CppAD::ADFun<double> fun_data;
+    fun_data.from_json( json.data(), json.size() );
+    fun_data.new_dynamic(p);
+    ok &= fun_data.Forward(0, x)[0] == y[0];
+    //
+    // Same function reading it from a stream
+    std::istringstream is(json);
+    CppAD::ADFun<double> fun_stream;
+    fun_stream.from_json(is);
+    fun_stream.new_dynamic(p);
+    ok &= fun_stream.Forward(0, x)[0] == y[0];
+    //
     return ok;
 }
 // END C++
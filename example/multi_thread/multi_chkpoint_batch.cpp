@@ -0,0 +1,257 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin multi_chkpoint_batch.cpp}
+
+Timing chkpoint_two Calls Evaluated by a Team of Threads
+########################################################
+
+Syntax
+******
+
+| *ok* = ``multi_chkpoint_batch_time`` (
+| |tab| *time_out* , *test_time* , *num_threads* , *size*
+| )
+
+Purpose
+*******
+This is a timing test for one ``ADFun<double>`` object that calls a
+``chkpoint_two`` function once for each of *size* scenarios.
+The calls do not depend on each other, so they form a batch that is
+evaluated using a team of threads; see :ref:`chkpoint_two_parallel_for-name` .
+The checkpoint function :math:`g : \B{R}^2 \rightarrow \B{R}^2`
+takes ten Euler steps for a pendulum.
+Each repetition of the test computes the function using zero order forward
+mode and the derivative of the sum of its components
+using first order reverse mode.
+
+parallel_for
+************
+The tasks are executed by calling ``team_work`` (see :ref:`team_thread.hpp-name` )
+and each thread repeatedly takes the next task that has not yet been executed.
+
+Thread
+******
+It is assumed that this function is called by thread zero in sequential
+mode; i.e., not :ref:`in_parallel<ta_in_parallel-name>` .
+
+time_out
+********
+The input value of this argument does not matter.
+Upon return it is the number of wall clock seconds
+for one zero order forward and one first order reverse calculation.
+
+test_time
+*********
+is the minimum amount of wall clock time that the test should take.
+The number of repeats will be increased until this time is reached.
+
+num_threads
+***********
+is the number of threads that are available for this test.
+If it is zero, the test is run without the multi-threading environment
+and ``parallel_for`` is not used.
+
+size
+****
+is the number of scenarios; i.e., the number of calls to the
+checkpoint function.
+
+ok
+**
+If it is true, ``multi_chkpoint_batch_time`` did not detect an error;
+e.g., the results with and without threading are the same
+and the tasks were executed when *num_threads* is not zero.
+
+Source
+******
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end multi_chkpoint_batch.cpp}
+*/
+// BEGIN C++
+# include <atomic>
+# include <cppad/cppad.hpp>
+# include "multi_chkpoint_batch.hpp"
+# include "team_thread.hpp"
+
+namespace {
+    using CppAD::thread_alloc;
+    using CppAD::vector;
+    typedef CppAD::AD<double> a_double;
+    //
+    // the checkpoint function, the function that is evaluated,
+    // its argument and value, the range space weights, and the derivative
+    CppAD::chkpoint_two<double>* g_chk_ = nullptr;
+    CppAD::ADFun<double>* fun_ = nullptr;
+    vector<double>*       x_   = nullptr;
+    vector<double>*       y_   = nullptr;
+    vector<double>*       w_   = nullptr;
+    vector<double>*       dw_  = nullptr;
+    //
+    // the tasks for the current call to parallel_for
+    size_t                n_task_ = 0;
+    void                  (*task_)(size_t i_task, void* info) = nullptr;
+    void*                 info_   = nullptr;
+    //
+    // index of the next task that has not been started
+    std::atomic<size_t>   next_task_;
+    //
+    // total number of tasks that have been executed
+    std::atomic<size_t>   n_task_total_;
+    // ------------------------------------------------------------------------
+    // worker: execute tasks until they have all been started
+    void worker(void)
+    {   size_t i_task = next_task_++;
+        while( i_task < n_task_ )
+        {   task_(i_task, info_);
+            ++n_task_total_;
+            i_task = next_task_++;
+        }
+    }
+    // ------------------------------------------------------------------------
+    // parallel_for: execute the tasks using the team of threads
+    void parallel_for(
+        size_t n_task, void (*task)(size_t i_task, void* info), void* info
+    )
+    {   n_task_    = n_task;
+        task_      = task;
+        info_      = info;
+        next_task_ = 0;
+        team_work(worker);
+    }
+    // ------------------------------------------------------------------------
+    // g_algo: ten Euler steps for a pendulum
+    void g_algo(const vector<a_double>& ax, vector<a_double>& ay)
+    {   a_double theta = ax[0];
+        a_double omega = ax[1];
+        for(size_t k = 0; k < 10; ++k)
+        {   a_double temp = theta;
+            theta = theta + 0.1 * omega;
+            omega = omega - 0.1 * sin(temp);
+        }
+        ay[0] = theta;
+        ay[1] = omega;
+    }
+    // ------------------------------------------------------------------------
+    // record f(x)
+    void record(CppAD::ADFun<double>& fun, size_t size)
+    {   vector<a_double> ax(2 * size), ay(2 * size), au(2), av(2);
+        for(size_t j = 0; j < 2 * size; ++j)
+            ax[j] = double(j + 1) / double(2 * size);
+        CppAD::Independent(ax);
+        for(size_t ell = 0; ell < size; ++ell)
+        {   au[0] = ax[2 * ell];
+            au[1] = ax[2 * ell + 1];
+            (*g_chk_)(au, av);
+            ay[2 * ell]     = av[0];
+            ay[2 * ell + 1] = av[1];
+        }
+        fun.Dependent(ax, ay);
+    }
+    // ------------------------------------------------------------------------
+    // test_repeat: used by time_test
+    void test_repeat(size_t repeat)
+    {   for(size_t i_repeat = 0; i_repeat < repeat; ++i_repeat)
+        {   *y_  = fun_->Forward(0, *x_);
+            *dw_ = fun_->Reverse(1, *w_);
+        }
+    }
+}
+// This is the only routine that is accessible outside of this file
+bool multi_chkpoint_batch_time(
+    double& time_out    ,
+    double  test_time   ,
+    size_t  num_threads ,
+    size_t  size        )
+{   bool ok = true;
+    //
+    size_t initial_inuse = thread_alloc::inuse(0);
+    //
+    // create team of threads
+    ok &= thread_alloc::in_parallel() == false;
+    if( num_threads > 0 )
+    {   team_create(num_threads);
+        ok &= num_threads == thread_alloc::num_threads();
+    }
+    else
+    {   ok &= 1 == thread_alloc::num_threads();
+    }
+    //
+    // g_chk_
+    {   vector<a_double> au(2), av(2);
+        au[0] = 0.0;
+        au[1] = 0.0;
+        CppAD::Independent(au);
+        g_algo(au, av);
+        CppAD::ADFun<double> g_fun(au, av);
+        bool internal_bool    = false;
+        bool use_hes_sparsity = false;
+        bool use_base2ad      = false;
+        bool use_in_parallel  = true;
+        g_chk_ = new CppAD::chkpoint_two<double>( g_fun, "g_chk",
+            internal_bool, use_hes_sparsity, use_base2ad, use_in_parallel
+        );
+    }
+    //
+    // fun_, x_, y_, w_, dw_
+    size_t n = 2 * size;
+    fun_     = new CppAD::ADFun<double>;
+    x_       = new vector<double>(n);
+    y_       = new vector<double>(n);
+    w_       = new vector<double>(n);
+    dw_      = new vector<double>(n);
+    record(*fun_, size);
+    for(size_t j = 0; j < n; ++j)
+    {   (*x_)[j] = double(j + 2) / double(n);
+        (*w_)[j] = 1.0;
+    }
+    //
+    // check, check_dw, y_, dw_
+    // results without using parallel_for
+    vector<double> check    = fun_->Forward(0, *x_);
+    vector<double> check_dw = fun_->Reverse(1, *w_);
+    if( num_threads > 0 )
+        g_chk_->parallel_for(parallel_for);
+    n_task_total_ = 0;
+    test_repeat(1);
+    for(size_t i = 0; i < n; ++i)
+    {   ok &= (*y_)[i] == check[i];
+        ok &= (*dw_)[i] == check_dw[i];
+    }
+    // one task per call for forward and for reverse
+    if( num_threads > 0 )
+        ok &= n_task_total_ == 2 * size;
+    else
+        ok &= n_task_total_ == 0;
+    //
+    // time_out
+    time_out = CppAD::time_test(test_repeat, test_time);
+    //
+    // free the memory used by this test
+    delete fun_;
+    delete g_chk_;
+    delete x_;
+    delete y_;
+    delete w_;
+    delete dw_;
+    check.clear();
+    check_dw.clear();
+    //
+    // destroy team of threads
+    if( num_threads > 0 )
+        team_destroy();
+    ok &= thread_alloc::in_parallel() == false;
+    //
+    // check that no static variables in this file are holding onto memory
+    ok &= initial_inuse == thread_alloc::inuse(0);
+    //
+    return ok;
+}
+// END C++
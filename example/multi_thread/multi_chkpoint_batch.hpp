@@ -0,0 +1,15 @@
+# ifndef CPPAD_EXAMPLE_MULTI_THREAD_MULTI_CHKPOINT_BATCH_HPP
+# define CPPAD_EXAMPLE_MULTI_THREAD_MULTI_CHKPOINT_BATCH_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+bool multi_chkpoint_batch_time(
+    double& time_out    ,
+    double  test_time   ,
+    size_t  num_threads ,
+    size_t  size
+);
+
+# endif
@@ -0,0 +1,239 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin multi_level.cpp}
+
+Timing One ADFun Evaluation Using a Team of Threads
+###################################################
+
+Syntax
+******
+
+| *ok* = ``multi_level_time`` (
+| |tab| *time_out* , *test_time* , *num_threads* , *size*
+| )
+
+Purpose
+*******
+This is a timing test for one ``ADFun<double>`` object
+that is evaluated using a team of threads; see :ref:`fun_parallel_for-name` .
+(The :ref:`multi_scaling.cpp-name` test uses a separate function object
+for each thread.)
+The function :math:`f : \B{R}^n \rightarrow \B{R}^n` is
+
+.. math::
+
+    f_i (x) = \exp( x_i ) \cos( x_{i+1} ) + x_i x_i
+
+where :math:`x_n = x_0` .
+The operations that compute the different components of :math:`f(x)`
+do not depend on each other, so they can be evaluated in parallel.
+Each repetition of the test computes :math:`f(x)` using zero order forward
+mode and the derivative of :math:`f_0 (x) + \cdots + f_{n-1} (x)`
+using first order reverse mode.
+The reverse mode calculation uses the ``deterministic``
+:ref:`fun_parallel_for@mode` .
+
+parallel_for
+************
+The tasks are executed by calling ``team_work`` (see :ref:`team_thread.hpp-name` )
+and each thread repeatedly takes the next task that has not yet been executed.
+
+Thread
+******
+It is assumed that this function is called by thread zero in sequential
+mode; i.e., not :ref:`in_parallel<ta_in_parallel-name>` .
+
+time_out
+********
+The input value of this argument does not matter.
+Upon return it is the number of wall clock seconds
+for one zero order forward and one first order reverse calculation.
+
+test_time
+*********
+is the minimum amount of wall clock time that the test should take.
+The number of repeats will be increased until this time is reached.
+
+num_threads
+***********
+is the number of threads that are available for this test.
+If it is zero, the test is run without the multi-threading environment
+and ``parallel_for`` is not used.
+
+size
+****
+is the dimension *n* of the domain and range space for the function *f* .
+If *num_threads* is non-zero and *size* is greater than or equal 1024,
+the levels are large enough to be divided into tasks.
+In this case, the test checks that both the zero order forward
+and the first order reverse calculations call ``parallel_for`` .
+
+ok
+**
+If it is true, ``multi_level_time`` did not detect an error;
+e.g., the results with and without threading are the same.
+
+Source
+******
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end multi_level.cpp}
+*/
+// BEGIN C++
+# include <atomic>
+# include <cppad/cppad.hpp>
+# include "multi_level.hpp"
+# include "team_thread.hpp"
+
+namespace {
+    using CppAD::thread_alloc;
+    using CppAD::vector;
+    //
+    // the function that is evaluated, its argument, and its value
+    CppAD::ADFun<double>* fun_ = nullptr;
+    vector<double>*       x_   = nullptr;
+    vector<double>*       y_   = nullptr;
+    //
+    // the range space weights and the corresponding derivative
+    vector<double>*       w_   = nullptr;
+    vector<double>*       dw_  = nullptr;
+    //
+    // the tasks for the current call to parallel_for
+    size_t                n_task_ = 0;
+    void                  (*task_)(size_t i_task, void* info) = nullptr;
+    void*                 info_   = nullptr;
+    //
+    // index of the next task that has not been started
+    std::atomic<size_t>   next_task_;
+    //
+    // number of calls to parallel_for
+    size_t                n_parallel_for_ = 0;
+    // ------------------------------------------------------------------------
+    // worker: execute tasks until they have all been started
+    void worker(void)
+    {   size_t i_task = next_task_++;
+        while( i_task < n_task_ )
+        {   task_(i_task, info_);
+            i_task = next_task_++;
+        }
+    }
+    // ------------------------------------------------------------------------
+    // parallel_for: execute the tasks using the team of threads
+    void parallel_for(
+        size_t n_task, void (*task)(size_t i_task, void* info), void* info
+    )
+    {   ++n_parallel_for_;
+        n_task_    = n_task;
+        task_      = task;
+        info_      = info;
+        next_task_ = 0;
+        team_work(worker);
+    }
+    // ------------------------------------------------------------------------
+    // record f(x)
+    void record(CppAD::ADFun<double>& fun, size_t n)
+    {   using CppAD::AD;
+        vector< AD<double> > ax(n), ay(n);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = double(j + 1) / double(n);
+        CppAD::Independent(ax);
+        for(size_t i = 0; i < n; ++i)
+        {   size_t ip1 = (i + 1) % n;
+            ay[i] = exp( ax[i] ) * cos( ax[ip1] ) + ax[i] * ax[i];
+        }
+        fun.Dependent(ax, ay);
+    }
+    // ------------------------------------------------------------------------
+    // test_repeat: used by time_test
+    void test_repeat(size_t repeat)
+    {   for(size_t i_repeat = 0; i_repeat < repeat; ++i_repeat)
+        {   *y_  = fun_->Forward(0, *x_);
+            *dw_ = fun_->Reverse(1, *w_);
+        }
+    }
+}
+// This is the only routine that is accessible outside of this file
+bool multi_level_time(
+    double& time_out    ,
+    double  test_time   ,
+    size_t  num_threads ,
+    size_t  size        )
+{   bool ok = true;
+    //
+    size_t initial_inuse = thread_alloc::inuse(0);
+    //
+    // create team of threads
+    ok &= thread_alloc::in_parallel() == false;
+    if( num_threads > 0 )
+    {   team_create(num_threads);
+        ok &= num_threads == thread_alloc::num_threads();
+    }
+    else
+    {   ok &= 1 == thread_alloc::num_threads();
+    }
+    //
+    // fun_, x_, y_, w_, dw_
+    size_t n = size;
+    fun_     = new CppAD::ADFun<double>;
+    x_       = new vector<double>(n);
+    y_       = new vector<double>(n);
+    w_       = new vector<double>(n);
+    dw_      = new vector<double>(n);
+    record(*fun_, n);
+    for(size_t j = 0; j < n; ++j)
+    {   (*x_)[j] = double(j + 2) / double(n);
+        (*w_)[j] = 1.0;
+    }
+    //
+    // check, check_dw, y_, dw_
+    // results without using parallel_for
+    vector<double> check    = fun_->Forward(0, *x_);
+    vector<double> check_dw = fun_->Reverse(1, *w_);
+    if( num_threads > 0 )
+    {   fun_->parallel_for(parallel_for);
+        fun_->parallel_reverse("deterministic");
+    }
+    n_parallel_for_  = 0;
+    *y_              = fun_->Forward(0, *x_);
+    size_t n_forward = n_parallel_for_;
+    *dw_             = fun_->Reverse(1, *w_);
+    size_t n_reverse = n_parallel_for_ - n_forward;
+    if( num_threads > 0 && size >= 1024 )
+    {   ok &= n_forward > 0;
+        ok &= n_reverse > 0;
+    }
+    for(size_t i = 0; i < n; ++i)
+    {   ok &= (*y_)[i] == check[i];
+        ok &= (*dw_)[i] == check_dw[i];
+    }
+    //
+    // time_out
+    time_out = CppAD::time_test(test_repeat, test_time);
+    //
+    // free the memory used by this test
+    delete fun_;
+    delete x_;
+    delete y_;
+    delete w_;
+    delete dw_;
+    check.clear();
+    check_dw.clear();
+    //
+    // destroy team of threads
+    if( num_threads > 0 )
+        team_destroy();
+    ok &= thread_alloc::in_parallel() == false;
+    //
+    // check that no static variables in this file are holding onto memory
+    ok &= initial_inuse == thread_alloc::inuse(0);
+    //
+    return ok;
+}
+// END C++
@@ -0,0 +1,336 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin multi_scaling.cpp}
+
+Multi-Threading Scaling of Taping, Evaluation, and Sparsity
+###########################################################
+
+Syntax
+******
+
+| *ok* = ``multi_scaling_time`` (
+| |tab| *rate_out* , *memory_out* , *test_time* , *num_threads* , *size*
+| )
+
+Purpose
+*******
+This is a timing test that shows how CppAD scales with the number of threads.
+Each thread does the same amount of work, using its own ``ADFun<double>``
+object, so that the rate for each thread would stay constant if CppAD
+scaled perfectly.
+The work is split into the following phases which are timed separately:
+
+.. csv-table::
+    :widths: auto
+    :header-rows: 1
+
+    Index,Phase,Operation for one repeat
+    0,record,record the function below using ``Independent`` and ``Dependent``
+    1,forward,zero order :ref:`forward<forward_zero-name>`
+    2,reverse,first order :ref:`reverse<reverse_one-name>`
+    3,sparse,:ref:`sparse_jac_for<sparse_jac-name>` (reusing its work)
+
+The function :math:`f : \B{R}^n \rightarrow \B{R}^n` is
+
+.. math::
+
+    f_i (x) = \exp( x_i ) \cos( x_{i+1} ) + x_i x_i
+
+where :math:`x_n = x_0` , so that its Jacobian has two non-zeros per row.
+
+Thread
+******
+It is assumed that this function is called by thread zero in sequential
+mode; i.e., not :ref:`in_parallel<ta_in_parallel-name>` .
+
+rate_out
+********
+The input size and value of this vector does not matter.
+Upon return it has size four and *rate_out* [ *phase* ] is the number
+of repeats per second, for each thread, for the corresponding phase.
+The *efficiency* for a phase and a number of threads is this rate divided by
+the rate for the same phase when *num_threads* is zero.
+
+memory_out
+**********
+The input value of this argument does not matter.
+Upon return it is the maximum, with respect to the phases and threads,
+of the number of bytes that are :ref:`inuse<ta_inuse-name>` plus
+:ref:`available<ta_available-name>` for a thread at the end of a phase.
+If this grows with the number of threads, the memory allocator is holding
+extra memory for each thread.
+
+test_time
+*********
+is the minimum amount of wall clock time that the test for each phase
+should take.
+The number of repeats for a phase will be increased until this time
+is reached.
+
+num_threads
+***********
+is the number of threads that are available for this test.
+If it is zero, the test is run without the multi-threading environment and
+
+    1 == ``thread_alloc::num_threads`` ()
+
+If it is non-zero, the test is run with the multi-threading and
+
+    *num_threads* = ``thread_alloc::num_threads`` ()
+
+size
+****
+is the dimension *n* of the domain and range space for the function *f* .
+
+ok
+**
+If it is true, ``multi_scaling_time`` did not detect an error.
+
+Source
+******
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end multi_scaling.cpp}
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include "multi_scaling.hpp"
+# include "team_thread.hpp"
+
+namespace {
+    using CppAD::thread_alloc;
+    using CppAD::vector;
+    //
+    // number of phases
+    const size_t n_phase_ = 4;
+    //
+    // Number of threads, set by multi_scaling_time
+    // (zero means one thread with no multi-threading setup)
+    size_t num_threads_ = 0;
+    //
+    // size of the problem, set by multi_scaling_time
+    size_t size_ = 0;
+    //
+    // phase and number of repeats for the next call to worker
+    // (setup_phase_ and free_phase_ create and delete the objects below)
+    const size_t setup_phase_ = n_phase_;
+    const size_t free_phase_  = n_phase_ + 1;
+    size_t phase_  = 0;
+    size_t repeat_ = 0;
+    //
+    // structure with information for one thread
+    // (the objects are created and deleted by the corresponding thread)
+    typedef struct {
+        // the function, recorded by this thread
+        CppAD::ADFun<double>* fun;
+        //
+        // sparsity pattern for the Jacobian of fun
+        CppAD::sparse_rc< vector<size_t> >* pattern;
+        //
+        // subset of the Jacobian that is computed
+        CppAD::sparse_rcv< vector<size_t>, vector<double> >* subset;
+        //
+        // work used by sparse_jac_for
+        CppAD::sparse_jac_work* work;
+        //
+        // false if an error occurs, true otherwise, set by worker
+        bool ok;
+    } work_one_t;
+    //
+    // Vector with information for all threads
+    // (uses pointers instead of values to avoid false sharing)
+    work_one_t* work_all_[CPPAD_MAX_NUM_THREADS];
+    // ------------------------------------------------------------------------
+    // record f(x)
+    void record(CppAD::ADFun<double>& fun)
+    {   using CppAD::AD;
+        size_t n = size_;
+        vector< AD<double> > ax(n), ay(n);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = double(j + 1) / double(n);
+        CppAD::Independent(ax);
+        for(size_t i = 0; i < n; ++i)
+        {   size_t ip1 = (i + 1) % n;
+            ay[i] = exp( ax[i] ) * cos( ax[ip1] ) + ax[i] * ax[i];
+        }
+        fun.Dependent(ax, ay);
+    }
+    // ------------------------------------------------------------------------
+    // worker: repeat the current phase repeat_ times
+    void worker(void)
+    {   size_t thread_num  = thread_alloc::thread_num();
+        size_t num_threads = std::max(num_threads_, size_t(1));
+        bool   ok          = thread_num < num_threads;
+        if( ! ok )
+            return;
+        work_one_t* work_one = work_all_[thread_num];
+        size_t      n        = size_;
+        //
+        // create the objects for this thread
+        if( phase_ == setup_phase_ )
+        {   typedef CppAD::sparse_rc< vector<size_t> >  sparse_rc;
+            typedef CppAD::sparse_rcv< vector<size_t>, vector<double> >
+                sparse_rcv;
+            work_one->fun     = new CppAD::ADFun<double>;
+            work_one->pattern = new sparse_rc;
+            work_one->work    = new CppAD::sparse_jac_work;
+            record( *(work_one->fun) );
+            sparse_rc pattern_eye(n, n, n);
+            for(size_t k = 0; k < n; ++k)
+                pattern_eye.set(k, k, k);
+            work_one->fun->for_jac_sparsity(
+                pattern_eye, false, false, false, *(work_one->pattern)
+            );
+            work_one->subset  = new sparse_rcv( *(work_one->pattern) );
+            work_one->ok      = true;
+            return;
+        }
+        //
+        // delete the objects for this thread
+        if( phase_ == free_phase_ )
+        {   delete work_one->fun;
+            delete work_one->pattern;
+            delete work_one->subset;
+            delete work_one->work;
+            return;
+        }
+        //
+        vector<double> x(n), w(n), dw;
+        for(size_t j = 0; j < n; ++j)
+        {   x[j] = double(j + 2) / double(n);
+            w[j] = 1.0;
+        }
+        for(size_t i_repeat = 0; i_repeat < repeat_; ++i_repeat)
+        {   switch( phase_ )
+            {   case 0:
+                record( *(work_one->fun) );
+                ok &= work_one->fun->size_var() > n;
+                break;
+
+                case 1:
+                ok &= work_one->fun->Forward(0, x).size() == n;
+                break;
+
+                case 2:
+                dw  = work_one->fun->Reverse(1, w);
+                ok &= dw.size() == n;
+                break;
+
+                case 3:
+                work_one->fun->sparse_jac_for(
+                    1, x, *(work_one->subset), *(work_one->pattern),
+                    "cppad", *(work_one->work)
+                );
+                ok &= work_one->subset->nnz() == 2 * n;
+                break;
+
+                default:
+                ok = false;
+            }
+        }
+        work_one->ok &= ok;
+    }
+    // ------------------------------------------------------------------------
+    // run the worker for each thread
+    void run_worker(size_t phase, size_t repeat)
+    {   phase_  = phase;
+        repeat_ = repeat;
+        if( num_threads_ > 0 )
+            team_work(worker);
+        else
+            worker();
+    }
+    //
+    // test_repeat: used by time_test for the current phase
+    size_t time_phase_ = 0;
+    void test_repeat(size_t repeat)
+    {   run_worker(time_phase_, repeat); }
+}
+// This is the only routine that is accessible outside of this file
+bool multi_scaling_time(
+    vector<double>& rate_out    ,
+    size_t&         memory_out  ,
+    double          test_time   ,
+    size_t          num_threads ,
+    size_t          size        )
+{   bool ok = true;
+    //
+    // rate_out
+    // (before initial_inuse because it may allocate memory)
+    rate_out.resize(n_phase_);
+    //
+    size_t initial_inuse = thread_alloc::inuse(0);
+    //
+    // num_threads_, size_
+    num_threads_ = num_threads;
+    size_        = size;
+    //
+    // create team of threads
+    ok &= thread_alloc::in_parallel() == false;
+    if( num_threads > 0 )
+    {   team_create(num_threads);
+        ok &= num_threads == thread_alloc::num_threads();
+    }
+    else
+    {   ok &= 1 == thread_alloc::num_threads();
+    }
+    num_threads = std::max(num_threads, size_t(1));
+    //
+    // work_all_
+    for(size_t thread_num = 0; thread_num < num_threads; ++thread_num)
+    {   // allocate separate memory for each thread to avoid false sharing
+        size_t min_bytes(sizeof(work_one_t)), cap_bytes;
+        void* v_ptr = thread_alloc::get_memory(min_bytes, cap_bytes);
+        work_all_[thread_num]     = static_cast<work_one_t*>(v_ptr);
+        work_all_[thread_num]->ok = false;
+    }
+    run_worker(setup_phase_, 1);
+    //
+    // rate_out, memory_out
+    memory_out = 0;
+    for(size_t phase = 0; phase < n_phase_; ++phase)
+    {   time_phase_     = phase;
+        double time     = CppAD::time_test(test_repeat, test_time);
+        rate_out[phase] = 1.0 / time;
+        for(size_t thread_num = 0; thread_num < num_threads; ++thread_num)
+        {   size_t memory = thread_alloc::inuse(thread_num)
+                          + thread_alloc::available(thread_num);
+            memory_out = std::max(memory_out, memory);
+        }
+    }
+    //
+    // delete the objects for each thread
+    run_worker(free_phase_, 1);
+    //
+    // go down so that free memory for other threads before memory for master
+    size_t thread_num = num_threads;
+    while(thread_num--)
+    {   work_one_t* work_one = work_all_[thread_num];
+        ok &= work_one->ok;
+        thread_alloc::return_memory( static_cast<void*>(work_one) );
+        //
+        // check that there is no longer any memory inuse by this thread
+        if( thread_num > 0 )
+        {   ok &= 0 == thread_alloc::inuse(thread_num);
+            thread_alloc::free_available(thread_num);
+        }
+    }
+    //
+    // destroy team of threads
+    if( num_threads_ > 0 )
+        team_destroy();
+    ok &= thread_alloc::in_parallel() == false;
+    //
+    // check that no static variables in this file are holding onto memory
+    ok &= initial_inuse == thread_alloc::inuse(0);
+    //
+    return ok;
+}
+// END C++
@@ -0,0 +1,17 @@
+# ifndef CPPAD_EXAMPLE_MULTI_THREAD_MULTI_SCALING_HPP
+# define CPPAD_EXAMPLE_MULTI_THREAD_MULTI_SCALING_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+# include <cppad/utility/vector.hpp>
+
+bool multi_scaling_time(
+    CppAD::vector<double>& rate_out    ,
+    size_t&                memory_out  ,
+    double                 test_time   ,
+    size_t                 num_threads ,
+    size_t                 size
+);
+
+# endif
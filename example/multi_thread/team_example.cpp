@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 /*
@@ -17,6 +17,8 @@ Using a Team of AD Threads: Example and Test
 Purpose
 *******
 This example demonstrates how use a team of threads with CppAD.
+It also demonstrates that memory allocated by one thread can be returned
+by a different thread; see :ref:`ta_return_memory@Thread@Other Thread` .
 
 thread_team
 ***********
@@ -54,6 +56,8 @@ namespace {
         double          x;
         // false if an error occurs, true otherwise (worker output)
         bool            ok;
+        // memory allocated by this thread and returned by the next thread
+        void*           block;
     } work_one_t;
     // vector with information for all threads
     // (use pointers instead of values to avoid false sharing)
@@ -83,9 +87,25 @@ namespace {
         d_y    = f.Forward(1, d_x);
         ok    &= NearEqual(d_x[0], 1., eps, eps);
 
+        // allocate memory that is returned by a different thread
+        size_t min_bytes = 100 * sizeof(double), cap_bytes;
+        work_all_[thread_num]->block =
+            thread_alloc::get_memory(min_bytes, cap_bytes);
+
         // pass back ok information for this thread
         work_all_[thread_num]->ok = ok;
     }
+    // --------------------------------------------------------------------
+    // function that returns the memory allocated by the next thread
+    void worker_free(void)
+    {   size_t thread_num  = thread_alloc::thread_num();
+        size_t next        = (thread_num + 1) % NUMBER_THREADS;
+        void*  v_ptr       = work_all_[next]->block;
+        if( v_ptr != nullptr )
+        {   work_all_[next]->block = nullptr;
+            thread_alloc::return_memory(v_ptr);
+        }
+    }
 }
 
 // This test routine is only called by the master thread (thread_num = 0).
@@ -110,12 +130,15 @@ bool team_example(void)
         work_all_[thread_num]     = static_cast<work_one_t*>(v_ptr);
         // in case this thread's worker does not get called
         work_all_[thread_num]->ok = false;
+        // in case this thread's worker_free does not get called
+        work_all_[thread_num]->block = nullptr;
         // parameter that defines the work for this thread
         work_all_[thread_num]->x  = double(thread_num) + 1.;
     }
 
     ok &= team_create(num_threads);
     ok &= team_work(worker);
+    ok &= team_work(worker_free);
     ok &= team_destroy();
 
     // go down so that free memrory for other threads before memory for master
@@ -123,6 +146,9 @@ bool team_example(void)
     while(thread_num--)
     {   // check that this thread was ok with the work it did
         ok &= work_all_[thread_num]->ok;
+        // return memory that worker_free did not return
+        if( work_all_[thread_num]->block != nullptr )
+            thread_alloc::return_memory( work_all_[thread_num]->block );
         // delete problem specific information
         void* v_ptr = static_cast<void*>( work_all_[thread_num] );
         thread_alloc::return_memory( v_ptr );
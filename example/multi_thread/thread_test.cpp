@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 /*
@@ -59,8 +59,11 @@ you can execute the following commands:
 | ./ *program* ``chkpoint_two`` *test_time* *max_threads* *num_solve*
 | ./ *program* ``multi_newton`` *test_time* *max_threads*  \\
 | |tab| *num_zero* *num_sub* *num_sum* *use_ad*
+| ./ *program* ``scaling`` *test_time* *max_threads* *size*
+| ./ *program* ``level`` *test_time* *max_threads* *size*
+| ./ *program* ``chkpoint_batch`` *test_time* *max_threads* *size*
 
-We refer to the values ``a11c`` , ... , ``multi_newton``
+We refer to the values ``a11c`` , ... , ``chkpoint_batch``
 as the *test_case* below.
 {xrst_toc_hidden
     example/multi_thread/openmp/a11c_openmp.cpp
@@ -76,6 +79,9 @@ as the *test_case* below.
     example/multi_thread/multi_atomic_three.xrst
     example/multi_thread/multi_chkpoint_two.xrst
     example/multi_thread/multi_newton.xrst
+    example/multi_thread/multi_scaling.cpp
+    example/multi_thread/multi_level.cpp
+    example/multi_thread/multi_chkpoint_batch.cpp
     example/multi_thread/team_thread.hpp
 }
 
@@ -206,6 +212,62 @@ The command line argument *use_ad* is either
 
 {xrst_comment -------------------------------------------------------------- }
 
+scaling
+*******
+The *test_case* ``scaling`` runs the
+:ref:`multi_scaling.cpp-name` timing test.
+This measures the rate, for each thread, of recording, zero order forward,
+first order reverse and sparse Jacobian calculations
+where each thread does the same amount of work.
+The output ``rate_all`` has one row for each number of threads
+and one column for each phase.
+The output ``efficiency_all`` is ``rate_all`` divided by
+its first row (no threading); i.e., it is one if CppAD scales perfectly.
+The output ``memory_all`` is the corresponding
+:ref:`multi_scaling.cpp@memory_out` for each number of threads.
+
+size
+====
+The command line argument *size*
+is an integer greater than or equal two and has the same meaning as in
+:ref:`multi_scaling.cpp@size` .
+
+{xrst_comment -------------------------------------------------------------- }
+
+level
+*****
+The *test_case* ``level`` runs the
+:ref:`multi_level.cpp-name` timing test.
+This measures the time for one zero order forward and one
+first order reverse calculation
+where a single function object uses the team of threads to
+evaluate its operations; see :ref:`fun_parallel_for-name` .
+
+size
+====
+The command line argument *size*
+is an integer greater than or equal two and has the same meaning as in
+:ref:`multi_level.cpp@size` .
+
+{xrst_comment -------------------------------------------------------------- }
+
+chkpoint_batch
+**************
+The *test_case* ``chkpoint_batch`` runs the
+:ref:`multi_chkpoint_batch.cpp-name` timing test.
+This measures the time for one zero order forward and one first order
+reverse calculation where the independent calls to a ``chkpoint_two``
+function are evaluated by the team of threads;
+see :ref:`chkpoint_two_parallel_for-name` .
+
+size
+====
+The command line argument *size*
+is an integer greater than or equal two and has the same meaning as in
+:ref:`multi_chkpoint_batch.cpp@size` .
+
+{xrst_comment -------------------------------------------------------------- }
+
 Team Implementations
 ********************
 The following routines are used to implement the specific threading
@@ -242,6 +304,9 @@ Source
 # include "multi_chkpoint_one.hpp"
 # include "multi_chkpoint_two.hpp"
 # include "multi_newton.hpp"
+# include "multi_scaling.hpp"
+# include "multi_level.hpp"
+# include "multi_chkpoint_batch.hpp"
 
 extern bool a11c(void);
 extern bool get_started(void);
@@ -269,6 +334,66 @@ namespace {
         std::cerr << error_msg << std::endl;
         exit(1);
     }
+    // run the scaling test for each number of threads
+    // and return the exit status for the program
+    int scaling_test(double test_time, size_t max_threads, size_t size)
+    {   using std::cout;
+        using std::endl;
+        bool ok = true;
+        CppAD::vector<double> rate_out;
+        CppAD::vector< CppAD::vector<double> > rate_all(max_threads + 1);
+        CppAD::vector<size_t> memory_all(max_threads + 1);
+        for(size_t num_threads = 0; num_threads <= max_threads; num_threads++)
+        {   ok &= multi_scaling_time(
+                rate_out, memory_all[num_threads],
+                test_time, num_threads, size
+            );
+            rate_all[num_threads] = rate_out;
+        }
+        const char* name[] = { "rate_all", "efficiency_all" };
+        for(size_t i_name = 0; i_name < 2; ++i_name)
+        {   cout << name[i_name] << " = [" << endl;
+            cout << "%" << std::setw(15) << "record";
+            cout << std::setw(16) << "forward";
+            cout << std::setw(16) << "reverse";
+            cout << std::setw(16) << "sparse" << endl;
+            for(size_t n_thread = 0; n_thread <= max_threads; ++n_thread)
+            {   for(size_t phase = 0; phase < rate_out.size(); ++phase)
+                {   double value = rate_all[n_thread][phase];
+                    if( i_name == 1 )
+                        value /= rate_all[0][phase];
+                    cout << std::setw(16) << value;
+                }
+                if( n_thread == 0 )
+                    cout << " % no threading" << endl;
+                else
+                    cout << " % " << n_thread << " threads" << endl;
+            }
+            cout << "];" << endl;
+        }
+        cout << "memory_all = [";
+        for(size_t num_threads = 0; num_threads <= max_threads; ++num_threads)
+        {   if( num_threads > 0 )
+                cout << ", ";
+            cout << memory_all[num_threads];
+        }
+        cout << "];" << endl;
+        rate_all.clear();
+        rate_out.clear();
+        memory_all.clear();
+        //
+        if( CppAD::thread_alloc::free_all() )
+            cout << "free_all      = true;"  << endl;
+        else
+        {   ok = false;
+            cout << "free_all      = false;" << endl;
+        }
+        if( ok )
+            cout << "OK            = true;"  << endl;
+        else cout << "OK            = false;" << endl;
+        //
+        return ! ok;
+    }
 }
 
 int main(int argc, char *argv[])
@@ -288,7 +413,10 @@ int main(int argc, char *argv[])
     "./<program> chkpoint_one test_time max_threads num_solve\n"
     "./<program> chkpoint_two test_time max_threads num_solve\n"
     "./<program> multi_newton test_time max_threads \\\n"
-    "   num_zero num_sub num_sum use_ad\\\n"
+    "   num_zero num_sub num_sum use_ad\n"
+    "./<program> scaling      test_time max_threads size\n"
+    "./<program> level        test_time max_threads size\n"
+    "./<program> chkpoint_batch test_time max_threads size\n"
     "where <program> is example_multi_thread_<threading>\n"
     "and <threading> is openmp, bthread, pthread, or sthread";
 
@@ -331,13 +459,19 @@ int main(int argc, char *argv[])
     bool run_chkpoint_one = std::strcmp(test_name, "chkpoint_one")     == 0;
     bool run_chkpoint_two = std::strcmp(test_name, "chkpoint_two")     == 0;
     bool run_multi_newton = std::strcmp(test_name, "multi_newton")     == 0;
+    bool run_scaling      = std::strcmp(test_name, "scaling")          == 0;
+    bool run_level        = std::strcmp(test_name, "level")            == 0;
+    bool run_chkpoint_batch = std::strcmp(test_name, "chkpoint_batch") == 0;
     if( run_a11c || run_get_started || run_team_example )
         ok = (argc == 2);
     else if( run_harmonic
     || run_atomic_two
     || run_atomic_three
     || run_chkpoint_one
-    || run_chkpoint_two )
+    || run_chkpoint_two
+    || run_scaling
+    || run_level
+    || run_chkpoint_batch )
         ok = (argc == 5);
     else if( run_multi_newton )
         ok = (argc == 8);
@@ -378,6 +512,7 @@ int main(int argc, char *argv[])
 
     size_t mega_sum  = 0; // assignment to avoid compiler warning
     size_t num_solve = 0;
+    size_t size      = 0;
     if( run_harmonic )
     {   // mega_sum
         mega_sum = arg2size_t( *++argv, 1,
@@ -393,6 +528,12 @@ int main(int argc, char *argv[])
             "run: num_solve is less than one"
         );
     }
+    else if( run_scaling || run_level || run_chkpoint_batch )
+    {   // size
+        size = arg2size_t( *++argv, 2,
+            "run: size is less than two"
+        );
+    }
     else
     {   ok &= run_multi_newton;
         if( ! ok )
@@ -428,6 +569,10 @@ int main(int argc, char *argv[])
         }
     }
 
+    // the scaling test has its own output format
+    if( run_scaling )
+        return scaling_test(test_time, max_threads, size);
+
     // run the test for each number of threads
     cout << "time_all  = [" << endl;
     for(size_t num_threads = 0; num_threads <= max_threads; num_threads++)
@@ -450,6 +595,12 @@ int main(int argc, char *argv[])
         else if( run_chkpoint_two ) this_ok = multi_chkpoint_two_time(
             time_out, test_time, num_threads, num_solve
         );
+        else if( run_level ) this_ok = multi_level_time(
+            time_out, test_time, num_threads, size
+        );
+        else if( run_chkpoint_batch ) this_ok = multi_chkpoint_batch_time(
+            time_out, test_time, num_threads, size
+        );
         else
         {   assert( run_multi_newton);
             this_ok = multi_newton_time(
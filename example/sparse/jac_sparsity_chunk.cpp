@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin jac_sparsity_chunk.cpp}
+
+Jacobian Sparsity for Chunks of the Seeds: Example and Test
+###########################################################
+The chunks in this example are computed one after the other.
+Each chunk could instead be computed by a different thread.
+
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end jac_sparsity_chunk.cpp}
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+bool jac_sparsity_chunk(void)
+{   bool ok = true;
+    using CppAD::AD;
+    typedef CPPAD_TESTVECTOR(size_t)     SizeVector;
+    typedef CppAD::sparse_rc<SizeVector> sparsity;
+    //
+    // domain space vector
+    // (n is greater than the number of bits in one packed unit)
+    size_t n = 70;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+
+    // declare independent variables and start recording
+    CppAD::Independent(ax);
+
+    // range space vector
+    // y_i = x_i * x_{i+1} for i < n-1 and y_{n-1} = sin( x_{n-1} )
+    size_t m = n;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    for(size_t i = 0; i < n - 1; ++i)
+        ay[i] = ax[i] * ax[i+1];
+    ay[n-1] = sin( ax[n-1] );
+
+    // create f: x -> y and stop tape recording
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // the chunks of the seed indices (the last chunk is not full)
+    size_t chunk_size = 30;
+    //
+    for(size_t icase = 0; icase < 4; ++icase)
+    {   bool transpose     = (icase % 2) == 1;
+        bool internal_bool = (icase / 2) == 1;
+        bool dependency    = false;
+        //
+        // pattern_in: sparsity pattern for the identity matrix
+        // (or its transpose, which is the same)
+        sparsity pattern_in(n, n, n);
+        for(size_t k = 0; k < n; ++k)
+            pattern_in.set(k, k, k);
+        //
+        // for_full, rev_full: sparsity for all the seeds
+        sparsity for_full, rev_full;
+        f.for_jac_sparsity(
+            pattern_in, transpose, dependency, internal_bool, for_full
+        );
+        f.rev_jac_sparsity(
+            pattern_in, transpose, dependency, internal_bool, rev_full
+        );
+        //
+        // for_merge, rev_merge: merge of the sparsity for each chunk
+        sparsity for_merge(for_full.nr(), for_full.nc(), 0);
+        sparsity rev_merge(rev_full.nr(), rev_full.nc(), 0);
+        for(size_t chunk_begin = 0; chunk_begin < n; chunk_begin += chunk_size)
+        {   size_t chunk_end = std::min(chunk_begin + chunk_size, n);
+            //
+            // for_chunk, rev_chunk
+            sparsity for_chunk, rev_chunk;
+            f.for_jac_sparsity_chunk(
+                pattern_in, transpose, dependency, internal_bool,
+                chunk_begin, chunk_end, for_chunk
+            );
+            f.rev_jac_sparsity_chunk(
+                pattern_in, transpose, dependency, internal_bool,
+                chunk_begin, chunk_end, rev_chunk
+            );
+            ok &= for_chunk.nr() == for_full.nr();
+            ok &= for_chunk.nc() == for_full.nc();
+            ok &= rev_chunk.nr() == rev_full.nr();
+            ok &= rev_chunk.nc() == rev_full.nc();
+            //
+            // for_merge
+            for(size_t k = 0; k < for_chunk.nnz(); ++k)
+            {   size_t r = for_chunk.row()[k];
+                size_t c = for_chunk.col()[k];
+                // the forward mode seeds are the columns of F'(x)
+                size_t seed = transpose ? r : c;
+                ok &= chunk_begin <= seed && seed < chunk_end;
+                for_merge.push_back(r, c);
+            }
+            //
+            // rev_merge
+            for(size_t k = 0; k < rev_chunk.nnz(); ++k)
+            {   size_t r = rev_chunk.row()[k];
+                size_t c = rev_chunk.col()[k];
+                // the reverse mode seeds are the rows of F'(x)
+                size_t seed = transpose ? c : r;
+                ok &= chunk_begin <= seed && seed < chunk_end;
+                rev_merge.push_back(r, c);
+            }
+        }
+        //
+        // check that the merged patterns are equal to the full patterns
+        ok &= for_merge.nnz() == for_full.nnz();
+        ok &= rev_merge.nnz() == rev_full.nnz();
+        SizeVector for_full_order  = for_full.row_major();
+        SizeVector for_merge_order = for_merge.row_major();
+        for(size_t k = 0; k < for_full.nnz(); ++k)
+        {   size_t k_full  = for_full_order[k];
+            size_t k_merge = for_merge_order[k];
+            ok &= for_full.row()[k_full] == for_merge.row()[k_merge];
+            ok &= for_full.col()[k_full] == for_merge.col()[k_merge];
+        }
+        SizeVector rev_full_order  = rev_full.row_major();
+        SizeVector rev_merge_order = rev_merge.row_major();
+        for(size_t k = 0; k < rev_full.nnz(); ++k)
+        {   size_t k_full  = rev_full_order[k];
+            size_t k_merge = rev_merge_order[k];
+            ok &= rev_full.row()[k_full] == rev_merge.row()[k_merge];
+            ok &= rev_full.col()[k_full] == rev_merge.col()[k_merge];
+        }
+        //
+        // the Jacobian has 2 * (n-1) + 1 possibly non-zero entries
+        ok &= for_full.nnz() == 2 * (n - 1) + 1;
+        ok &= rev_full.nnz() == 2 * (n - 1) + 1;
+    }
+    return ok;
+}
+// END C++
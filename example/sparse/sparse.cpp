@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin sparse.cpp}
@@ -52,6 +52,7 @@ extern bool dependency(void);
 extern bool for_hes_sparsity(void);
 extern bool for_jac_sparsity(void);
 extern bool for_sparse_hes(void);
+extern bool jac_sparsity_chunk(void);
 extern bool rc_sparsity(void);
 extern bool rev_hes_sparsity(void);
 extern bool rev_jac_sparsity(void);
@@ -63,6 +64,7 @@ extern bool sparse_jac_for(void);
 extern bool sparse_jac_rev(void);
 extern bool sparse_jacobian(void);
 extern bool sparse_sub_hes(void);
+extern bool sparsity_cache(void);
 extern bool sparsity_sub(void);
 extern bool sub_sparse_hes(void);
 extern bool subgraph_hes2jac(void);
@@ -88,6 +90,7 @@ int main(void)
     Run( for_hes_sparsity,          "for_hes_sparsity" );
     Run( for_jac_sparsity,          "for_jac_sparsity" );
     Run( for_sparse_hes,            "for_sparse_hes" );
+    Run( jac_sparsity_chunk,        "jac_sparsity_chunk" );
     Run( rc_sparsity,               "rc_sparsity" );
     Run( rev_hes_sparsity,          "rev_hes_sparsity" );
     Run( rev_jac_sparsity,          "rev_jac_sparsity" );
@@ -98,6 +101,7 @@ int main(void)
     Run( sparse_jac_rev,            "sparse_jac_rev" );
     Run( sparse_jacobian,           "sparse_jacobian" );
     Run( sparse_sub_hes,            "sparse_sub_hes" );
+    Run( sparsity_cache,            "sparsity_cache" );
     Run( sparsity_sub,              "sparsity_sub" );
     Run( sub_sparse_hes,            "sub_sparse_hes" );
     Run( subgraph_hes2jac,          "subgraph_hes2jac" );
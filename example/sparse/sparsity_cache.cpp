@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin sparsity_cache.cpp}
+
+Caching Sparsity Patterns: Example and Test
+###########################################
+
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end sparsity_cache.cpp}
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+bool sparsity_cache(void)
+{   bool ok = true;
+    using CppAD::AD;
+    typedef CPPAD_TESTVECTOR(size_t)     SizeVector;
+    typedef CPPAD_TESTVECTOR(bool)       BoolVector;
+    typedef CppAD::sparse_rc<SizeVector> sparsity;
+    //
+    // dynamic parameter vector
+    size_t np = 1;
+    CPPAD_TESTVECTOR(AD<double>) ap(np);
+    ap[0] = 2.0;
+    //
+    // domain space vector
+    size_t n = 3;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+
+    // declare independent variables and start recording
+    size_t abort_op_index = 0;
+    bool   record_compare = true;
+    CppAD::Independent(ax, abort_op_index, record_compare, ap);
+
+    // range space vector
+    size_t m = 2;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    ay[0] = ap[0] * ax[0] * ax[1];
+    ay[1] = ax[1] + ax[2] * ax[2];
+
+    // create f: x -> y and stop tape recording
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // use the cache
+    ok &= f.sparsity_cache() == false;
+    f.sparsity_cache(true);
+    ok &= f.sparsity_cache() == true;
+    //
+    // pattern_in: sparsity pattern for the identity matrix
+    sparsity pattern_in(n, n, n);
+    for(size_t k = 0; k < n; ++k)
+        pattern_in.set(k, k, k);
+    //
+    // select_domain, select_range
+    BoolVector select_domain(n), select_range(m);
+    for(size_t j = 0; j < n; ++j)
+        select_domain[j] = true;
+    for(size_t i = 0; i < m; ++i)
+        select_range[i] = true;
+    //
+    bool transpose     = false;
+    bool dependency    = false;
+    bool internal_bool = false;
+    //
+    // jac_pattern, hes_pattern, sub_pattern
+    sparsity jac_pattern, hes_pattern, sub_pattern;
+    for(size_t repeat = 0; repeat < 3; ++repeat)
+    {   // change the dynamic parameters
+        // (does not change the sparsity patterns)
+        CPPAD_TESTVECTOR(double) p(np);
+        p[0] = double(repeat + 3);
+        f.new_dynamic(p);
+        //
+        f.for_jac_sparsity(
+            pattern_in, transpose, dependency, internal_bool, jac_pattern
+        );
+        f.rev_hes_sparsity(
+            select_range, transpose, internal_bool, hes_pattern
+        );
+        f.subgraph_sparsity(
+            select_domain, select_range, transpose, sub_pattern
+        );
+        //
+        // only the first repeat computes the patterns
+        ok &= f.sparsity_cache_miss() == 3;
+        ok &= f.sparsity_cache_hit()  == 3 * repeat;
+        //
+        // the patterns are the same for every repeat
+        ok &= jac_pattern.nnz() == 4;
+        ok &= hes_pattern.nnz() == 3;
+        ok &= sub_pattern.nnz() == 4;
+    }
+    //
+    // different arguments are a different key
+    sparsity pattern_out;
+    transpose = true;
+    f.for_jac_sparsity(
+        pattern_in, transpose, dependency, internal_bool, pattern_out
+    );
+    ok &= f.sparsity_cache_miss() == 4;
+    ok &= f.sparsity_cache_hit()  == 6;
+    ok &= pattern_out.nr() == n && pattern_out.nc() == m;
+    //
+    // changing the operation sequence removes all the patterns from the cache
+    f.optimize();
+    transpose = false;
+    f.subgraph_sparsity(
+        select_domain, select_range, transpose, pattern_out
+    );
+    ok &= f.sparsity_cache_miss() == 5;
+    ok &= f.sparsity_cache_hit()  == 6;
+    ok &= pattern_out.nnz() == sub_pattern.nnz();
+    //
+    // turning off the cache sets the counters to zero
+    f.sparsity_cache(false);
+    ok &= f.sparsity_cache_miss() == 0;
+    ok &= f.sparsity_cache_hit()  == 0;
+    //
+    return ok;
+}
+// END C++
@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin rosen_34_sparse.cpp}
+
+rosen_34_sparse: Example and Test
+#################################
+
+Define :math:`F : \B{R} \times \B{R}^n \rightarrow \B{R}^n` by
+
+.. math::
+
+    F_i (t, x) = \kappa ( x_{i-1} - 2 x_i + x_{i+1} ) - x_i^2 + (i + 1) t
+
+for :math:`i = 0 , \ldots , n-1` where :math:`x_{-1} = x_{n-1}`
+and :math:`x_n = x_0` (periodic boundary conditions).
+The Jacobian :math:`\partial_x F(t, x)` is sparse, but its LU factorization
+has some fill in (because of the periodic boundary conditions).
+The differential equation :math:`X'(t) = F[t, X(t)]` is stiff
+when :math:`\kappa` is large.
+This example computes the Jacobian using :ref:`sparse_jac_for-name`
+with a sparsity pattern computed by :ref:`for_jac_sparsity-name` .
+It checks that :ref:`Rosen34Sparse-name` gives the same result as
+:ref:`Rosen34-name` (which uses a dense Jacobian).
+
+{xrst_literal
+    // BEGIN C++
+    // END C++
+}
+
+{xrst_end rosen_34_sparse.cpp}
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+namespace {
+    typedef CPPAD_TESTVECTOR(size_t)              s_vector;
+    typedef CPPAD_TESTVECTOR(double)              d_vector;
+    typedef CppAD::sparse_rc<s_vector>            sparsity;
+    typedef CppAD::sparse_rcv<s_vector, d_vector> sparse_matrix;
+    //
+    // kappa * ( x_{i-1} - 2 x_i + x_{i+1} ) - x_i^2
+    template <class Scalar>
+    void diffusion(
+        double                         kappa ,
+        const CPPAD_TESTVECTOR(Scalar)& x    ,
+        CPPAD_TESTVECTOR(Scalar)&       f    )
+    {   size_t n = x.size();
+        for(size_t i = 0; i < n; i++)
+        {   size_t im = (i + n - 1) % n;
+            size_t ip = (i + 1) % n;
+            f[i] = kappa * ( x[im] - 2.0 * x[i] + x[ip] ) - x[i] * x[i];
+        }
+    }
+    class Fun {
+    private:
+        const double          kappa_;
+        CppAD::ADFun<double>  g_;       // g(x) = F(t, x) - t * f_t
+        sparsity              pattern_; // sparsity pattern for g_x
+        CppAD::sparse_jac_work work_;   // reused by every sparse_jac_for
+    public:
+        // constructor
+        Fun(size_t n, double kappa) : kappa_(kappa)
+        {   // record g(x)
+            CPPAD_TESTVECTOR( CppAD::AD<double> ) ax(n), ag(n);
+            for(size_t i = 0; i < n; i++)
+                ax[i] = 0.0;
+            CppAD::Independent(ax);
+            diffusion(kappa_, ax, ag);
+            g_.Dependent(ax, ag);
+            //
+            // pattern_
+            sparsity identity(n, n, n);
+            for(size_t k = 0; k < n; k++)
+                identity.set(k, k, k);
+            bool transpose     = false;
+            bool dependency    = false;
+            bool internal_bool = true;
+            g_.for_jac_sparsity(
+                identity, transpose, dependency, internal_bool, pattern_
+            );
+        }
+        // sparsity pattern for F_x
+        const sparsity& pattern(void) const
+        {   return pattern_; }
+        //
+        // F(t, x)
+        void Ode(const double& t, const d_vector& x, d_vector& f)
+        {   diffusion(kappa_, x, f);
+            for(size_t i = 0; i < x.size(); i++)
+                f[i] += double(i + 1) * t;
+        }
+        // partial of F(t, x) w.r.t. t
+        void Ode_ind(const double& /* t */, const d_vector& x, d_vector& f_t)
+        {   for(size_t i = 0; i < x.size(); i++)
+                f_t[i] = double(i + 1);
+        }
+        // partial of F(t, x) w.r.t. x as sparse matrix (used by Rosen34Sparse)
+        void Ode_dep(
+            const double& /* t */, const d_vector& x, sparse_matrix& f_x
+        )
+        {   size_t      group_max = 1;
+            std::string coloring  = "cppad";
+            g_.sparse_jac_for(group_max, x, f_x, pattern_, coloring, work_);
+        }
+        // partial of F(t, x) w.r.t. x as a dense matrix (used by Rosen34)
+        void Ode_dep(const double& /* t */, const d_vector& x, d_vector& f_x)
+        {   f_x = g_.Jacobian(x);
+        }
+    };
+}
+
+bool rosen_34_sparse(void)
+{   bool ok = true;     // initial return value
+
+    using CppAD::NearEqual;
+    double eps = 1e3 * std::numeric_limits<double>::epsilon();
+
+    size_t n     = 50;      // number components in X(t)
+    size_t M     = 20;      // number of steps in [ti, tf]
+    double ti    = 0.;      // initial time
+    double tf    = 1.;      // final time
+    double kappa = 1e3;     // makes the ODE stiff
+
+    // xi = X(0)
+    d_vector xi(n);
+    for(size_t i = 0; i < n; i++)
+        xi[i] = double(i % 5) / 4.0;
+
+    // function object
+    Fun F(n, kappa);
+
+    // there are three non-zeros in each row of the Jacobian
+    ok &= F.pattern().nnz() == 3 * n;
+
+    // Rosen34Sparse approximation for X(tf)
+    d_vector xf(n), e(n);
+    xf = CppAD::Rosen34Sparse(F, M, ti, tf, xi, F.pattern(), e);
+
+    // Rosen34 approximation for X(tf)
+    d_vector xf_dense(n), e_dense(n);
+    xf_dense = CppAD::Rosen34(F, M, ti, tf, xi, e_dense);
+
+    for(size_t i = 0; i < n; i++)
+    {   ok &= NearEqual(xf[i], xf_dense[i], eps, eps);
+        ok &= NearEqual(e[i], e_dense[i], eps, eps);
+    }
+    return ok;
+}
+
+// END C++
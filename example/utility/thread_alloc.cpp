@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 /*
@@ -149,6 +149,125 @@ bool type_allocate(void)
     return ok;
 }
 
+bool check_block_count(void)
+{   bool ok = true;
+    using CppAD::thread_alloc;
+    size_t thread = thread_alloc::thread_num();
+    ok &= thread_alloc::free_all();
+
+    // allocate three blocks with the same capacity and one larger block
+    size_t min_bytes = 10 * sizeof(double);
+    size_t cap_small, cap_large;
+    void* v_ptr[4];
+    for(size_t j = 0; j < 3; ++j)
+        v_ptr[j] = thread_alloc::get_memory(min_bytes, cap_small);
+    v_ptr[3] = thread_alloc::get_memory(2 * cap_small, cap_large);
+
+    // return one of the small blocks
+    thread_alloc::return_memory(v_ptr[0]);
+
+    // block counts for each capacity
+    std::vector<size_t> capacity, num_inuse, num_available;
+    thread_alloc::block_count(thread, capacity, num_inuse, num_available);
+    ok &= capacity.size() == 2;
+    ok &= num_inuse.size() == 2;
+    ok &= num_available.size() == 2;
+    if( ! ok )
+        return ok;
+    ok &= capacity[0] == cap_small;
+    ok &= capacity[1] == cap_large;
+    ok &= num_inuse[0] == 2;
+    ok &= num_inuse[1] == 1;
+    ok &= num_available[0] == 1;
+    ok &= num_available[1] == 0;
+
+    // the totals agree with inuse and available
+    size_t sum_inuse     = 0;
+    size_t sum_available = 0;
+    for(size_t k = 0; k < capacity.size(); ++k)
+    {   sum_inuse     += capacity[k] * num_inuse[k];
+        sum_available += capacity[k] * num_available[k];
+    }
+    ok &= thread_alloc::inuse(thread) == sum_inuse;
+    ok &= thread_alloc::available(thread) == sum_available;
+
+    // return the rest of the memory
+    for(size_t j = 1; j < 4; ++j)
+        thread_alloc::return_memory(v_ptr[j]);
+    thread_alloc::free_available(thread);
+    thread_alloc::block_count(thread, capacity, num_inuse, num_available);
+    ok &= capacity.size() == 0;
+
+    // check that the tests have not held onto memory
+    ok &= thread_alloc::free_all();
+
+    return ok;
+}
+
+bool check_mmap(void)
+{   bool ok = true;
+    using CppAD::thread_alloc;
+    size_t thread = thread_alloc::thread_num();
+    ok &= thread_alloc::free_all();
+
+    // blocks with capacity greater than or equal two megabytes
+    // are obtained directly from the operating system (if possible)
+    size_t mmap_bytes = size_t(1) << 21;
+    thread_alloc::mmap_bytes(mmap_bytes);
+
+    // allocate one large block and one small block
+    size_t n_double  = 2 * mmap_bytes / sizeof(double);
+    size_t min_bytes = n_double * sizeof(double);
+    size_t cap_large, cap_small;
+    void* v_large = thread_alloc::get_memory(min_bytes, cap_large);
+    void* v_small = thread_alloc::get_memory(sizeof(double), cap_small);
+    ok &= mmap_bytes <= cap_large;
+    ok &= cap_small < mmap_bytes;
+
+    // use the large block
+    double* large = reinterpret_cast<double*>(v_large);
+    for(size_t i = 0; i < n_double; ++i)
+        large[i] = double(i);
+    for(size_t i = 0; i < n_double; ++i)
+        ok &= large[i] == double(i);
+
+    // hold onto the memory when it is returned
+    thread_alloc::return_memory(v_large);
+    thread_alloc::return_memory(v_small);
+    ok &= thread_alloc::inuse(thread) == 0;
+    ok &= thread_alloc::available(thread) == cap_large + cap_small;
+
+    // get the large block back from the available pool
+    void* v_again = thread_alloc::get_memory(cap_large, cap_large);
+    ok &= v_again == v_large;
+    thread_alloc::return_memory(v_again);
+
+    // return all the memory to the system
+    thread_alloc::free_available(thread);
+    ok &= thread_alloc::free_all();
+
+    // change the setting while a block allocated using mmap is in use
+    // (it is still returned to the system using munmap)
+    v_large = thread_alloc::get_memory(min_bytes, cap_large);
+    thread_alloc::mmap_bytes(0);
+    thread_alloc::return_memory(v_large);
+    thread_alloc::free_available(thread);
+    ok &= thread_alloc::free_all();
+
+    // change the setting while a block not allocated using mmap is in use
+    // (it is still returned to the system using operator delete)
+    v_large = thread_alloc::get_memory(min_bytes, cap_large);
+    thread_alloc::mmap_bytes(mmap_bytes);
+    thread_alloc::return_memory(v_large);
+    thread_alloc::free_available(thread);
+    ok &= thread_alloc::free_all();
+
+    // return to the default setting (do not use mmap)
+    thread_alloc::mmap_bytes(0);
+
+    return ok;
+}
+
 } // End empty namespace
 
 bool check_alignment(void)
@@ -221,6 +340,12 @@ bool thread_alloc(void)
     // check alignment
     ok &= check_alignment();
 
+    // check block counts for each capacity
+    ok &= check_block_count();
+
+    // check allocation of large blocks using mmap
+    ok &= check_mmap();
+
     // return allocator to its default mode
     thread_alloc::hold_memory(false);
     return ok;
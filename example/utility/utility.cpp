@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin utility.cpp}
@@ -58,6 +58,7 @@ extern bool nan(void);
 extern bool poly(void);
 extern bool pow_int(void);
 extern bool rosen_34(void);
+extern bool rosen_34_sparse(void);
 extern bool runge_45(void);
 extern bool runge_45_1(void);
 extern bool set_union(void);
@@ -97,6 +98,7 @@ int main(void)
     Run( poly,                   "poly" );
     Run( pow_int,                "pow_int" );
     Run( rosen_34,               "rosen_34" );
+    Run( rosen_34_sparse,        "rosen_34_sparse" );
     Run( runge_45,               "runge_45" );
     Run( runge_45_1,             "runge_45_1" );
     Run( set_union,              "set_union" );
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_ABS_NORMAL_FUN_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin abs_normal_fun}
@@ -368,6 +368,11 @@ void ADFun<Base,RecBase>::abs_normal_fun(ADFun& g, ADFun& a) const
             f_abs_res.push_back( i_var );
             break;
 
+            // cumulative summation operator
+            case CSumOp:
+            itr.correct_before_increment();
+            break;
+
             default:
             break;
         }
@@ -672,6 +677,25 @@ void ADFun<Base,RecBase>::abs_normal_fun(ADFun& g, ADFun& a) const
             f2g_var[i_var] = rec.PutOp(op);
             break;
 
+            // ---------------------------------------------------
+            // Cumulative summation operator
+            case CSumOp:
+            CPPAD_ASSERT_UNKNOWN( NumRes(op) == 1 );
+            // parameter index and end of each part of the arguments
+            for(addr_t i = 0; i < 5; ++i)
+                rec.PutArg( arg[i] );
+            // addition and subtraction variables
+            for(addr_t i = 5; i < arg[2]; ++i)
+            {   CPPAD_ASSERT_UNKNOWN( size_t(f2g_var[arg[i]]) < num_var );
+                rec.PutArg( f2g_var[ arg[i] ] );
+            }
+            // dynamic parameters and total number of arguments
+            for(addr_t i = arg[2]; i <= arg[4]; ++i)
+                rec.PutArg( arg[i] );
+            f2g_var[i_var] = rec.PutOp(op);
+            itr.correct_before_increment();
+            break;
+
             // --------------------------------------------------
             // Operators with no arguments and no results
             case EndOp:
@@ -943,6 +967,7 @@ void ADFun<Base,RecBase>::abs_normal_fun(ADFun& g, ADFun& a) const
     // (the results are no longer valid)
     g.for_jac_sparse_pack_.resize(0, 0);
     g.for_jac_sparse_set_.resize(0, 0);
+    g.sparsity_cache_.clear();
 
     // free taylor coefficient memory
     g.taylor_.clear();
@@ -980,6 +1005,7 @@ void ADFun<Base,RecBase>::abs_normal_fun(ADFun& g, ADFun& a) const
     // (the results are no longer valid)
     a.for_jac_sparse_pack_.resize(0, 0);
     a.for_jac_sparse_set_.resize(0, 0);
+    a.sparsity_cache_.clear();
 
     // free taylor coefficient memory
     a.taylor_.clear();
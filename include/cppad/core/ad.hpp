@@ -2,7 +2,7 @@
 # define CPPAD_CORE_AD_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 // simple AD operations that must be defined for AD as well as base class
@@ -133,6 +133,7 @@ private :
     friend class discrete<Base>;
     friend class VecAD<Base>;
     friend class VecAD_reference<Base>;
+    friend class local::lazy_record<Base>;
 
     // arithematic binary operators
     friend AD<Base> operator + <Base>
@@ -196,6 +197,9 @@ public:
     // implicit constructor from VecAD<Base>::reference
     AD(const VecAD_reference<Base> &x);
 
+    // implicit constructor from an expression template
+    template <class Node> AD(const lazy_ad<Base, Node> &e);
+
     // explicit construction from some other type (deprecated)
     template <class T> explicit AD(const T &t);
 
@@ -211,6 +215,9 @@ public:
     // assignment from VecAD<Base>::reference
     AD& operator=(const VecAD_reference<Base> &x);
 
+    // assignment from an expression template
+    template <class Node> AD& operator=(const lazy_ad<Base, Node> &e);
+
     // assignment from some other type
     template <class T> AD& operator=(const T &right);
 
@@ -252,6 +259,7 @@ public:
 
     // abort current AD<Base> recording
     static void        abort_recording(void);
+    static void        reuse_recording(bool reuse);
 
     // set the maximum number of OpenMP threads (deprecated)
     static void        omp_max_thread(size_t number);
@@ -299,6 +307,8 @@ private:
     // static
     static tape_id_t*            tape_id_ptr(size_t thread);
     static local::ADTape<Base>** tape_handle(size_t thread);
+    static local::ADTape<Base>** tape_spare(size_t thread);
+    static bool*                 tape_reuse(size_t thread);
     static local::ADTape<Base>*         tape_manage(tape_manage_enum job);
     static local::ADTape<Base>*  tape_ptr(void);
     static local::ADTape<Base>*  tape_ptr(tape_id_t tape_id);
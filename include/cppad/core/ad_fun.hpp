@@ -2,7 +2,7 @@
 # define CPPAD_CORE_AD_FUN_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin ADFun}
@@ -32,6 +32,7 @@ Contents
 */
 # include <cppad/core/graph/cpp_graph.hpp>
 # include <cppad/local/subgraph/info.hpp>
+# include <cppad/local/sparse/pattern_cache.hpp>
 # include <cppad/local/graph/cpp_graph_op.hpp>
 # include <cppad/local/val_graph/val_type.hpp>
 
@@ -54,6 +55,11 @@ template <class Base, class RecBase>
 class ADFun {
     // ADFun<Base> must be a friend of ADFun< AD<Base> > for base2ad to work.
     template <class Base2, class RecBase2> friend class ADFun;
+public:
+    /// type of the user routine that executes sweep tasks in parallel
+    typedef void (*parallel_for_type)(
+        size_t n_task, void (*task)(size_t i_task, void* info), void* info
+    );
 private:
     // ------------------------------------------------------------
     // Private member variables
@@ -71,6 +77,17 @@ private:
     /// Check for nan's and report message to user (default value is true).
     bool check_for_nan_;
 
+    /// Evaluate cumulative summations using a wider type (see base2float).
+    bool double_sum_;
+
+    /// user routine that executes sweep tasks in parallel
+    /// (null for no parallel sweeps, the default value)
+    parallel_for_type parallel_for_;
+
+    /// how first order reverse uses parallel_for_; i.e.,
+    /// "none" (the default), "deterministic", or "accumulate"
+    std::string parallel_reverse_;
+
     /// If zero, ignoring comparison operators. Otherwise is the
     /// compare change count at which to store the operator index.
     size_t compare_change_count_;
@@ -110,6 +127,12 @@ private:
     /// Set during forward pass of order zero
     local::pod_vector<bool> cskip_op_;
 
+    /// If this vector is not empty, the zero order coefficients in taylor_
+    /// correspond to the parameter values at the previous zero order forward
+    /// and par_changed_[i] is true if the i-th parameter has changed since.
+    /// Set during forward pass of order zero and by new_dynamic.
+    local::pod_vector<bool> par_changed_;
+
     /// Variable on the tape corresponding to each vecad load operation
     /// (if zero, the operation corresponds to a parameter).
     local::pod_vector<addr_t> load_op2var_;
@@ -137,6 +160,9 @@ private:
     /// for_jac_sparse_set_.n_set() != 0  implies for_sparse_pack_ is empty.
     local::sparse::list_setvec for_jac_sparse_set_;
 
+    /// sparsity patterns that have been computed for this operation sequence
+    local::sparse::pattern_cache sparsity_cache_;
+
 
     // ------------------------------------------------------------
     // Private member functions
@@ -295,6 +321,8 @@ public:
 
     // create from Json or C++ AD graph
     void from_json(const std::string& json);
+    void from_json(const char* json, size_t size);
+    void from_json(std::istream& is);
     void from_graph(const cpp_graph& graph_obj);
     void from_graph(
         const cpp_graph&    graph_obj  ,
@@ -327,6 +355,10 @@ public:
     // (doxygen in cppad/core/base2ad.hpp)
     ADFun< AD<Base>, RecBase > base2ad(void) const;
 
+    // create ADFun<float> from this ADFun<Base>
+    // (doxygen in cppad/core/base2float.hpp)
+    ADFun<float> base2float(bool double_sum = false) const;
+
     /// sequence constructor
     template <class ADvector>
     ADFun(const ADvector &x, const ADvector &y);
@@ -340,6 +372,12 @@ public:
     /// get check_for_nan
     bool check_for_nan(void) const;
 
+    /// set parallel_for
+    void parallel_for(parallel_for_type parallel);
+
+    /// set parallel_reverse
+    void parallel_reverse(const std::string& mode);
+
     /// assign a new operation sequence
     template <class ADvector>
     void Dependent(const ADvector &x, const ADvector &y);
@@ -492,6 +530,32 @@ public:
         sparse_rc<SizeVector>&       pattern_out
     );
 
+    // forward mode Jacobian sparsity pattern for a chunk of the seeds
+    // (doxygen in cppad/core/jac_sparsity_chunk.hpp)
+    template <class SizeVector>
+    void for_jac_sparsity_chunk(
+        const sparse_rc<SizeVector>& pattern_in       ,
+        bool                         transpose        ,
+        bool                         dependency       ,
+        bool                         internal_bool    ,
+        size_t                       chunk_begin      ,
+        size_t                       chunk_end        ,
+        sparse_rc<SizeVector>&       pattern_out
+    ) const;
+
+    // reverse mode Jacobian sparsity pattern for a chunk of the seeds
+    // (doxygen in cppad/core/jac_sparsity_chunk.hpp)
+    template <class SizeVector>
+    void rev_jac_sparsity_chunk(
+        const sparse_rc<SizeVector>& pattern_in       ,
+        bool                         transpose        ,
+        bool                         dependency       ,
+        bool                         internal_bool    ,
+        size_t                       chunk_begin      ,
+        size_t                       chunk_end        ,
+        sparse_rc<SizeVector>&       pattern_out
+    ) const;
+
     // reverse mode Hessian sparsity pattern
     // (doxygen in cppad/core/rev_hes_sparsity.hpp)
     template <class BoolVector, class SizeVector>
@@ -581,6 +645,7 @@ public:
             "size_forward_bool: argument not equal to zero"
         );
         for_jac_sparse_pack_.resize(0, 0);
+        sparsity_cache_.clear_for_jac();
     }
 
     /// amount of memory used for vector of set Jacobain sparsity pattern
@@ -594,8 +659,25 @@ public:
             "size_forward_bool: argument not equal to zero"
         );
         for_jac_sparse_set_.resize(0, 0);
+        sparsity_cache_.clear_for_jac();
     }
 
+    /// set use of the sparsity pattern cache
+    void sparsity_cache(bool use_cache)
+    {   sparsity_cache_.use(use_cache); }
+
+    /// get use of the sparsity pattern cache
+    bool sparsity_cache(void) const
+    {   return sparsity_cache_.use(); }
+
+    /// number of sparsity patterns found in the cache
+    size_t sparsity_cache_hit(void) const
+    {   return sparsity_cache_.n_hit(); }
+
+    /// number of sparsity patterns computed while using the cache
+    size_t sparsity_cache_miss(void) const
+    {   return sparsity_cache_.n_miss(); }
+
     /// number of operators in the operation sequence
     size_t size_op(void) const
     {   return play_.num_var_op(); }
@@ -714,6 +796,37 @@ public:
     template <class BaseVector>
     BaseVector Hessian(const BaseVector &x, size_t i);
 
+    /// calculate Hessian, or Hessian times a matrix, using multiple
+    /// forward directions
+    template <class BaseVector>
+    BaseVector HessianDir(
+        const BaseVector& x ,
+        const BaseVector& w ,
+        size_t            r
+    ) const;
+    template <class BaseVector>
+    BaseVector HessianDir(
+        const BaseVector& x ,
+        const BaseVector& w ,
+        const BaseVector& v ,
+        size_t            r
+    ) const;
+
+    /// calculate derivative tensors using univariate Taylor interpolation
+    template <class BaseVector>
+    BaseVector TensorDir(
+        const BaseVector& x ,
+        size_t            d ,
+        size_t            r
+    );
+    template <class BaseVector>
+    BaseVector TensorDir(
+        const BaseVector& x ,
+        const BaseVector& s ,
+        size_t            d ,
+        size_t            r
+    );
+
     /// forward mode calculation of partial w.r.t one domain component
     template <class BaseVector>
     BaseVector ForOne(
@@ -853,10 +966,13 @@ public:
 } // END_CPPAD_NAMESPACE
 
 // non-user interfaces
+# include <cppad/local/sweep/unchanged_op.hpp>
 # include <cppad/local/sweep/forward_0.hpp>
+# include <cppad/local/sweep/forward_0_level.hpp>
 # include <cppad/local/sweep/forward_any.hpp>
 # include <cppad/local/sweep/forward_dir.hpp>
 # include <cppad/local/sweep/reverse.hpp>
+# include <cppad/local/sweep/reverse_1_level.hpp>
 # include <cppad/local/sweep/for_jac.hpp>
 # include <cppad/local/sweep/rev_jac.hpp>
 # include <cppad/local/sweep/rev_hes.hpp>
@@ -870,7 +986,9 @@ public:
 # include <cppad/core/dependent.hpp>
 # include <cppad/core/fun_construct.hpp>
 # include <cppad/core/base2ad.hpp>
+# include <cppad/core/base2float.hpp>
 # include <cppad/core/abort_recording.hpp>
+# include <cppad/core/reuse_recording.hpp>
 # include <cppad/core/fun_eval.hpp>
 # include <cppad/core/drivers.hpp>
 # include <cppad/core/fun_check.hpp>
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_ARITHMETIC_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 /*
@@ -19,6 +19,7 @@ Contents
     include/cppad/core/unary_minus.hpp
     include/cppad/core/ad_binary.hpp
     include/cppad/core/compound_assign.hpp
+    include/cppad/core/lazy.hpp
 }
 
 {xrst_end Arithmetic}
@@ -28,5 +29,6 @@ Contents
 # include <cppad/core/unary_minus.hpp>
 # include <cppad/core/ad_binary.hpp>
 # include <cppad/core/compound_assign.hpp>
+# include <cppad/core/lazy.hpp>
 
 # endif
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_ATOMIC_FOUR_ATOMIC_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin atomic_four_define}
@@ -45,6 +45,12 @@ Callbacks
 | *ok* = *afun* . ``reverse`` ( *call_id* ,
 | |tab| *select_x* , *order_up* , *taylor_x* , *taylor_y* , *partial_x* , *partial_y*
 | )
+| *ok* = *afun* . ``forward_batch`` ( *call_id* ,
+| |tab| *select_y* , *order_low* , *order_up* , *taylor_x* , *taylor_y*
+| )
+| *ok* = *afun* . ``reverse_batch`` ( *call_id* ,
+| |tab| *select_x* , *order_up* , *taylor_x* , *taylor_y* , *partial_x* , *partial_y*
+| )
 | *ok* = *afun* . ``jac_sparsity`` ( *call_id* ,
 | |tab| *dependency* , *ident_zero_x* , *select_x* *select_y* , *pattern_out*
 | )
@@ -115,6 +121,7 @@ Contents
     include/cppad/core/atomic/four/for_type.hpp
     include/cppad/core/atomic/four/forward.hpp
     include/cppad/core/atomic/four/reverse.hpp
+    include/cppad/core/atomic/four/batch.hpp
     include/cppad/core/atomic/four/jac_sparsity.hpp
     include/cppad/core/atomic/four/hes_sparsity.hpp
     include/cppad/core/atomic/four/rev_depend.hpp
@@ -245,6 +252,44 @@ public:
         vector< AD<Base> >&          apartial_x  ,
         const vector< AD<Base> >&    apartial_y
     );
+    // ------------------------------------------------------------------------
+    // forward_batch
+    virtual bool forward_batch(
+        const vector<size_t>&        call_id     ,
+        const vector<bool>&          select_y    ,
+        size_t                       order_low   ,
+        size_t                       order_up    ,
+        const vector<Base>&          taylor_x    ,
+        vector<Base>&                taylor_y
+    );
+    virtual bool forward_batch(
+        const vector<size_t>&        call_id     ,
+        const vector<bool>&          select_y    ,
+        size_t                       order_low   ,
+        size_t                       order_up    ,
+        const vector< AD<Base> >&    ataylor_x   ,
+        vector< AD<Base> >&          ataylor_y
+    );
+    // ------------------------------------------------------------------------
+    // reverse_batch
+    virtual bool reverse_batch(
+        const vector<size_t>&        call_id     ,
+        const vector<bool>&          select_x    ,
+        size_t                       order_up    ,
+        const vector<Base>&          taylor_x    ,
+        const vector<Base>&          taylor_y    ,
+        vector<Base>&                partial_x   ,
+        const vector<Base>&          partial_y
+    );
+    virtual bool reverse_batch(
+        const vector<size_t>&        call_id     ,
+        const vector<bool>&          select_x    ,
+        size_t                       order_up    ,
+        const vector< AD<Base> >&    ataylor_x   ,
+        const vector< AD<Base> >&    ataylor_y   ,
+        vector< AD<Base> >&          apartial_x  ,
+        const vector< AD<Base> >&    apartial_y
+    );
     // ------------------------------------------------------------
     // jac_sparsity
     virtual bool jac_sparsity(
@@ -429,6 +474,7 @@ public:
 # include <cppad/core/atomic/four/rev_depend.hpp>
 # include <cppad/core/atomic/four/forward.hpp>
 # include <cppad/core/atomic/four/reverse.hpp>
+# include <cppad/core/atomic/four/batch.hpp>
 # include <cppad/core/atomic/four/jac_sparsity.hpp>
 # include <cppad/core/atomic/four/hes_sparsity.hpp>
 
@@ -0,0 +1,212 @@
+# ifndef CPPAD_CORE_ATOMIC_FOUR_BATCH_HPP
+# define CPPAD_CORE_ATOMIC_FOUR_BATCH_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin atomic_four_batch}
+{xrst_spell
+    apartial
+    ataylor
+}
+
+Atomic Function Batched Forward and Reverse Mode
+################################################
+
+Syntax
+******
+
+| *ok* = *afun* . ``forward_batch`` (
+| |tab| *call_id* , *select_y* ,
+| |tab| *order_low* , *order_up* , *taylor_x* , *taylor_y*
+| )
+| *ok* = *afun* . ``reverse_batch`` (
+| |tab| *call_id* , *select_x* ,
+| |tab| *order_up* , *taylor_x* , *taylor_y* , *partial_x* , *partial_y*
+| )
+
+The ``AD`` < *Base* > versions of these functions have the same syntax
+where *ataylor_x* , *ataylor_y* , *apartial_x* , *apartial_y*
+replace *taylor_x* , *taylor_y* , *partial_x* , *partial_y* ;
+see :ref:`atomic_four_forward@Usage@AD<Base>` .
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_PROTOTYPE_FORWARD_BATCH
+    // END_PROTOTYPE_FORWARD_BATCH
+}
+{xrst_literal
+    // BEGIN_PROTOTYPE_REVERSE_BATCH
+    // END_PROTOTYPE_REVERSE_BATCH
+}
+
+Purpose
+*******
+Suppose that an atomic function wraps a small calculation and it is called
+many times during the recording of an :ref:`ADFun-name` object *f* .
+The cost of a virtual function call, and of packing and unpacking the
+Taylor coefficients for each call,
+can then dominate the cost of evaluating *f* .
+These optional callbacks evaluate a group of independent calls
+with one virtual function call and contiguous arrays.
+
+Batch
+*****
+A batch is a group of calls to *afun* that appear next to each other
+in the operation sequence for *f* ,
+have the same number of arguments *n* ,
+have the same number of results *m* ,
+and none of the arguments for a call in the batch is a result
+for another call in the batch.
+For example, a loop that calls *afun* for different slices of
+an independent variable vector, without using the results
+inside the loop, creates one batch.
+The order of the calls within a batch is not specified.
+
+Implementation
+**************
+These functions do not need to be defined.
+The default implementations return *ok* == ``false`` .
+In this case, and in any case where *ok* is false,
+the calls in the batch are evaluated one at a time using
+:ref:`atomic_four_forward-name` and :ref:`atomic_four_reverse-name`.
+Returning false for some values of *order_up* is reasonable,
+but it wastes the time needed to pack the batch the first time
+it happens during each sweep of the operation sequence.
+
+Zero order ``forward_batch`` is used by *f* . ``Forward`` ,
+and by the ``ADFun`` constructor and :ref:`Dependent-name` .
+It is not used while recording the operation sequence
+(the recording is always done one call at a time).
+``reverse_batch`` is used by *f* . ``Reverse``
+and :ref:`subgraph_reverse-name` .
+Batches are not used by multiple direction forward mode,
+the sparsity calculations,
+or when a sweep is being traced.
+
+n_call
+******
+We use *n_call* for the number of calls in the batch; i.e.,
+the size of *call_id* .
+This is always greater than one.
+
+call_id
+*******
+For *ell* = 0, ... , *n_call* - 1 ,
+*call_id* [ *ell* ] is the :ref:`atomic_four_call@call_id` for the
+corresponding call in the batch.
+
+q
+*
+We use the notation *q* = *order_up* + 1 .
+
+taylor_x, taylor_y
+******************
+The size of *taylor_x* ( *taylor_y* ) is *n_call* * *n* * *q*
+( *n_call* * *m* * *q* ).
+For each *ell* , the *ell*-th block of *n* * *q* ( *m* * *q* ) elements
+has the same specifications as *taylor_x* ( *taylor_y* ) in
+:ref:`atomic_four_forward-name` for the *ell*-th call in the batch; i.e.,
+
+| |tab| *taylor_x* [ ( *ell* * *n* + *j* ) * *q* + *k* ] = :math:`x_j^k`
+| |tab| *taylor_y* [ ( *ell* * *m* + *i* ) * *q* + *k* ] = :math:`y_i^k`
+
+for the *ell*-th call.
+
+partial_x, partial_y
+********************
+The size of *partial_x* ( *partial_y* ) is *n_call* * *n* * *q*
+( *n_call* * *m* * *q* ) and it uses the same blocks as
+*taylor_x* ( *taylor_y* ).
+Each block has the same specifications as *partial_x* ( *partial_y* ) in
+:ref:`atomic_four_reverse-name` for the corresponding call.
+
+select_y
+********
+The size of this vector is *n_call* * *m* and
+*select_y* [ *ell* * *m* + *i* ] specifies if
+*taylor_y* must be computed for the *i*-th result of the *ell*-th call;
+see :ref:`atomic_four_forward@select_y` .
+
+select_x
+********
+The size of this vector is *n_call* * *n* and
+*select_x* [ *ell* * *n* + *j* ] specifies if
+*partial_x* must be computed for the *j*-th argument of the *ell*-th call;
+see :ref:`atomic_four_reverse@select_x` .
+
+order_low, order_up
+*******************
+These have the same specifications as in
+:ref:`atomic_four_forward-name` and :ref:`atomic_four_reverse-name` .
+
+ok
+**
+If this calculation succeeded, *ok* is true.
+Otherwise, it is false and CppAD will evaluate the calls in the batch
+one at a time.
+
+{xrst_toc_hidden
+    example/atomic_four/batch.cpp
+}
+Example
+*******
+The file :ref:`atomic_four_batch.cpp-name`
+contains an example and test of these callbacks.
+
+{xrst_end atomic_four_batch}
+-----------------------------------------------------------------------------
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+// BEGIN_PROTOTYPE_FORWARD_BATCH
+template <class Base>
+bool atomic_four<Base>::forward_batch(
+    const vector<size_t>&        call_id     ,
+    const vector<bool>&          select_y    ,
+    size_t                       order_low   ,
+    size_t                       order_up    ,
+    const vector<Base>&          taylor_x    ,
+    vector<Base>&                taylor_y    )
+// END_PROTOTYPE_FORWARD_BATCH
+{   return false; }
+
+template <class Base>
+bool atomic_four<Base>::forward_batch(
+    const vector<size_t>&        call_id     ,
+    const vector<bool>&          select_y    ,
+    size_t                       order_low   ,
+    size_t                       order_up    ,
+    const vector< AD<Base> >&    ataylor_x   ,
+    vector< AD<Base> >&          ataylor_y   )
+{   return false; }
+
+// BEGIN_PROTOTYPE_REVERSE_BATCH
+template <class Base>
+bool atomic_four<Base>::reverse_batch(
+    const vector<size_t>&        call_id     ,
+    const vector<bool>&          select_x    ,
+    size_t                       order_up    ,
+    const vector<Base>&          taylor_x    ,
+    const vector<Base>&          taylor_y    ,
+    vector<Base>&                partial_x   ,
+    const vector<Base>&          partial_y   )
+// END_PROTOTYPE_REVERSE_BATCH
+{   return false; }
+
+template <class Base>
+bool atomic_four<Base>::reverse_batch(
+    const vector<size_t>&        call_id     ,
+    const vector<bool>&          select_x    ,
+    size_t                       order_up    ,
+    const vector< AD<Base> >&    ataylor_x   ,
+    const vector< AD<Base> >&    ataylor_y   ,
+    vector< AD<Base> >&          apartial_x  ,
+    const vector< AD<Base> >&    apartial_y  )
+{   return false; }
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_ATOMIC_THREE_ATOMIC_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin atomic_three_define}
@@ -45,6 +45,14 @@ Class Member Callbacks
 | |tab| *parameter_x* , *type_x* ,
 | |tab| *order_up* , *taylor_x* , *taylor_y* , *partial_x* , *partial_y*
 | )
+| *ok* = *afun* . ``forward_batch`` ( *n_call* ,
+| |tab| *parameter_x* , *type_x* ,
+| |tab| *need_y* , *order_low* , *order_up* , *taylor_x* , *taylor_y*
+| )
+| *ok* = *afun* . ``reverse_batch`` ( *n_call* ,
+| |tab| *parameter_x* , *type_x* ,
+| |tab| *order_up* , *taylor_x* , *taylor_y* , *partial_x* , *partial_y*
+| )
 | *ok* = *afun* . ``jac_sparsity`` (
 | |tab| *parameter_x* , *type_x* , *dependency* , *select_x* *select_y* , *pattern_out*
 | )
@@ -194,6 +202,7 @@ Contents
     include/cppad/core/atomic/three/for_type.hpp
     include/cppad/core/atomic/three/forward.hpp
     include/cppad/core/atomic/three/reverse.hpp
+    include/cppad/core/atomic/three/batch.hpp
     include/cppad/core/atomic/three/jac_sparsity.hpp
     include/cppad/core/atomic/three/hes_sparsity.hpp
     include/cppad/core/atomic/three/rev_depend.hpp
@@ -324,6 +333,48 @@ public:
         vector< AD<Base> >&          apartial_x  ,
         const vector< AD<Base> >&    apartial_y
     );
+    // ------------------------------------------------------------------------
+    // forward_batch, reverse_batch: see atomic/three/batch.hpp
+    virtual bool forward_batch(
+        size_t                       n_call      ,
+        const vector<Base>&          parameter_x ,
+        const vector<ad_type_enum>&  type_x      ,
+        size_t                       need_y      ,
+        size_t                       order_low   ,
+        size_t                       order_up    ,
+        const vector<Base>&          taylor_x    ,
+        vector<Base>&                taylor_y
+    );
+    virtual bool forward_batch(
+        size_t                       n_call       ,
+        const vector< AD<Base> >&    aparameter_x ,
+        const vector<ad_type_enum>&  type_x       ,
+        size_t                       need_y       ,
+        size_t                       order_low    ,
+        size_t                       order_up     ,
+        const vector< AD<Base> >&    ataylor_x    ,
+        vector< AD<Base> >&          ataylor_y
+    );
+    virtual bool reverse_batch(
+        size_t                       n_call      ,
+        const vector<Base>&          parameter_x ,
+        const vector<ad_type_enum>&  type_x      ,
+        size_t                       order_up    ,
+        const vector<Base>&          taylor_x    ,
+        const vector<Base>&          taylor_y    ,
+        vector<Base>&                partial_x   ,
+        const vector<Base>&          partial_y
+    );
+    virtual bool reverse_batch(
+        size_t                       n_call       ,
+        const vector< AD<Base> >&    aparameter_x ,
+        const vector<ad_type_enum>&  type_x       ,
+        size_t                       order_up     ,
+        const vector< AD<Base> >&    ataylor_x    ,
+        const vector< AD<Base> >&    ataylor_y    ,
+        vector< AD<Base> >&          apartial_x   ,
+        const vector< AD<Base> >&    apartial_y
+    );
     // ------------------------------------------------------------
     // jac_sparsity: see doxygen in atomic/three_jac_sparsity.hpp
     virtual bool jac_sparsity(
@@ -480,6 +531,7 @@ public:
 # include <cppad/core/atomic/three/rev_depend.hpp>
 # include <cppad/core/atomic/three/forward.hpp>
 # include <cppad/core/atomic/three/reverse.hpp>
+# include <cppad/core/atomic/three/batch.hpp>
 # include <cppad/core/atomic/three/jac_sparsity.hpp>
 # include <cppad/core/atomic/three/hes_sparsity.hpp>
 
@@ -0,0 +1,133 @@
+# ifndef CPPAD_CORE_ATOMIC_THREE_BATCH_HPP
+# define CPPAD_CORE_ATOMIC_THREE_BATCH_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin atomic_three_batch}
+{xrst_spell
+    aparameter
+}
+
+Atomic Function Batched Forward and Reverse Mode
+################################################
+
+Syntax
+******
+
+| *ok* = *afun* . ``forward_batch`` ( *n_call* ,
+| |tab| *parameter_x* , *type_x* ,
+| |tab| *need_y* , *order_low* , *order_up* , *taylor_x* , *taylor_y*
+| )
+| *ok* = *afun* . ``reverse_batch`` ( *n_call* ,
+| |tab| *parameter_x* , *type_x* ,
+| |tab| *order_up* , *taylor_x* , *taylor_y* , *partial_x* , *partial_y*
+| )
+
+The ``AD`` < *Base* > versions of these functions have the same syntax
+where the vectors of *Base* values are replaced by vectors of
+``AD`` < *Base* > values.
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_PROTOTYPE_FORWARD_BATCH
+    // END_PROTOTYPE_FORWARD_BATCH
+}
+{xrst_literal
+    // BEGIN_PROTOTYPE_REVERSE_BATCH
+    // END_PROTOTYPE_REVERSE_BATCH
+}
+
+Purpose
+*******
+These optional callbacks evaluate a
+:ref:`atomic_four_batch@Batch` of *n_call* independent calls
+to *afun* with one virtual function call.
+The default implementations return *ok* == ``false`` ,
+in which case the calls are evaluated one at a time using
+:ref:`atomic_three_forward-name` and :ref:`atomic_three_reverse-name` .
+The rules for when batches are used are the same as for
+:ref:`atomic_four_batch-name` .
+
+n_call
+******
+is the number of calls in the batch (greater than one).
+
+parameter_x, type_x
+*******************
+The size of these vectors is *n_call* * *n* ,
+where *n* is the number of arguments for each call.
+For *ell* = 0, ... , *n_call* - 1 ,
+the *ell*-th block of *n* elements has the same specifications as
+*parameter_x* and *type_x* in :ref:`atomic_three_forward-name`
+for the *ell*-th call.
+
+Other Arguments
+***************
+The blocks in *taylor_x* , *taylor_y* , *partial_x* and *partial_y*
+are the same as for :ref:`atomic_four_batch-name` .
+The argument *need_y* applies to all the calls in the batch; see
+:ref:`atomic_three_forward@need_y` .
+
+{xrst_end atomic_three_batch}
+-----------------------------------------------------------------------------
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+// BEGIN_PROTOTYPE_FORWARD_BATCH
+template <class Base>
+bool atomic_three<Base>::forward_batch(
+    size_t                       n_call      ,
+    const vector<Base>&          parameter_x ,
+    const vector<ad_type_enum>&  type_x      ,
+    size_t                       need_y      ,
+    size_t                       order_low   ,
+    size_t                       order_up    ,
+    const vector<Base>&          taylor_x    ,
+    vector<Base>&                taylor_y    )
+// END_PROTOTYPE_FORWARD_BATCH
+{   return false; }
+
+template <class Base>
+bool atomic_three<Base>::forward_batch(
+    size_t                       n_call       ,
+    const vector< AD<Base> >&    aparameter_x ,
+    const vector<ad_type_enum>&  type_x       ,
+    size_t                       need_y       ,
+    size_t                       order_low    ,
+    size_t                       order_up     ,
+    const vector< AD<Base> >&    ataylor_x    ,
+    vector< AD<Base> >&          ataylor_y    )
+{   return false; }
+
+// BEGIN_PROTOTYPE_REVERSE_BATCH
+template <class Base>
+bool atomic_three<Base>::reverse_batch(
+    size_t                       n_call      ,
+    const vector<Base>&          parameter_x ,
+    const vector<ad_type_enum>&  type_x      ,
+    size_t                       order_up    ,
+    const vector<Base>&          taylor_x    ,
+    const vector<Base>&          taylor_y    ,
+    vector<Base>&                partial_x   ,
+    const vector<Base>&          partial_y   )
+// END_PROTOTYPE_REVERSE_BATCH
+{   return false; }
+
+template <class Base>
+bool atomic_three<Base>::reverse_batch(
+    size_t                       n_call       ,
+    const vector< AD<Base> >&    aparameter_x ,
+    const vector<ad_type_enum>&  type_x       ,
+    size_t                       order_up     ,
+    const vector< AD<Base> >&    ataylor_x    ,
+    const vector< AD<Base> >&    ataylor_y    ,
+    vector< AD<Base> >&          apartial_x   ,
+    const vector< AD<Base> >&    apartial_y   )
+{   return false; }
+
+} // END_CPPAD_NAMESPACE
+# endif
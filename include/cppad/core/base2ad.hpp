@@ -2,7 +2,7 @@
 # define CPPAD_CORE_BASE2AD_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin base2ad}
@@ -109,6 +109,9 @@ ADFun< AD<Base>, RecBase > ADFun<Base,RecBase>::base2ad(void) const
     // sparse_list
     fun.for_jac_sparse_set_  = for_jac_sparse_set_;
     //
+    // sparsity_cache_
+    fun.sparsity_cache_      = sparsity_cache_;
+    //
     return fun;
 }
 
@@ -0,0 +1,187 @@
+# ifndef CPPAD_CORE_BASE2FLOAT_HPP
+# define CPPAD_CORE_BASE2FLOAT_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin base2float}
+
+Create a float Function From a Base Function
+############################################
+
+Syntax
+******
+| *ff* = *f* . ``base2float`` ()
+| *ff* = *f* . ``base2float`` ( *double_sum* )
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_PROTOTYPE
+    // END_PROTOTYPE
+}
+
+Purpose
+*******
+This creates a function object that has the same operation sequence as *f*
+and does its calculations using the type ``float`` .
+This uses half the memory for the Taylor coefficients and
+partial derivatives when *Base* is ``double`` .
+It can be used when ``float`` accuracy is sufficient; e.g.,
+for a screening pass before a more accurate evaluation using *f* .
+The operation sequence is not re-taped, only the parameter values are
+converted (once) to ``float`` .
+
+Base
+****
+This is the base type used to recorded the operation sequence in *f* ;
+e.g., ``double`` .
+It must be possible to convert a *Base* value to ``float``
+using the syntax ``float`` ( *value* ) .
+
+f
+*
+This object has prototype
+
+    ``ADFun`` < *Base* > *f*
+
+double_sum
+**********
+If this argument is true, the cumulative summation operations in *ff*
+are computed using ``double`` and the result of each summation
+is converted to ``float`` .
+This can reduce the roundoff error for long summations;
+e.g., the sum of many residuals.
+Cumulative summation operations are created by
+:ref:`optimizing<optimize-name>` a function.
+This only affects :ref:`zero order forward<forward_zero-name>` mode
+(first order reverse mode does not add up the terms in a summation).
+If this argument is not present, it is false.
+
+ff
+**
+This object has prototype
+
+    ``ADFun<float>`` *ff*
+
+Initially, there are no Taylor coefficients stored in *ff* and
+:ref:`ff.size_order()<size_order-name>` is zero.
+The settings for :ref:`fun_parallel_for-name` are not copied to *ff* .
+
+Restrictions
+************
+The function *f* cannot contain :ref:`atomic functions<atomic-name>`
+or :ref:`discrete functions<Discrete-name>` because they are defined
+for a specific base type.
+If *f* contains one of these functions,
+the :ref:`ErrorHandler-name` is called (even if ``NDEBUG`` is defined).
+
+{xrst_toc_hidden
+    example/general/base2float.cpp
+}
+Example
+*******
+The file :ref:`base2float.cpp-name`
+contains an example and test of this operation.
+
+{xrst_end base2float}
+----------------------------------------------------------------------------
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file base2float.hpp
+*/
+/// Create an ADFun<float> from this ADFun<Base>
+// BEGIN_PROTOTYPE
+template <class Base, class RecBase>
+ADFun<float> ADFun<Base,RecBase>::base2float(bool double_sum) const
+// END_PROTOTYPE
+{   //
+    // check for atomic and discrete functions
+    // (this check is done even when NDEBUG is defined)
+    bool ok = true;
+    for(size_t i_op = 0; i_op < play_.num_var_op(); ++i_op)
+    {   switch( play_.GetOp(i_op) )
+        {   case local::AFunOp:
+            case local::FunapOp:
+            case local::FunavOp:
+            case local::FunrpOp:
+            case local::FunrvOp:
+            case local::DisOp:
+            ok = false;
+            break;
+
+            default:
+            break;
+        }
+    }
+    const local::pod_vector<local::opcode_t>& dyn_par_op =
+        play_.dyn_par_op();
+    for(size_t i_dyn = 0; i_dyn < dyn_par_op.size(); ++i_dyn)
+    {   local::op_code_dyn op = local::op_code_dyn( dyn_par_op[i_dyn] );
+        if( op == local::atom_dyn || op == local::dis_dyn )
+            ok = false;
+    }
+    if( ! ok )
+    {   std::string msg = "base2float: ";
+        msg += "f contains an atomic function or a discrete function";
+        //
+        // use this source code as point of detection
+        bool known       = true;
+        int  line        = __LINE__;
+        const char* file = __FILE__;
+        const char* exp  = "f has no atomic or discrete functions";
+        //
+        // CppAD error handler
+        ErrorHandler::Call( known, line, file, exp, msg.c_str() );
+    }
+    //
+    ADFun<float> fun;
+    //
+    // bool values
+    fun.has_been_optimized_        = has_been_optimized_;
+    fun.check_for_nan_             = check_for_nan_;
+    fun.double_sum_                = double_sum;
+    //
+    // size_t values
+    fun.compare_change_count_      = compare_change_count_;
+    fun.compare_change_number_     = compare_change_number_;
+    fun.compare_change_op_index_   = compare_change_op_index_;
+    CPPAD_ASSERT_UNKNOWN( fun.num_order_taylor_ == 0 ) ;
+    CPPAD_ASSERT_UNKNOWN( fun.cap_order_taylor_ == 0 );
+    CPPAD_ASSERT_UNKNOWN( fun.num_direction_taylor_ == 0 );
+    fun.num_var_tape_              = num_var_tape_;
+    //
+    // pod_vector objects
+    fun.ind_taddr_                 = ind_taddr_;
+    fun.dep_taddr_                 = dep_taddr_;
+    fun.dep_parameter_             = dep_parameter_;
+    fun.cskip_op_                  = cskip_op_;
+    fun.load_op2var_               = load_op2var_;
+    //
+    // pod_maybe_vector<float> = pod_maybe_vector<Base>
+    CPPAD_ASSERT_UNKNOWN( fun.taylor_.size() == 0 );
+    //
+    // player
+    // (uses move semantics)
+    fun.play_ = play_.base2float();
+    //
+    // subgraph
+    fun.subgraph_info_ = subgraph_info_;
+    //
+    // sparse_pack
+    fun.for_jac_sparse_pack_ = for_jac_sparse_pack_;
+    //
+    // sparse_list
+    fun.for_jac_sparse_set_  = for_jac_sparse_set_;
+    //
+    // sparsity_cache_
+    fun.sparsity_cache_      = sparsity_cache_;
+    //
+    return fun;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
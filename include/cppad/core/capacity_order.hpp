@@ -2,7 +2,7 @@
 # define CPPAD_CORE_CAPACITY_ORDER_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 /*
@@ -158,6 +158,7 @@ void ADFun<Base,RecBase>::capacity_order(size_t c, size_t r)
 
     if( c == 0 )
     {   CPPAD_ASSERT_UNKNOWN( r == 0 );
+        par_changed_.clear();
         taylor_.clear();
         num_order_taylor_     = 0;
         cap_order_taylor_     = 0;
@@ -172,6 +173,10 @@ void ADFun<Base,RecBase>::capacity_order(size_t c, size_t r)
 
     // number of orders to copy
     size_t p = std::min(num_order_taylor_, c);
+    if( p == 0 )
+    {   // the zero order coefficients are not copied
+        par_changed_.clear();
+    }
     if( p > 0 )
     {
         // old order capacity
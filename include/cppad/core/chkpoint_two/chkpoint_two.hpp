@@ -2,7 +2,7 @@
 # define CPPAD_CORE_CHKPOINT_TWO_CHKPOINT_TWO_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
@@ -38,6 +38,10 @@ new_dynamic
 ===========
 *chk_fun* . ``new_dynamic`` ( *dynamic* )
 
+parallel_for
+============
+*chk_fun* . ``parallel_for`` ( *parallel* )
+
 Reduce Memory
 *************
 You can reduce the size of the tape and memory required for AD
@@ -93,6 +97,7 @@ Contents
     include/cppad/core/chkpoint_two/ctor.hpp
     include/cppad/core/chkpoint_two/chk_fun.xrst
     include/cppad/core/chkpoint_two/dynamic.hpp
+    include/cppad/core/chkpoint_two/parallel_for.hpp
     example/chkpoint_two/get_started.cpp
     example/chkpoint_two/compare.cpp
     example/chkpoint_two/base2ad.cpp
@@ -106,6 +111,12 @@ Contents
 template <class Base>
 class chkpoint_two : public atomic_three<Base> {
 // ---------------------------------------------------------------------------
+public:
+    /// type of the user routine that executes batch tasks in parallel
+    typedef void (*parallel_for_type)(
+        size_t n_task, void (*task)(size_t i_task, void* info), void* info
+    );
+// ---------------------------------------------------------------------------
 private:
     /// are sparsity calculations using bools or sets of integers
     const bool internal_bool_;
@@ -119,6 +130,10 @@ private:
     /// can this checkpoint function be used in parallel mode
     const bool use_in_parallel_;
     //
+    /// user routine that executes batch tasks in parallel
+    /// (initialized to null by constructor)
+    parallel_for_type parallel_for_;
+    //
     /// Jacobian sparsity for g(x) with dependency true.
     /// This is set by the constructor and constant after that.
     sparse_rc< vector<size_t> > jac_sparsity_;
@@ -260,6 +275,46 @@ private:
         vector<bool>&                  depend_x    ,
         const vector<bool>&            depend_y
     );
+    // AD forward_batch and AD reverse_batch use the atomic_three defaults
+    using atomic_three<Base>::forward_batch;
+    using atomic_three<Base>::reverse_batch;
+    //
+    // forward_batch
+    virtual bool forward_batch(
+        size_t                       n_call      ,
+        const vector<Base>&          parameter_x ,
+        const vector<ad_type_enum>&  type_x      ,
+        size_t                       need_y      ,
+        size_t                       order_low   ,
+        size_t                       order_up    ,
+        const vector<Base>&          taylor_x    ,
+        vector<Base>&                taylor_y
+    );
+    // reverse_batch
+    virtual bool reverse_batch(
+        size_t                       n_call      ,
+        const vector<Base>&          parameter_x ,
+        const vector<ad_type_enum>&  type_x      ,
+        size_t                       order_up    ,
+        const vector<Base>&          taylor_x    ,
+        const vector<Base>&          taylor_y    ,
+        vector<Base>&                partial_x   ,
+        const vector<Base>&          partial_y
+    );
+    // ------------------------------------------------------------------------
+    /// information passed to batch_task
+    struct batch_info {
+        chkpoint_two*          chk_fun;
+        size_t                 n;
+        size_t                 m;
+        size_t                 order_up;
+        const vector<Base>*    taylor_x;
+        vector<Base>*          taylor_y;
+        vector<Base>*          partial_x;
+        const vector<Base>*    partial_y;
+    };
+    /// evaluate one call in a batch (reverse mode if partial_x is not null)
+    static void batch_task(size_t i_task, void* info);
 public:
     // ctor
     chkpoint_two(
@@ -287,6 +342,7 @@ public:
     use_hes_sparsity_ ( other.use_hes_sparsity_ ) ,
     use_base2ad_      ( other.use_base2ad_ ) ,
     use_in_parallel_  ( other.use_in_parallel_ ) ,
+    parallel_for_     ( other.parallel_for_ ) ,
     jac_sparsity_     ( other.jac_sparsity_ ) ,
     hes_sparsity_     ( other.hes_sparsity_ )
     {   g_  = other.g_;
@@ -296,12 +352,16 @@ public:
     // new_dynamic
     template <class BaseVector>
     void new_dynamic(const BaseVector& dynamic);
+    //
+    // parallel_for
+    void parallel_for(parallel_for_type parallel);
 };
 
 } // END_CPPAD_NAMESPACE
 
 # include <cppad/core/chkpoint_two/ctor.hpp>
 # include <cppad/core/chkpoint_two/dynamic.hpp>
+# include <cppad/core/chkpoint_two/parallel_for.hpp>
 # include <cppad/core/chkpoint_two/for_type.hpp>
 # include <cppad/core/chkpoint_two/forward.hpp>
 # include <cppad/core/chkpoint_two/reverse.hpp>
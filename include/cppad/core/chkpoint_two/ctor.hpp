@@ -2,7 +2,7 @@
 # define CPPAD_CORE_CHKPOINT_TWO_CTOR_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin chkpoint_two_ctor}
@@ -129,7 +129,8 @@ atomic_three<Base>(name)              ,
 internal_bool_( internal_bool )       ,
 use_hes_sparsity_( use_hes_sparsity ) ,
 use_base2ad_ ( use_base2ad )          ,
-use_in_parallel_ ( use_in_parallel )
+use_in_parallel_ ( use_in_parallel )   ,
+parallel_for_ ( nullptr )
 {   CPPAD_ASSERT_KNOWN(
         ! thread_alloc::in_parallel() ,
         "chkpoint_two: constructor cannot be called in parallel mode."
@@ -0,0 +1,303 @@
+# ifndef CPPAD_CORE_CHKPOINT_TWO_PARALLEL_FOR_HPP
+# define CPPAD_CORE_CHKPOINT_TWO_PARALLEL_FOR_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin chkpoint_two_parallel_for}
+{xrst_spell
+    chk
+}
+
+Evaluate Independent Checkpoint Calls in Parallel
+#################################################
+
+Syntax
+******
+| *chk_fun* . ``parallel_for`` ( *parallel* )
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_PROTOTYPE
+    // END_PROTOTYPE
+}
+
+Purpose
+*******
+Suppose that *chk_fun* is called many times, with arguments that do not
+depend on each other, during the recording of an ``ADFun`` < *Base* >
+object *f* ; e.g., once for each scenario in a loop.
+These calls form a :ref:`atomic_four_batch@Batch` and
+*chk_fun* uses the :ref:`atomic_three_batch-name` callbacks
+to evaluate their forward and reverse mode calculations
+as separate tasks in parallel.
+The results are then stored in *f* the same way as when the calls are
+evaluated one at a time.
+
+chk_fun
+*******
+This object must have been created using the
+:ref:`chkpoint_two<chkpoint_two_ctor@chk_fun>` constructor with
+:ref:`chkpoint_two_ctor@use_in_parallel` true.
+This routine must not be called in
+:ref:`parallel<ta_in_parallel-name>` mode.
+
+parallel
+********
+This is a pointer to a routine, provided by the user,
+that is used to execute the tasks; i.e., CppAD does not create threads.
+It is called with the syntax
+
+| |tab| *parallel* ( *n_task* , *task* , *info* )
+
+and must call
+
+| |tab| *task* ( *i_task* , *info* )
+
+exactly once for each *i_task* = 0 , ... , *n_task* - 1 .
+These calls can be made by different threads in any order,
+but *parallel* must not return until all of them have completed.
+The threads must be set up using :ref:`ta_parallel_setup-name`
+so that :ref:`ta_in_parallel-name` is true and :ref:`ta_thread_num-name`
+is different for each thread that is executing a task.
+For example, using OpenMP::
+
+    void parallel_for(
+        size_t n_task, void (*task)(size_t, void*), void* info
+    )
+    {   int n = int(n_task);
+    # pragma omp parallel for
+        for(int i = 0; i < n; ++i)
+            task( size_t(i), info );
+    }
+
+If *parallel* is null (its value after the constructor),
+the calls are evaluated one at a time.
+
+Batch Evaluation
+****************
+A batch is evaluated in parallel during zero and higher order
+*f* . ``Forward`` and during *f* . ``Reverse`` ,
+but not during the ``AD`` < *Base* > calculations used by
+:ref:`base2ad-name` , and not when *f* is being used in parallel mode
+(in these cases the calls are evaluated one at a time).
+
+Dynamic Parameters
+******************
+Each thread uses its own copy of the function defining *chk_fun* .
+If :ref:`chkpoint_two_dynamic-name` is used,
+it must be called by every thread that may execute a task.
+
+Example
+*******
+{xrst_toc_hidden
+    example/chkpoint_two/parallel_for.cpp
+}
+The file :ref:`chkpoint_two_parallel_for.cpp-name`
+contains an example and test of this operation.
+
+{xrst_end chkpoint_two_parallel_for}
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file chkpoint_two/parallel_for.hpp
+Second generation checkpoint batches evaluated in parallel.
+*/
+
+/*!
+Set the routine used to execute batch tasks in parallel.
+
+\param parallel
+is the user routine that executes the tasks (null for no parallel batches).
+*/
+// BEGIN_PROTOTYPE
+template <class Base>
+void chkpoint_two<Base>::parallel_for(parallel_for_type parallel)
+// END_PROTOTYPE
+{   CPPAD_ASSERT_KNOWN(
+        ! thread_alloc::in_parallel() ,
+        "chkpoint_two: parallel_for cannot be called in parallel mode."
+    );
+    CPPAD_ASSERT_KNOWN(
+        use_in_parallel_ || parallel == nullptr ,
+        "chkpoint_two: parallel_for is not null and use_in_parallel is false"
+    );
+    parallel_for_ = parallel;
+}
+
+/*!
+Evaluate one call in a batch using the copy of g for the current thread.
+
+\param i_task [in]
+is the index of the call in the batch.
+
+\param info [in]
+is a pointer to the batch_info structure for this batch.
+If partial_x is null, this is zero order through order_up forward mode.
+Otherwise, it is reverse mode for orders zero through order_up.
+*/
+template <class Base>
+void chkpoint_two<Base>::batch_task(size_t i_task, void* info)
+{   batch_info*   b_ptr   = reinterpret_cast<batch_info*>(info);
+    chkpoint_two* chk_fun = b_ptr->chk_fun;
+    //
+    // g
+    size_t thread = thread_alloc::thread_num();
+    chk_fun->allocate_member(thread);
+    ADFun<Base>& g( chk_fun->member_[thread]->g_ );
+    //
+    // n, m, q
+    size_t n = b_ptr->n;
+    size_t m = b_ptr->m;
+    size_t q = b_ptr->order_up + 1;
+    //
+    // tx
+    vector<Base> tx(n * q);
+    for(size_t i = 0; i < n * q; ++i)
+        tx[i] = (*b_ptr->taylor_x)[i_task * n * q + i];
+    //
+    // forward mode results for all values and orders
+    vector<Base> ty = g.Forward(q - 1, tx);
+    if( b_ptr->partial_x == nullptr )
+    {   for(size_t i = 0; i < m * q; ++i)
+            (*b_ptr->taylor_y)[i_task * m * q + i] = ty[i];
+        return;
+    }
+    //
+    // py
+    vector<Base> py(m * q);
+    for(size_t i = 0; i < m * q; ++i)
+        py[i] = (*b_ptr->partial_y)[i_task * m * q + i];
+    //
+    // px
+    vector<Base> px = g.Reverse(q, py);
+    for(size_t i = 0; i < n * q; ++i)
+        (*b_ptr->partial_x)[i_task * n * q + i] = px[i];
+    //
+    return;
+}
+
+/*!
+Link from chkpoint_two to batch forward mode
+
+\param n_call [in]
+number of calls in this batch.
+
+\param parameter_x [in]
+contains the values, in afun(ax, ay), for arguments that are parameters.
+
+\param type_x [in]
+what is the type, in afun(ax, ay), for each component of x.
+
+\param need_y [in]
+specifies which components of taylor_y are needed,
+
+\param order_low [in]
+lowerest order for this forward mode calculation.
+
+\param order_up [in]
+highest order for this forward mode calculation.
+
+\param taylor_x [in]
+Taylor coefficients corresponding to x for each call in the batch.
+
+\param taylor_y [out]
+Taylor coefficient corresponding to y for each call in the batch.
+
+See the batch forward mode in user's documentation for atomic_three
+*/
+template <class Base>
+bool chkpoint_two<Base>::forward_batch(
+    size_t                       n_call      ,
+    const vector<Base>&          parameter_x ,
+    const vector<ad_type_enum>&  type_x      ,
+    size_t                       need_y      ,
+    size_t                       order_low   ,
+    size_t                       order_up    ,
+    const vector<Base>&          taylor_x    ,
+    vector<Base>&                taylor_y    )
+{   if( parallel_for_ == nullptr || thread_alloc::in_parallel() )
+        return false;
+    CPPAD_ASSERT_UNKNOWN( use_in_parallel_ );
+    //
+    batch_info info;
+    info.chk_fun   = this;
+    info.n         = g_.Domain();
+    info.m         = g_.Range();
+    info.order_up  = order_up;
+    info.taylor_x  = &taylor_x;
+    info.taylor_y  = &taylor_y;
+    info.partial_x = nullptr;
+    info.partial_y = nullptr;
+    CPPAD_ASSERT_UNKNOWN( taylor_x.size() == n_call * info.n * (order_up+1) );
+    CPPAD_ASSERT_UNKNOWN( taylor_y.size() == n_call * info.m * (order_up+1) );
+    //
+    parallel_for_(n_call, batch_task, reinterpret_cast<void*>(&info) );
+    //
+    return true;
+}
+
+/*!
+Link from chkpoint_two to batch reverse mode
+
+\param n_call [in]
+number of calls in this batch.
+
+\param parameter_x [in]
+contains the values, in afun(ax, ay), for arguments that are parameters.
+
+\param type_x [in]
+what is the type, in afun(ax, ay), for each component of x.
+
+\param order_up [in]
+highest order Taylor coefficient aht we are computing derivative of
+
+\param taylor_x [in]
+Taylor coefficients corresponding to x for each call in the batch.
+
+\param taylor_y [in]
+Taylor coefficient corresponding to y for each call in the batch.
+
+\param partial_x [out]
+Partials w.r.t. the x Taylor coefficients for each call in the batch.
+
+\param partial_y [in]
+Partials w.r.t. the y Taylor coefficients for each call in the batch.
+
+See the batch reverse mode in user's documentation for atomic_three
+*/
+template <class Base>
+bool chkpoint_two<Base>::reverse_batch(
+    size_t                       n_call      ,
+    const vector<Base>&          parameter_x ,
+    const vector<ad_type_enum>&  type_x      ,
+    size_t                       order_up    ,
+    const vector<Base>&          taylor_x    ,
+    const vector<Base>&          taylor_y    ,
+    vector<Base>&                partial_x   ,
+    const vector<Base>&          partial_y   )
+{   if( parallel_for_ == nullptr || thread_alloc::in_parallel() )
+        return false;
+    CPPAD_ASSERT_UNKNOWN( use_in_parallel_ );
+    //
+    batch_info info;
+    info.chk_fun   = this;
+    info.n         = g_.Domain();
+    info.m         = g_.Range();
+    info.order_up  = order_up;
+    info.taylor_x  = &taylor_x;
+    info.taylor_y  = nullptr;
+    info.partial_x = &partial_x;
+    info.partial_y = &partial_y;
+    CPPAD_ASSERT_UNKNOWN( partial_x.size() == n_call * info.n * (order_up+1) );
+    CPPAD_ASSERT_UNKNOWN( partial_y.size() == n_call * info.m * (order_up+1) );
+    //
+    parallel_for_(n_call, batch_task, reinterpret_cast<void*>(&info) );
+    //
+    return true;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
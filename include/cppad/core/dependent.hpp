@@ -2,7 +2,7 @@
 # define CPPAD_CORE_DEPENDENT_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin Dependent}
@@ -304,6 +304,7 @@ void ADFun<Base,RecBase>::Dependent(local::ADTape<Base> *tape, const ADvector &y
     // for_jac_sparse_pack_, for_jac_sparse_set_
     for_jac_sparse_pack_.resize(0, 0);
     for_jac_sparse_set_.resize(0,0);
+    sparsity_cache_.clear();
 
     // resize subgraph_info_
     subgraph_info_.resize(
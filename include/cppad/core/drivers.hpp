@@ -2,11 +2,13 @@
 # define CPPAD_CORE_DRIVERS_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cppad/core/jacobian.hpp>
 # include <cppad/core/hessian.hpp>
+# include <cppad/core/hessian_dir.hpp>
+# include <cppad/core/tensor_dir.hpp>
 # include <cppad/core/for_one.hpp>
 # include <cppad/core/rev_one.hpp>
 # include <cppad/core/for_two.hpp>
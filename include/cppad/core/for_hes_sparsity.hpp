@@ -2,7 +2,7 @@
 # define CPPAD_CORE_FOR_HES_SPARSITY_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin for_hes_sparsity}
@@ -179,6 +179,18 @@ void ADFun<Base,RecBase>::for_hes_sparsity(
         "for_hes_sparsity: size of select_range is not equal to "
         "number of dependent variables"
     );
+    // cache_key
+    // key for this calculation in the sparsity pattern cache
+    local::sparse::pattern_cache::key_type cache_key;
+    if( sparsity_cache_.use() )
+    {   cache_key.push_back( local::sparse::pattern_cache::for_hes_enum );
+        cache_key.push_back( size_t(internal_bool) );
+        local::sparse::pattern_cache::append_select(cache_key, select_domain);
+        local::sparse::pattern_cache::append_select(cache_key, select_range);
+        if( sparsity_cache_.get(cache_key, pattern_out) )
+            return;
+    }
+    //
     // do not need transpose or dependency
     bool transpose  = false;
     bool dependency = false;
@@ -281,6 +293,9 @@ void ADFun<Base,RecBase>::for_hes_sparsity(
     {   CPPAD_ASSERT_UNKNOWN( 0 < col[k] );
         pattern_out.set(k, row[k], col[k] - 1);
     }
+    // store pattern_out in the sparsity pattern cache
+    if( cache_key.size() > 0 )
+        sparsity_cache_.set(cache_key, pattern_out);
     return;
 }
 } // END_CPPAD_NAMESPACE
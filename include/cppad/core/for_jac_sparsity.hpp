@@ -2,7 +2,7 @@
 # define CPPAD_CORE_FOR_JAC_SPARSITY_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin for_jac_sparsity}
@@ -234,6 +234,20 @@ void ADFun<Base,RecBase>::for_jac_sparsity(
         "for_jac_sparsity: number rows in R "
         "is not equal number of independent variables."
     );
+    // cache_key
+    // key for this calculation in the sparsity pattern cache
+    local::sparse::pattern_cache::key_type cache_key;
+    if( sparsity_cache_.use() )
+    {   cache_key.push_back( local::sparse::pattern_cache::for_jac_enum );
+        cache_key.push_back( size_t(transpose) );
+        cache_key.push_back( size_t(dependency) );
+        cache_key.push_back( size_t(internal_bool) );
+        local::sparse::pattern_cache::append_pattern(cache_key, pattern_in);
+        if( sparsity_cache_.is_for_jac(cache_key) &&
+            sparsity_cache_.get(cache_key, pattern_out) )
+            return;
+    }
+    //
     bool zero_empty  = true;
     bool input_empty = true;
     if( internal_bool )
@@ -299,6 +313,13 @@ void ADFun<Base,RecBase>::for_jac_sparsity(
             transpose, dep_taddr_, for_jac_sparse_set_, pattern_out
         );
     }
+    // the forward Jacobian sparsity patterns stored in this object
+    // correspond to cache_key (cache_key is empty when not using the cache)
+    sparsity_cache_.set_for_jac(cache_key);
+    //
+    // store pattern_out in the sparsity pattern cache
+    if( cache_key.size() > 0 )
+        sparsity_cache_.set(cache_key, pattern_out);
     return;
 }
 
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_FOR_SPARSE_JAC_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 /*
@@ -583,6 +583,7 @@ SetVector ADFun<Base,RecBase>::ForSparseJac(
     // free all memory currently in sparsity patterns
     for_jac_sparse_pack_.resize(0, 0);
     for_jac_sparse_set_.resize(0, 0);
+    sparsity_cache_.clear_for_jac();
 
     ForSparseJacCase(
         Set_type()  ,
@@ -690,6 +691,7 @@ void ADFun<Base,RecBase>::ForSparseJacCheckpoint(
     // free all memory currently in sparsity patterns
     for_jac_sparse_pack_.resize(0, 0);
     for_jac_sparse_set_.resize(0, 0);
+    sparsity_cache_.clear_for_jac();
 
     // allocate new sparsity pattern
     for_jac_sparse_set_.resize(num_var_tape_, q);
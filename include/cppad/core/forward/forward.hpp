@@ -2,13 +2,14 @@
 # define CPPAD_CORE_FORWARD_FORWARD_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 // documented after Forward but included here so easy to see
 # include <cppad/core/capacity_order.hpp>
 # include <cppad/core/num_skip.hpp>
 # include <cppad/core/check_for_nan.hpp>
+# include <cppad/core/fun_parallel_for.hpp>
 
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
 
@@ -140,6 +141,29 @@ BaseVector ADFun<Base,RecBase>::Forward(
         "\nMust use Forward(q, r, xq) for this case"
     );
 
+    // unchanged_op
+    // If the parameters have changed since the previous zero order forward,
+    // determine which operators do not need to be evaluated.
+    local::pod_vector<bool> unchanged_op;
+    bool use_unchanged = q == 0;
+    use_unchanged     &= num_order_taylor_ == 0;
+    use_unchanged     &= 0 < cap_order_taylor_;
+    use_unchanged     &= num_direction_taylor_ == 1;
+    use_unchanged     &= par_changed_.size() == play_.num_par_all();
+    if( use_unchanged )
+    {   local::pod_vector<bool> var_changed( num_var_tape_ );
+        for(j = 0; j < num_var_tape_; ++j)
+            var_changed[j] = false;
+        for(j = 0; j < n; ++j)
+        {   size_t index = cap_order_taylor_ * ind_taddr_[j];
+            var_changed[ ind_taddr_[j] ] =
+                ! IdenticalEqualCon(taylor_[index], xq[j]);
+        }
+        use_unchanged = local::sweep::unchanged_op(
+            &play_, par_changed_, var_changed, unchanged_op
+        );
+    }
+
     // does taylor_ need more orders or fewer directions
     if( (cap_order_taylor_ <= q) || (num_direction_taylor_ != 1) )
     {   if( p == 0 )
@@ -161,9 +185,12 @@ BaseVector ADFun<Base,RecBase>::Forward(
     // The optimizer may skip a step that does not affect dependent variables.
     // Initializing zero order coefficients avoids following valgrind warning:
     // "Conditional jump or move depends on uninitialised value(s)".
-    for(j = 0; j < num_var_tape_; j++)
-    {   for(k = p; k <= q; k++)
-            taylor_[C * j + k] = CppAD::numeric_limits<Base>::quiet_NaN();
+    // (The zero order coefficients for unchanged operators are kept.)
+    if( ! use_unchanged )
+    {   for(j = 0; j < num_var_tape_; j++)
+        {   for(k = p; k <= q; k++)
+                taylor_[C * j + k] = CppAD::numeric_limits<Base>::quiet_NaN();
+        }
     }
 
     // set Taylor coefficients for independent variables
@@ -192,8 +219,21 @@ BaseVector ADFun<Base,RecBase>::Forward(
     CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_var_op() );
     CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load() );
     if( q == 0 )
-    {   bool print = true;
-        local::sweep::forward_0(
+    {   // use parallel tasks if parallel_for_ is set and play_ is wide enough
+        bool done = local::sweep::forward_0_level(
+            &play_,
+            parallel_for_,
+            C,
+            cskip_op_.data(),
+            compare_change_count_,
+            compare_change_number_,
+            compare_change_op_index_,
+            taylor_.data(),
+            use_unchanged ? unchanged_op.data() : nullptr,
+            double_sum_
+        );
+        bool print = true;
+        if( ! done ) local::sweep::forward_0(
             not_used_rec_base,
             &play_,
             num_var_tape_,
@@ -205,7 +245,9 @@ BaseVector ADFun<Base,RecBase>::Forward(
             compare_change_op_index_,
             s,
             print,
-            taylor_.data()
+            taylor_.data(),
+            use_unchanged ? unchanged_op.data() : nullptr,
+            double_sum_
         );
     }
     else
@@ -310,6 +352,13 @@ BaseVector ADFun<Base,RecBase>::Forward(
     // now we have q + 1  taylor_ coefficient orders per variable
     num_order_taylor_ = q + 1;
 
+    // none of the parameters have changed since this zero order forward
+    if( p == 0 )
+    {   par_changed_.resize( play_.num_par_all() );
+        for(i = 0; i < play_.num_par_all(); ++i)
+            par_changed_[i] = false;
+    }
+
     return yq;
 }
 /*
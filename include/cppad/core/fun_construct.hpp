@@ -2,7 +2,7 @@
 # define CPPAD_CORE_FUN_CONSTRUCT_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin fun_construct}
@@ -246,6 +246,9 @@ function_name_(""),
 exceed_collision_limit_(false),
 has_been_optimized_(false),
 check_for_nan_(true) ,
+double_sum_(false) ,
+parallel_for_(nullptr) ,
+parallel_reverse_("none") ,
 compare_change_count_(0),
 compare_change_number_(0),
 compare_change_op_index_(0),
@@ -296,6 +299,13 @@ void ADFun<Base,RecBase>::operator=(const ADFun& f)
     exceed_collision_limit_    = f.exceed_collision_limit_;
     has_been_optimized_        = f.has_been_optimized_;
     check_for_nan_             = f.check_for_nan_;
+    double_sum_                = f.double_sum_;
+    //
+    // function pointers
+    parallel_for_              = f.parallel_for_;
+    //
+    // string objects
+    parallel_reverse_          = f.parallel_reverse_;
     //
     // size_t objects
     compare_change_count_      = f.compare_change_count_;
@@ -311,6 +321,7 @@ void ADFun<Base,RecBase>::operator=(const ADFun& f)
     dep_taddr_                 = f.dep_taddr_;
     dep_parameter_             = f.dep_parameter_;
     cskip_op_                  = f.cskip_op_;
+    par_changed_               = f.par_changed_;
     load_op2var_               = f.load_op2var_;
     //
     // pod_vector_maybe_vectors
@@ -328,6 +339,9 @@ void ADFun<Base,RecBase>::operator=(const ADFun& f)
     //
     // sparse_list
     for_jac_sparse_set_        = f.for_jac_sparse_set_;
+    //
+    // sparsity_cache_
+    sparsity_cache_            = f.sparsity_cache_;
 }
 /// swap
 template <class Base, class RecBase>
@@ -340,6 +354,13 @@ void ADFun<Base,RecBase>::swap(ADFun& f)
     std::swap( exceed_collision_limit_    , f.exceed_collision_limit_);
     std::swap( has_been_optimized_        , f.has_been_optimized_);
     std::swap( check_for_nan_             , f.check_for_nan_);
+    std::swap( double_sum_                , f.double_sum_);
+    //
+    // function pointers
+    std::swap( parallel_for_              , f.parallel_for_);
+    //
+    // string objects
+    parallel_reverse_.swap( f.parallel_reverse_ );
     //
     // size_t objects
     std::swap( compare_change_count_      , f.compare_change_count_);
@@ -356,6 +377,7 @@ void ADFun<Base,RecBase>::swap(ADFun& f)
     dep_parameter_.swap(  f.dep_parameter_);
     taylor_.swap(         f.taylor_);
     cskip_op_.swap(       f.cskip_op_);
+    par_changed_.swap(    f.par_changed_);
     load_op2var_.swap(    f.load_op2var_);
     //
     // player
@@ -369,6 +391,9 @@ void ADFun<Base,RecBase>::swap(ADFun& f)
     //
     // sparse_list
     for_jac_sparse_set_.swap( f.for_jac_sparse_set_);
+    //
+    // sparsity_cache_
+    sparsity_cache_.swap( f.sparsity_cache_ );
 }
 /// Move semantics version of constructor and assignment
 template <class Base, class RecBase>
@@ -460,6 +485,9 @@ ADFun<Base,RecBase>::ADFun(const ADVector &x, const ADVector &y)
 
     // ad_fun.hpp member values not set by dependent
     check_for_nan_       = true;
+    double_sum_          = false;
+    parallel_for_        = nullptr;
+    parallel_reverse_    = "none";
 
     // allocate memory for one zero order taylor_ coefficient
     CPPAD_ASSERT_UNKNOWN( num_order_taylor_ == 0 );
@@ -481,7 +509,8 @@ ADFun<Base,RecBase>::ADFun(const ADVector &x, const ADVector &y)
     // use independent variable values to fill in values for others
     CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_var_op() );
     CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load() );
-    bool print = false;
+    bool print      = false;
+    bool double_sum = false;
     local::sweep::forward_0(
         not_used_rec_base,
         &play_,
@@ -494,7 +523,9 @@ ADFun<Base,RecBase>::ADFun(const ADVector &x, const ADVector &y)
         compare_change_op_index_,
         std::cout,
         print,
-        taylor_.data()
+        taylor_.data(),
+        nullptr,
+        double_sum
     );
     CPPAD_ASSERT_UNKNOWN( compare_change_count_    == 1 );
     CPPAD_ASSERT_UNKNOWN( compare_change_number_   == 0 );
@@ -503,6 +534,11 @@ ADFun<Base,RecBase>::ADFun(const ADVector &x, const ADVector &y)
     // now set the number of orders stored
     num_order_taylor_ = 1;
 
+    // none of the parameters have changed since this zero order forward
+    par_changed_.resize( play_.num_par_all() );
+    for(size_t k = 0; k < play_.num_par_all(); ++k)
+        par_changed_[k] = false;
+
 # ifndef NDEBUG
     // on MS Visual Studio 2012, CppAD required in front of isnan ?
     for(i = 0; i < m; i++)
@@ -0,0 +1,241 @@
+# ifndef CPPAD_CORE_FUN_PARALLEL_FOR_HPP
+# define CPPAD_CORE_FUN_PARALLEL_FOR_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin fun_parallel_for}
+{xrst_spell
+    omp
+    pragma
+}
+
+Evaluate an ADFun Object Using Parallel Tasks
+#############################################
+
+Syntax
+******
+| *f* . ``parallel_for`` ( *parallel* )
+| *f* . ``parallel_reverse`` ( *mode* )
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_PROTOTYPE
+    // END_PROTOTYPE
+}
+{xrst_literal
+    // BEGIN_REVERSE_PROTOTYPE
+    // END_REVERSE_PROTOTYPE
+}
+
+Purpose
+*******
+A single :ref:`zero order forward<forward_zero-name>` , or
+:ref:`first order reverse<reverse_one-name>` , calculation
+evaluates the operations in *f* one at a time.
+If many of the operations do not depend on each other; e.g.,
+*f* computes many independent residuals,
+they can be evaluated in parallel.
+These routines specify a user routine that is used to
+evaluate these operations as parallel tasks.
+
+f
+*
+The object *f* has prototype
+
+    ``ADFun`` < *Base* > *f*
+
+Operations using the type *Base* must be thread safe
+(this is true for ``float`` , ``double`` and ``std::complex<double>`` ).
+These routines must not be called in
+:ref:`parallel<ta_in_parallel-name>` mode.
+
+parallel
+********
+This is a pointer to a routine, provided by the user,
+that is used to execute the tasks; i.e., CppAD does not create threads.
+It is called with the syntax
+
+| |tab| *parallel* ( *n_task* , *task* , *info* )
+
+and must call
+
+| |tab| *task* ( *i_task* , *info* )
+
+exactly once for each *i_task* = 0 , ... , *n_task* - 1 .
+These calls can be made by different threads in any order,
+but *parallel* must not return until all of them have completed.
+The tasks only use *Base* operations and do not allocate memory,
+so the threads need not be set up using :ref:`ta_parallel_setup-name` .
+For example, using OpenMP::
+
+    void parallel_for(
+        size_t n_task, void (*task)(size_t, void*), void* info
+    )
+    {   int n = int(n_task);
+    # pragma omp parallel for schedule(dynamic)
+        for(int i = 0; i < n; ++i)
+            task( size_t(i), info );
+    }
+
+If *parallel* is null, the operations are evaluated one at a time.
+
+mode
+****
+This specifies how first order reverse mode uses *parallel* :
+
+.. csv-table::
+    :widths: auto
+
+    *mode*,Meaning
+    ``none``,the operations are evaluated one at a time
+    ``deterministic``,the results are identical to ``none`` (see below)
+    ``accumulate``,the results may differ by roundoff from ``none``
+
+See :ref:`fun_parallel_for@First Order Reverse` below.
+
+Default
+*******
+The values of *parallel* and *mode* after construction of *f* are
+null and ``none`` .
+They are not affected by calling :ref:`Dependent-name` for *f* ,
+they are copied by the ``ADFun``
+:ref:`assignment<fun_construct@Assignment Operator>` operation,
+and they are not copied by :ref:`base2ad-name` .
+
+Zero Order Forward
+******************
+The first zero order forward calculation after *parallel* is set
+groups the operations in *f* into levels.
+The first level contains the operations that only depend on the
+independent variables and parameters, the next level contains the
+operations that only depend on the previous level, and so on.
+A level that has enough operations is divided into tasks,
+each task is a contiguous block of operations,
+and the tasks are executed using *parallel* .
+The other levels are evaluated by the calling thread.
+Each operation is evaluated the same way as when
+*parallel* is null, so the results are identical
+(including the :ref:`compare_change-name` results).
+
+First Order Reverse
+*******************
+If *mode* is not ``none`` , the first ``Reverse`` (1, *w* ) calculation
+that uses *parallel* groups the operations in *f* into reverse levels.
+The operations in a reverse level are evaluated in parallel
+after the operations in the previous reverse levels; i.e.,
+the operations that use their results.
+If a variable is used by more than one operation, each use has its own
+copy of the variable's partial derivative, and these operations can be
+in the same level.
+The copies are added to the variable's partial after the operations
+that use it are complete.
+(This is not done for a variable *x* that is used by ``pow`` ( *x* , *y* )
+where *y* is a parameter.)
+
+deterministic
+=============
+Each use of a variable by an operation has its own copy
+of the variable's partial.
+The copies are added in the same order as when *mode* is ``none`` ,
+hence the results are identical provided that the compiler does not
+contract a multiply followed by an add into one fused multiply-add.
+(When *mode* is ``none`` , the product of a partial and a derivative
+is added directly to the partial and may be contracted. In this mode,
+the product is rounded when it is stored in a copy.)
+For example, g++ contracts by default when the target has a fused
+multiply-add instruction; e.g., ``-march=native`` on most current systems.
+Use the ``-ffp-contract=off`` compiler flag to get identical results.
+
+accumulate
+==========
+Each task that uses a variable has its own copy of the variable's partial,
+so less memory is used than for ``deterministic`` .
+The copies are summed, in task order, after the tasks for the level complete.
+The tasks do not depend on the number of threads, so the results are
+the same for each evaluation.
+Because the partials are summed in a different order, they may differ
+by roundoff from the results when *mode* is ``none`` .
+
+Sequential Evaluation
+*********************
+The operations are evaluated one at a time if *f* is called
+in parallel mode, or if *f* contains
+:ref:`VecAD-name` operations,
+:ref:`atomic functions<atomic-name>` ,
+:ref:`discrete functions<Discrete-name>` ,
+:ref:`PrintFor-name` operations, or
+conditional skip operations
+(see the :ref:`optimize@options@no_conditional_skip` option),
+or if less than half of its operations are in levels that are
+large enough to be divided into tasks.
+
+Memory
+******
+The levels are computed once for each operation sequence and take about
+16 bytes per operation for zero order forward and the same amount for
+first order reverse.
+If there are variables that are used by more than one operation,
+a copy of the argument indices is also stored and
+each ``Reverse`` (1, *w* ) calculation uses temporary copies of
+the zero order Taylor coefficients and the partials.
+This memory is only allocated when *parallel* is not null.
+
+Example
+*******
+{xrst_toc_hidden
+    example/general/fun_parallel_for.cpp
+}
+The file :ref:`fun_parallel_for.cpp-name`
+contains an example and test of this operation.
+
+{xrst_end fun_parallel_for}
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file fun_parallel_for.hpp
+Set the routine used to execute sweep tasks in parallel.
+*/
+
+/*!
+Set the routine used to execute sweep tasks in parallel.
+
+\param parallel
+is the user routine that executes the tasks (null for no parallel sweeps).
+*/
+// BEGIN_PROTOTYPE
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::parallel_for(parallel_for_type parallel)
+// END_PROTOTYPE
+{   CPPAD_ASSERT_KNOWN(
+        ! thread_alloc::in_parallel() ,
+        "ADFun: parallel_for cannot be called in parallel mode."
+    );
+    parallel_for_ = parallel;
+}
+/*!
+Set how first order reverse mode uses the parallel_for routine.
+
+\param mode
+is "none", "deterministic", or "accumulate".
+*/
+// BEGIN_REVERSE_PROTOTYPE
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::parallel_reverse(const std::string& mode)
+// END_REVERSE_PROTOTYPE
+{   CPPAD_ASSERT_KNOWN(
+        ! thread_alloc::in_parallel() ,
+        "ADFun: parallel_reverse cannot be called in parallel mode."
+    );
+    CPPAD_ASSERT_KNOWN(
+        mode == "none" || mode == "deterministic" || mode == "accumulate" ,
+        "ADFun: parallel_reverse: mode is not "
+        "none, deterministic, or accumulate"
+    );
+    parallel_reverse_ = mode;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
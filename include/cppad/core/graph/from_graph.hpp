@@ -2,7 +2,7 @@
 # define CPPAD_CORE_GRAPH_FROM_GRAPH_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cppad/core/ad_fun.hpp>
@@ -95,8 +95,20 @@ and have the same order as in the graph.
 The next *n_false* independent variables in *fun*
 correspond to the false components of *var2dyn*
 and have the same order as in the graph.
+
+Method
+******
+The graph operators are translated directly to the operators and
+arguments in the operation sequence for *fun* ;
+i.e., no ``AD`` < *Base* > operations are recorded.
+The sizes in *graph_obj* are used to allocate the memory for the
+operation sequence before the translation starts
+(except for the extra memory needed by some operators; e.g., atomic functions).
+The program :ref:`from_graph_speed.cpp-name` times this routine.
+
 {xrst_toc_hidden
     example/graph/switch_var_dyn.cpp
+    speed/example/from_graph_speed.cpp
 }
 Examples
 ********
@@ -159,11 +171,19 @@ void CppAD::ADFun<Base,RecBase>::from_graph(
     size_t start_constant    = start_independent + n_variable_ind;
     size_t start_operator    = start_constant    + n_constant;
 # endif
+    size_t start_operator_node = 1 + n_dynamic_ind + n_variable_ind + n_constant;
+    //
+    // n_node
+    // number of nodes if there are no atomic functions
+    size_t n_node = start_operator_node + n_usage;
     //
     // initialize mappings from node index as empty
     // (there is no node zero)
-    vector<ad_type_enum>        node_type( 1 );
-    local::pod_vector<addr_t>   node2fun( 1 );
+    // resize then resize to one so there is space for n_node values
+    vector<ad_type_enum>        node_type( n_node );
+    local::pod_vector<addr_t>   node2fun( n_node );
+    node_type.resize(1);
+    node2fun.resize(1);
     node_type[0] = number_ad_type_enum; // invalid value
     node2fun[0]  = 0;                   // invalid value
     //
@@ -247,6 +267,16 @@ void CppAD::ADFun<Base,RecBase>::from_graph(
     // start a recording
     local::recorder<Base> rec;
     CPPAD_ASSERT_UNKNOWN( rec.num_var_op() == 0 );
+    //
+    // The graph operators are translated directly to the operators and
+    // arguments in the recording (there is no AD<Base> recording), so
+    // their sizes are known up to the extra operators and arguments
+    // needed by some graph operators; e.g., atomic and sum.
+    rec.reserve(
+        n_usage + n_variable_ind + n_dynamic_ind + n_dependent + 2 ,
+        graph_obj.operator_arg_size() + n_dependent + 1            ,
+        start_operator_node
+    );
     rec.set_n_dyn_independent(n_dynamic_ind_fun);
     rec.set_abort_op_index(0);
     rec.set_record_compare(false);
@@ -450,17 +480,14 @@ void CppAD::ADFun<Base,RecBase>::from_graph(
             bool dyn_left  = type_x[0] == dynamic_enum;
             bool dyn_right = type_x[1] == dynamic_enum;
             //
+            // ax is not part of an AD<Base> recording, it is only used to
+            // pass the recording index or the value of a constant to rec
             ax.resize(n_arg);
-            // ax[0]
-            if( var_left | dyn_left )
-                ax[0].taddr_ = arg[0];
-            else
-                ax[0].value_ = parameter_x[0];
-            // ax[1]
-            if( var_right | dyn_right )
-                ax[1].taddr_ = arg[1];
-            else
-                ax[1].value_ = parameter_x[1];
+            for(size_t j = 0; j < 2; ++j)
+            {   ax[j].taddr_ = arg[j];
+                if( type_x[j] == constant_enum )
+                    ax[j].value_ = parameter[ arg[j] ];
+            }
             //
             bool result;
             switch( op_enum )
@@ -1535,6 +1562,7 @@ void CppAD::ADFun<Base,RecBase>::from_graph(
     // for_jac_sparse_pack_, for_jac_sparse_set_
     for_jac_sparse_pack_.resize(0, 0);
     for_jac_sparse_set_.resize(0,0);
+    sparsity_cache_.clear();
     //
     // resize subgraph_info_
     subgraph_info_.resize(
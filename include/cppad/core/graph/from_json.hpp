@@ -2,7 +2,7 @@
 # define CPPAD_CORE_GRAPH_FROM_JSON_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cppad/core/ad_fun.hpp>
@@ -19,6 +19,8 @@ Syntax
 ******
 | |tab| ``ADFun`` < *Base* > *fun*
 | |tab| *fun* . ``from_json`` ( *json* )
+| |tab| *fun* . ``from_json`` ( *json* , *size* )
+| |tab| *fun* . ``from_json`` ( *is* )
 
 Prototype
 *********
@@ -26,10 +28,35 @@ Prototype
     // BEGIN_PROTOTYPE
     // END_PROTOTYPE
 }
+{xrst_literal
+    // BEGIN_PROTOTYPE_SIZE
+    // END_PROTOTYPE_SIZE
+}
+{xrst_literal
+    // BEGIN_PROTOTYPE_STREAM
+    // END_PROTOTYPE_STREAM
+}
 
 json
 ****
 is a :ref:`json_ad_graph-name` .
+If *size* is present, *json* is a ``const char*`` and
+the graph is the characters
+*json* [ *i* ] for *i* = 0 , ... , *size* - 1 ;
+e.g., the contents of a memory mapped file.
+In this case, the characters are not copied.
+
+is
+**
+The graph is read from this ``std::istream`` one chunk at a time
+while it is being parsed.
+This avoids having the entire Json graph in memory
+at the same time as the corresponding :ref:`cpp_ad_graph-name` .
+
+Speed
+*****
+The program :ref:`from_json_speed.cpp-name` compares the speed of
+reading a large graph using each of the syntaxes above.
 
 Base
 ****
@@ -41,6 +68,7 @@ RecBase
 in the prototype above, *RecBase* is the same type as *Base* .
 {xrst_toc_hidden
     example/json/from_json.cpp
+    speed/example/from_json_speed.cpp
 }
 Example
 *******
@@ -67,5 +95,23 @@ void CppAD::ADFun<Base,RecBase>::from_json(const std::string& json)
     //
     return;
 }
+// BEGIN_PROTOTYPE_SIZE
+template <class Base, class RecBase>
+void CppAD::ADFun<Base,RecBase>::from_json(const char* json, size_t size)
+// END_PROTOTYPE_SIZE
+{   cpp_graph graph_obj;
+    local::graph::json_parser(json, size, graph_obj);
+    from_graph(graph_obj);
+    return;
+}
+// BEGIN_PROTOTYPE_STREAM
+template <class Base, class RecBase>
+void CppAD::ADFun<Base,RecBase>::from_json(std::istream& is)
+// END_PROTOTYPE_STREAM
+{   cpp_graph graph_obj;
+    local::graph::json_parser(is, graph_obj);
+    from_graph(graph_obj);
+    return;
+}
 
 # endif
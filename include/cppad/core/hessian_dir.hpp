@@ -0,0 +1,252 @@
+# ifndef CPPAD_CORE_HESSIAN_DIR_HPP
+# define CPPAD_CORE_HESSIAN_DIR_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin HessianDir}
+{xrst_spell
+    hv
+}
+
+Hessian Using Multiple Forward Directions
+#########################################
+
+Syntax
+******
+| *hes* = *f* . ``HessianDir`` ( *x* , *w* , *r* )
+| *hv* = *f* . ``HessianDir`` ( *x* , *w* , *v* , *r* )
+
+Purpose
+*******
+We use :math:`F : \B{R}^n \rightarrow \B{R}^m` to denote the
+:ref:`glossary@AD Function` corresponding to *f* and define
+
+.. math::
+
+    H(x) = \dpow{2}{x} \sum_{i=0}^{m-1} w_i F_i (x)
+
+The first syntax sets *hes* to :math:`H(x)` ,
+the second sets *hv* to the product :math:`H(x) V` .
+
+Method
+******
+The routine :ref:`Hessian-name` uses a first order forward sweep and
+a second order reverse sweep for each column of the Hessian.
+This routine records the gradient
+
+.. math::
+
+    G(x) = \R{grad} \left[ \sum_{i=0}^{m-1} w_i F_i (x) \right]
+
+using :ref:`base2ad-name` and reverse mode, :ref:`optimizes<optimize-name>`
+this recording,
+and then uses :ref:`Forward(1, r, xq)<forward_dir-name>` to compute
+*r* columns of :math:`G^{(1)} (x) = H(x)` during each forward sweep.
+This reduces the number of sweeps of an operation sequence from
+:math:`2 n` to one reverse sweep plus about :math:`n / r` forward sweeps.
+This can be much faster than ``Hessian`` for dense Hessians.
+
+f
+*
+The object *f* has prototype
+
+    ``const ADFun`` < *Base* > *f*
+
+The :ref:`Taylor coefficients<glossary@Taylor Coefficient>`
+stored in *f* are not affected by this operation.
+If *f* has :ref:`glossary@Parameter@Dynamic` parameters,
+their current values are used.
+The restrictions for :ref:`base2ad-name` also apply to *f* .
+
+x
+*
+The argument *x* has prototype
+
+    ``const`` *BaseVector* & *x*
+
+and its size must be equal to *n* , the dimension of the
+:ref:`fun_property@Domain` space for *f* .
+It specifies that point at which to evaluate the Hessian.
+
+w
+*
+The argument *w* has prototype
+
+    ``const`` *BaseVector* & *w*
+
+and its size must be equal to *m* , the dimension of the
+:ref:`fun_property@Range` space for *f* .
+
+v
+*
+If the argument *v* is present, it has prototype
+
+    ``const`` *BaseVector* & *v*
+
+and its size is :math:`n * k` for some positive integer *k* .
+It is a row major representation of the :math:`n \times k` matrix
+:math:`V` ; i.e., :math:`V_{j, \ell} = v [ j * k + \ell ]` .
+
+r
+*
+The argument *r* has prototype
+
+    ``size_t`` *r*
+
+and is greater than zero.
+It is the number of directions that are computed with each forward sweep.
+Larger values of *r* use more memory
+(the memory for Taylor coefficients is proportional to *r* ).
+Values between 8 and 32 often work well.
+
+hes
+***
+The result *hes* has prototype
+
+    *BaseVector* *hes*
+
+and its size is :math:`n * n`.
+For :math:`j = 0 , \ldots , n - 1`
+and :math:`\ell = 0 , \ldots , n - 1`
+
+.. math::
+
+    hes [ j * n + \ell ] = \DD{ w^{\R{T}} F }{ x_j }{ x_\ell } ( x )
+
+hv
+**
+The result *hv* has prototype
+
+    *BaseVector* *hv*
+
+and its size is :math:`n * k`.
+It is a row major representation of the :math:`n \times k` matrix
+:math:`H(x) V` .
+
+BaseVector
+**********
+The type *BaseVector* must be a :ref:`SimpleVector-name` class with
+:ref:`elements of type<SimpleVector@Elements of Specified Type>`
+*Base* .
+
+Restriction
+***********
+This routine records ``AD`` < *Base* > operations and hence it
+cannot be called while the current thread is recording
+``AD`` < *Base* > operations.
+
+Example
+*******
+{xrst_toc_hidden
+    example/general/hessian_dir.cpp
+}
+The routine :ref:`hessian_dir.cpp-name`
+is an example and test of ``HessianDir`` .
+It returns ``true`` , if it succeeds and ``false`` otherwise.
+
+{xrst_end HessianDir}
+-----------------------------------------------------------------------------
+*/
+
+//  BEGIN CppAD namespace
+namespace CppAD {
+
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::HessianDir(
+    const BaseVector& x ,
+    const BaseVector& w ,
+    size_t            r ) const
+{   size_t n = Domain();
+
+    // v = identity matrix
+    BaseVector v(n * n);
+    for(size_t j = 0; j < n; ++j)
+    {   for(size_t ell = 0; ell < n; ++ell)
+            v[j * n + ell] = Base(0.0);
+        v[j * n + j] = Base(1.0);
+    }
+    return HessianDir(x, w, v, r);
+}
+
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::HessianDir(
+    const BaseVector& x ,
+    const BaseVector& w ,
+    const BaseVector& v ,
+    size_t            r ) const
+{   typedef CppAD::vector< AD<Base> > ad_vector;
+    size_t n = Domain();
+    size_t m = Range();
+
+    // check BaseVector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+
+    CPPAD_ASSERT_KNOWN(
+        size_t(x.size()) == n,
+        "HessianDir: length of x not equal domain dimension for f"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t(w.size()) == m,
+        "HessianDir: length of w not equal range dimension for f"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t(v.size()) % n == 0 && size_t(v.size()) > 0,
+        "HessianDir: length of v is not a positive multiple of n"
+    );
+    CPPAD_ASSERT_KNOWN(
+        r > 0,
+        "HessianDir: number of directions r is zero"
+    );
+    size_t k = size_t(v.size()) / n;
+    r        = std::min(r, k);
+
+    // af
+    ADFun< AD<Base>, RecBase > af = base2ad();
+
+    // g(x; w) = grad[ w^T F(x) ] with w a dynamic parameter vector
+    ad_vector ax(n), aw(m), ag(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = x[j];
+    for(size_t i = 0; i < m; ++i)
+        aw[i] = w[i];
+    CppAD::Independent(ax, aw);
+    af.Forward(0, ax);
+    ag = af.Reverse(1, aw);
+    ADFun<Base, RecBase> g(ax, ag);
+    g.optimize("no_conditional_skip");
+
+    // zero order forward for g at x
+    g.Forward(0, x);
+
+    // return value
+    BaseVector hv(n * k);
+
+    // r columns of V at a time
+    BaseVector xq(n * r), yq(n * r);
+    for(size_t ell_start = 0; ell_start < k; ell_start += r)
+    {   size_t n_col = std::min(r, k - ell_start);
+        for(size_t j = 0; j < n; ++j)
+        {   for(size_t d = 0; d < r; ++d)
+            {   if( d < n_col )
+                    xq[j * r + d] = v[j * k + ell_start + d];
+                else
+                    xq[j * r + d] = Base(0.0);
+            }
+        }
+        yq = g.Forward(1, r, xq);
+        for(size_t j = 0; j < n; ++j)
+        {   for(size_t d = 0; d < n_col; ++d)
+                hv[j * k + ell_start + d] = yq[j * r + d];
+        }
+    }
+    return hv;
+}
+
+} // END CppAD namespace
+
+# endif
@@ -0,0 +1,469 @@
+# ifndef CPPAD_CORE_JAC_SPARSITY_CHUNK_HPP
+# define CPPAD_CORE_JAC_SPARSITY_CHUNK_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin jac_sparsity_chunk}
+
+Jacobian Sparsity Patterns for a Chunk of the Seeds
+###################################################
+
+Syntax
+******
+| *f* . ``for_jac_sparsity_chunk`` (
+| |tab| *pattern_in* , *transpose* , *dependency* , *internal_bool* ,
+| |tab| *chunk_begin* , *chunk_end* , *pattern_out*
+| )
+| *f* . ``rev_jac_sparsity_chunk`` (
+| |tab| *pattern_in* , *transpose* , *dependency* , *internal_bool* ,
+| |tab| *chunk_begin* , *chunk_end* , *pattern_out*
+| )
+
+Purpose
+*******
+The :ref:`for_jac_sparsity-name` and :ref:`rev_jac_sparsity-name` routines
+propagate a set with :math:`\ell` possible elements for every
+variable in the operation sequence.
+If :math:`\ell` is large, the memory for these sets can be very large.
+The routines on this page compute the part of the same result
+that corresponds to the seed indices
+*chunk_begin* , ... , *chunk_end* ``-1`` ;
+i.e., the memory used for each set is proportional to
+*chunk_end* ``-`` *chunk_begin* instead of :math:`\ell` .
+
+Seed Index
+**********
+
+for_jac_sparsity_chunk
+======================
+For this case the seed indices are the column indices of
+:math:`R \in \B{R}^{n \times \ell}` and
+:math:`J(x) = F^{(1)} ( x ) R` ;
+see :ref:`for_jac_sparsity@Purpose` .
+
+rev_jac_sparsity_chunk
+======================
+For this case the seed indices are the row indices of
+:math:`R \in \B{R}^{\ell \times m}` and
+:math:`J(x) = R F^{(1)} ( x )` ;
+see :ref:`rev_jac_sparsity@Purpose` .
+
+f
+*
+The object *f* has prototype
+
+    ``const ADFun`` < *Base* > *f*
+
+Note that, unlike :ref:`for_jac_sparsity-name` ,
+the sparsity patterns for the variables are not stored in *f*
+(so they can not be used by a subsequent
+:ref:`rev_hes_sparsity-name` calculation).
+
+pattern_in, transpose, dependency, internal_bool
+************************************************
+These arguments have the same meaning as for
+:ref:`for_jac_sparsity-name` and :ref:`rev_jac_sparsity-name` .
+Only the entries of *pattern_in* with seed index in the chunk are used.
+
+chunk_begin
+***********
+This argument has prototype
+
+    ``size_t`` *chunk_begin*
+
+It is the first seed index in this chunk.
+
+chunk_end
+*********
+This argument has prototype
+
+    ``size_t`` *chunk_end*
+
+It is one greater than the last seed index in this chunk.
+It must hold that
+
+    *chunk_begin* <= *chunk_end* <= :math:`\ell`
+
+pattern_out
+***********
+This argument has prototype
+
+    ``sparse_rc`` < *SizeVector* >& *pattern_out*
+
+This input value of *pattern_out* does not matter.
+Upon return it has the same dimensions as for the corresponding
+``for_jac_sparsity`` or ``rev_jac_sparsity`` call.
+It contains the entries in that result that have seed index in the chunk
+(and no other entries).
+
+Merging Chunks
+**************
+If the seed indices are partitioned into chunks,
+the result for each chunk contains a different set of entries
+and the union of these entries is the result for all the seeds.
+Hence the chunk results can be merged using
+:ref:`sparse_rc@push_back` .
+
+Parallel Mode
+*************
+These routines do not change *f* and they can be called for the same
+*f* by different threads at the same time; e.g., one chunk per thread.
+Memory is allocated using :ref:`thread_alloc-name` so
+:ref:`parallel_ad-name` must be called before using these routines
+in :ref:`parallel<ta_in_parallel-name>` mode.
+
+Example
+*******
+{xrst_toc_hidden
+    example/sparse/jac_sparsity_chunk.cpp
+}
+The file
+:ref:`jac_sparsity_chunk.cpp-name`
+contains an example and test of this operation.
+
+{xrst_end jac_sparsity_chunk}
+-----------------------------------------------------------------------------
+*/
+# include <cppad/core/ad_fun.hpp>
+# include <cppad/local/sparse/internal.hpp>
+# include <cppad/local/sparse/chunk.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+/*!
+Forward Jacobian sparsity patterns for a chunk of the columns of R.
+
+\tparam Base
+is the base type for this recording.
+
+\tparam SizeVector
+is the simple vector with elements of type size_t that is used for
+row, column index sparsity patterns.
+
+\param pattern_in
+is the sparsity pattern for for R or R^T depending on transpose.
+
+\param transpose
+Is the input and returned sparsity pattern transposed.
+
+\param dependency
+Are the derivatives with respect to left and right of the expression below
+considered to be non-zero:
+\code
+    CondExpRel(left, right, if_true, if_false)
+\endcode
+
+\param internal_bool
+If this is true, calculations are done with sets represented by a vector
+of boolean values. Otherwise, a vector of standard sets is used.
+
+\param chunk_begin
+is the first column of R in this chunk.
+
+\param chunk_end
+is one greater than the last column of R in this chunk.
+
+\param pattern_out
+The value of transpose is false (true),
+the return value is the sparsity pattern for the columns
+chunk_begin, ... , chunk_end-1 of J(x) ( rows of J(x)^T ) where
+\f[
+    J(x) = F^{(1)} (x) * R
+\f]
+Here F is the function corresponding to the operation sequence
+and x is any argument value.
+*/
+template <class Base, class RecBase>
+template <class SizeVector>
+void ADFun<Base,RecBase>::for_jac_sparsity_chunk(
+    const sparse_rc<SizeVector>& pattern_in       ,
+    bool                         transpose        ,
+    bool                         dependency       ,
+    bool                         internal_bool    ,
+    size_t                       chunk_begin      ,
+    size_t                       chunk_end        ,
+    sparse_rc<SizeVector>&       pattern_out      ) const
+{
+    // used to identify the RecBase type in calls to sweeps
+    RecBase not_used_rec_base(0.0);
+    //
+    // number or rows, columns in pattern_in
+    size_t n   = pattern_in.nr();
+    size_t ell = pattern_in.nc();
+    if( transpose )
+        std::swap(n, ell);
+    //
+    CPPAD_ASSERT_KNOWN(
+        n == Domain() ,
+        "for_jac_sparsity_chunk: number rows in R "
+        "is not equal number of independent variables."
+    );
+    CPPAD_ASSERT_KNOWN(
+        chunk_begin <= chunk_end && chunk_end <= ell ,
+        "for_jac_sparsity_chunk: chunk_begin > chunk_end or "
+        "chunk_end > number columns in R"
+    );
+    //
+    // seed_is_row
+    // the seeds are the columns of R and J(x)
+    bool seed_is_row = transpose;
+    //
+    // chunk_in
+    sparse_rc<SizeVector> chunk_in;
+    local::sparse::get_chunk_pattern(
+        seed_is_row, chunk_begin, chunk_end, pattern_in, chunk_in
+    );
+    size_t ell_chunk = chunk_end - chunk_begin;
+    //
+    // empty chunk
+    if( ell_chunk == 0 )
+    {   size_t m = Range();
+        if( transpose )
+            pattern_out.resize(ell, m, 0);
+        else
+            pattern_out.resize(m, ell, 0);
+        return;
+    }
+    //
+    // chunk_out
+    sparse_rc<SizeVector> chunk_out;
+    bool zero_empty  = true;
+    bool input_empty = true;
+    if( internal_bool )
+    {   // allocate memory for bool sparsity calculation
+        // (sparsity pattern is empty after a resize)
+        local::sparse::pack_setvec internal_jac;
+        internal_jac.resize(num_var_tape_, ell_chunk);
+        //
+        // set sparsity pattern for independent variables
+        local::sparse::set_internal_pattern(
+            zero_empty            ,
+            input_empty           ,
+            transpose             ,
+            ind_taddr_            ,
+            internal_jac          ,
+            chunk_in
+        );
+
+        // compute sparsity for other variables
+        local::sweep::for_jac(
+            &play_,
+            dependency,
+            n,
+            num_var_tape_,
+            internal_jac,
+            not_used_rec_base
+        );
+        // get the output pattern
+        local::sparse::get_internal_pattern(
+            transpose, dep_taddr_, internal_jac, chunk_out
+        );
+    }
+    else
+    {   // allocate memory for set sparsity calculation
+        // (sparsity pattern is empty after a resize)
+        local::sparse::list_setvec internal_jac;
+        internal_jac.resize(num_var_tape_, ell_chunk);
+        //
+        // set sparsity pattern for independent variables
+        local::sparse::set_internal_pattern(
+            zero_empty            ,
+            input_empty           ,
+            transpose             ,
+            ind_taddr_            ,
+            internal_jac          ,
+            chunk_in
+        );
+
+        // compute sparsity for other variables
+        local::sweep::for_jac(
+            &play_,
+            dependency,
+            n,
+            num_var_tape_,
+            internal_jac,
+            not_used_rec_base
+        );
+        // get the output pattern
+        local::sparse::get_internal_pattern(
+            transpose, dep_taddr_, internal_jac, chunk_out
+        );
+    }
+    // pattern_out
+    local::sparse::set_chunk_pattern(
+        seed_is_row, chunk_begin, ell, chunk_out, pattern_out
+    );
+    return;
+}
+
+/*!
+Reverse Jacobian sparsity patterns for a chunk of the rows of R.
+
+\tparam Base
+is the base type for this recording.
+
+\tparam SizeVector
+is the simple vector with elements of type size_t that is used for
+row, column index sparsity patterns.
+
+\param pattern_in
+is the sparsity pattern for for R or R^T depending on transpose.
+
+\param transpose
+Is the input and returned sparsity pattern transposed.
+
+\param dependency
+Are the derivatives with respect to left and right of the expression below
+considered to be non-zero:
+\code
+    CondExpRel(left, right, if_true, if_false)
+\endcode
+
+\param internal_bool
+If this is true, calculations are done with sets represented by a vector
+of boolean values. Otherwise, a vector of standard sets is used.
+
+\param chunk_begin
+is the first row of R in this chunk.
+
+\param chunk_end
+is one greater than the last row of R in this chunk.
+
+\param pattern_out
+The value of transpose is false (true),
+the return value is the sparsity pattern for the rows
+chunk_begin, ... , chunk_end-1 of J(x) ( columns of J(x)^T ) where
+\f[
+    J(x) = R * F^{(1)} (x)
+\f]
+Here F is the function corresponding to the operation sequence
+and x is any argument value.
+*/
+template <class Base, class RecBase>
+template <class SizeVector>
+void ADFun<Base,RecBase>::rev_jac_sparsity_chunk(
+    const sparse_rc<SizeVector>& pattern_in       ,
+    bool                         transpose        ,
+    bool                         dependency       ,
+    bool                         internal_bool    ,
+    size_t                       chunk_begin      ,
+    size_t                       chunk_end        ,
+    sparse_rc<SizeVector>&       pattern_out      ) const
+{
+    // used to identify the RecBase type in calls to sweeps
+    RecBase not_used_rec_base(0.0);
+    //
+    // number or rows, columns in pattern_in
+    size_t ell = pattern_in.nr();
+    size_t m   = pattern_in.nc();
+    if( transpose )
+        std::swap(ell, m);
+    //
+    CPPAD_ASSERT_KNOWN(
+        m == Range() ,
+        "rev_jac_sparsity_chunk: number columns in R "
+        "is not equal number of dependent variables."
+    );
+    CPPAD_ASSERT_KNOWN(
+        chunk_begin <= chunk_end && chunk_end <= ell ,
+        "rev_jac_sparsity_chunk: chunk_begin > chunk_end or "
+        "chunk_end > number rows in R"
+    );
+    // number of independent variables
+    size_t n = Domain();
+    //
+    // seed_is_row
+    // the seeds are the rows of R and J(x)
+    bool seed_is_row = ! transpose;
+    //
+    // chunk_in
+    sparse_rc<SizeVector> chunk_in;
+    local::sparse::get_chunk_pattern(
+        seed_is_row, chunk_begin, chunk_end, pattern_in, chunk_in
+    );
+    size_t ell_chunk = chunk_end - chunk_begin;
+    //
+    // empty chunk
+    if( ell_chunk == 0 )
+    {   if( transpose )
+            pattern_out.resize(n, ell, 0);
+        else
+            pattern_out.resize(ell, n, 0);
+        return;
+    }
+    //
+    // chunk_out
+    sparse_rc<SizeVector> chunk_out;
+    bool zero_empty  = true;
+    bool input_empty = true;
+    if( internal_bool )
+    {   // allocate memory for bool sparsity calculation
+        // (sparsity pattern is empty after a resize)
+        local::sparse::pack_setvec internal_jac;
+        internal_jac.resize(num_var_tape_, ell_chunk);
+        //
+        // set sparsity pattern for dependent variables
+        local::sparse::set_internal_pattern(
+            zero_empty            ,
+            input_empty           ,
+            ! transpose           ,
+            dep_taddr_            ,
+            internal_jac          ,
+            chunk_in
+        );
+
+        // compute sparsity for other variables
+        local::sweep::rev_jac(
+            &play_,
+            dependency,
+            n,
+            num_var_tape_,
+            internal_jac,
+            not_used_rec_base
+        );
+        // get sparstiy pattern for independent variables
+        local::sparse::get_internal_pattern(
+            ! transpose, ind_taddr_, internal_jac, chunk_out
+        );
+    }
+    else
+    {   // allocate memory for set sparsity calculation
+        // (sparsity pattern is empty after a resize)
+        local::sparse::list_setvec internal_jac;
+        internal_jac.resize(num_var_tape_, ell_chunk);
+        //
+        // set sparsity pattern for dependent variables
+        local::sparse::set_internal_pattern(
+            zero_empty            ,
+            input_empty           ,
+            ! transpose           ,
+            dep_taddr_            ,
+            internal_jac          ,
+            chunk_in
+        );
+
+        // compute sparsity for other variables
+        local::sweep::rev_jac(
+            &play_,
+            dependency,
+            n,
+            num_var_tape_,
+            internal_jac,
+            not_used_rec_base
+        );
+        // get sparstiy pattern for independent variables
+        local::sparse::get_internal_pattern(
+            ! transpose, ind_taddr_, internal_jac, chunk_out
+        );
+    }
+    // pattern_out
+    local::sparse::set_chunk_pattern(
+        seed_is_row, chunk_begin, ell, chunk_out, pattern_out
+    );
+    return;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
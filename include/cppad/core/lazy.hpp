@@ -0,0 +1,424 @@
+# ifndef CPPAD_CORE_LAZY_HPP
+# define CPPAD_CORE_LAZY_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin lazy}
+
+Lazy Recording of AD Sums and Differences
+#########################################
+
+Syntax
+******
+| *e* = ``lazy`` ( *x* )
+| *e* = *left* *op* *right*
+| *e* = *op* *right*
+| ``AD`` < *Base* > *z* ( *e* )
+| *z* = *e*
+
+Purpose
+*******
+The expression ``a * b + c * d - e`` , using ``AD`` < *Base* > objects,
+records a multiplication, a multiplication, an addition, and a subtraction.
+The expression ``lazy(a) * b + lazy(c) * d - e``
+builds an expression template at compile time and records the operations
+when it is converted to an ``AD`` < *Base* > object.
+At that point, all the terms in a sum (or difference) are recorded
+as one cumulative summation operator
+(the same operator that :ref:`optimize-name` uses for sums).
+This results in a smaller tape and less recording time;
+see :ref:`lazy@Sums` below.
+
+x
+*
+The argument *x* has prototype
+
+    ``const AD`` < *Base* >& *x*
+
+e
+*
+The result *e* is an expression template for an ``AD`` < *Base* > value.
+Its type depends on the expression and is not specified.
+It should only be used as an operand in another expression,
+or to construct (or assign to) an ``AD`` < *Base* > object.
+In particular, it should not be stored using ``auto`` .
+
+op
+**
+The binary operator *op* is
+``+`` , ``-`` , ``*`` , or ``/`` .
+One of its operands must be an expression template,
+the other operand can be an expression template,
+an ``AD`` < *Base* > object, or a *Base* object.
+The unary operator *op* is ``+`` or ``-`` ,
+and its operand must be an expression template.
+
+z
+*
+The result *z* is an ``AD`` < *Base* > object.
+Constructing or assigning *z* from *e* records the
+operations in the expression (if *Base* operations are being recorded).
+An expression template can also be passed to a function
+that has an ``const AD`` < *Base* >& argument,
+but not to a function that is templated on *Base*
+(use ``AD`` < *Base* >( *e* ) in this case).
+
+Sums
+****
+The operands of the ``+`` , ``-`` and unary ``-`` operators
+in an expression template are collected into a list of terms.
+The other operators and the ``AD`` < *Base* > operands are terms.
+If at least two of the terms are variables,
+and at least three of the terms are variables or
+:ref:`dynamic parameters<glossary@Parameter@Dynamic>` ,
+the sum is recorded using one cumulative summation operator
+(and the constant terms are added together when the sum is recorded).
+Otherwise, the terms are added using the normal ``AD`` < *Base* >
+operations.
+The value of a sum is computed from left to right in the order of its terms;
+e.g., ``lazy(a) - (b - c)`` is computed as ``a - b + c`` .
+Hence it may differ (by rounding) from the value using
+``AD`` < *Base* > operations.
+
+{xrst_toc_hidden
+    example/general/lazy.cpp
+}
+Example
+*******
+The file :ref:`lazy.cpp-name`
+contains an example and test of these operations.
+
+{xrst_end lazy}
+-------------------------------------------------------------------------------
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+// lazy_ad
+template <class Base, class Node>
+class lazy_ad {
+private:
+    // root of the expression tree
+    Node node_;
+public:
+    // type of the value corresponding to this expression
+    typedef Base value_type;
+    //
+    // constructor
+    explicit lazy_ad(const Node& node) : node_(node)
+    { }
+    // node
+    const Node& node(void) const
+    {   return node_; }
+};
+
+namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+/*!
+Records a sum of AD<Base> terms.
+
+\tparam Base
+is the base type for the terms in the sum.
+*/
+template <class Base>
+class lazy_record {
+private:
+    // type of x for the tape with identifier tape_id
+    static ad_type_enum type(tape_id_t tape_id, const AD<Base>& x)
+    {   if( tape_id == 0 || x.tape_id_ != tape_id )
+            return constant_enum;
+        return x.ad_type_;
+    }
+public:
+    /*!
+    Compute a sum of terms and record it on the current tape.
+
+    \param n
+    is the number of terms in the sum.
+
+    \param term
+    term[k] is the k-th term in the sum.
+
+    \param neg
+    If neg[k] is true (false), term[k] is subtracted from (added to) the sum.
+
+    \return
+    is the sum of the terms (computed from left to right).
+    If a tape is recording AD<Base> operations,
+    at least two of the terms are variables,
+    and at least three terms are variables or dynamic parameters,
+    the sum is recorded using a CSumOp operator.
+    Otherwise, it is computed using AD<Base> operations.
+    */
+    static AD<Base> sum(size_t n, const AD<Base>* term, const bool* neg)
+    {   CPPAD_ASSERT_UNKNOWN( n > 0 );
+        //
+        // tape_id
+        local::ADTape<Base>* tape    = AD<Base>::tape_ptr();
+        tape_id_t            tape_id = 0;
+        if( tape != nullptr )
+            tape_id = tape->id_;
+        //
+        // n1, n2, n3, n4: number of terms for each part of CSumOp
+        size_t n1 = 0, n2 = 0, n3 = 0, n4 = 0;
+        for(size_t k = 0; k < n; ++k)
+        {   switch( type(tape_id, term[k]) )
+            {   case variable_enum:
+                if( neg[k] )
+                    ++n2;
+                else
+                    ++n1;
+                break;
+                //
+                case dynamic_enum:
+                if( neg[k] )
+                    ++n4;
+                else
+                    ++n3;
+                break;
+                //
+                default:
+                break;
+            }
+        }
+        //
+        // use AD<Base> operations
+        if( n1 + n2 < 2 || n1 + n2 + n3 + n4 < 3 )
+        {   AD<Base> result = term[0];
+            if( neg[0] )
+                result = - term[0];
+            for(size_t k = 1; k < n; ++k)
+            {   if( neg[k] )
+                    result -= term[k];
+                else
+                    result += term[k];
+            }
+            return result;
+        }
+        //
+        // value, constant
+        Base value    = Base(0);
+        Base constant = Base(0);
+        for(size_t k = 0; k < n; ++k)
+        {   if( neg[k] )
+                value -= term[k].value_;
+            else
+                value += term[k].value_;
+            if( type(tape_id, term[k]) == constant_enum )
+            {   if( neg[k] )
+                    constant -= term[k].value_;
+                else
+                    constant += term[k].value_;
+            }
+        }
+        //
+        // record the CSumOp operator
+        local::recorder<Base>& rec = tape->Rec_;
+        addr_t arg0   = rec.put_con_par(constant);
+        addr_t arg1   = addr_t(5 + n1);
+        addr_t arg2   = arg1 + addr_t(n2);
+        addr_t arg3   = arg2 + addr_t(n3);
+        addr_t arg4   = arg3 + addr_t(n4);
+        addr_t i_z    = rec.PutOp(local::CSumOp);
+        rec.PutArg(arg0, arg1, arg2, arg3, arg4);
+        for(size_t part = 0; part < 4; ++part)
+        {   ad_type_enum part_type = variable_enum;
+            if( part >= 2 )
+                part_type = dynamic_enum;
+            bool subtract = part % 2 == 1;
+            for(size_t k = 0; k < n; ++k)
+            {   bool match = type(tape_id, term[k]) == part_type;
+                match     &= neg[k] == subtract;
+                if( match )
+                    rec.PutArg( term[k].taddr_ );
+            }
+        }
+        rec.PutArg(arg4 + 1);
+        CPPAD_ASSERT_UNKNOWN( local::NumRes(local::CSumOp) == 1 );
+        //
+        // result
+        AD<Base> result(value);
+        result.make_variable(tape_id, i_z);
+        return result;
+    }
+};
+/*
+Each of the node classes below has the following members:
+
+n_term:
+is the number of terms that this node adds to a sum.
+
+eval():
+returns the AD<Base> value corresponding to this node
+(recording the corresponding operations).
+
+collect(negate, term, neg, n):
+appends the terms for this node to term[n], neg[n], ... and increments n.
+If negate is true, the terms are subtracted instead of added.
+*/
+// lazy_leaf: an AD<Base> object
+template <class Base>
+class lazy_leaf {
+private:
+    const AD<Base> x_;
+public:
+    static const size_t n_term = 1;
+    //
+    lazy_leaf(const AD<Base>& x) : x_(x)
+    { }
+    AD<Base> eval(void) const
+    {   return x_; }
+    void collect(bool negate, AD<Base>* term, bool* neg, size_t& n) const
+    {   term[n]  = x_;
+        neg[n++] = negate;
+    }
+};
+// lazy_sum: left + right or left - right
+template <class Base, class Left, class Right, bool subtract>
+class lazy_sum {
+private:
+    const Left  left_;
+    const Right right_;
+public:
+    static const size_t n_term = Left::n_term + Right::n_term;
+    //
+    lazy_sum(const Left& left, const Right& right)
+    : left_(left), right_(right)
+    { }
+    AD<Base> eval(void) const
+    {   AD<Base> term[n_term];
+        bool     neg[n_term];
+        size_t   n = 0;
+        collect(false, term, neg, n);
+        CPPAD_ASSERT_UNKNOWN( n == n_term );
+        return lazy_record<Base>::sum(n, term, neg);
+    }
+    void collect(bool negate, AD<Base>* term, bool* neg, size_t& n) const
+    {   left_.collect(negate, term, neg, n);
+        right_.collect(negate != subtract, term, neg, n);
+    }
+};
+// lazy_neg: - right
+template <class Base, class Right>
+class lazy_neg {
+private:
+    const Right right_;
+public:
+    static const size_t n_term = Right::n_term;
+    //
+    lazy_neg(const Right& right) : right_(right)
+    { }
+    AD<Base> eval(void) const
+    {   AD<Base> term[n_term];
+        bool     neg[n_term];
+        size_t   n = 0;
+        collect(false, term, neg, n);
+        CPPAD_ASSERT_UNKNOWN( n == n_term );
+        return lazy_record<Base>::sum(n, term, neg);
+    }
+    void collect(bool negate, AD<Base>* term, bool* neg, size_t& n) const
+    {   right_.collect(! negate, term, neg, n);
+    }
+};
+// lazy_product: left * right or left / right
+template <class Base, class Left, class Right, bool divide>
+class lazy_product {
+private:
+    const Left  left_;
+    const Right right_;
+public:
+    static const size_t n_term = 1;
+    //
+    lazy_product(const Left& left, const Right& right)
+    : left_(left), right_(right)
+    { }
+    AD<Base> eval(void) const
+    {   if( divide )
+            return left_.eval() / right_.eval();
+        return left_.eval() * right_.eval();
+    }
+    void collect(bool negate, AD<Base>* term, bool* neg, size_t& n) const
+    {   term[n]  = eval();
+        neg[n++] = negate;
+    }
+};
+} // END_CPPAD_LOCAL_NAMESPACE
+
+// lazy
+template <class Base>
+lazy_ad< Base, local::lazy_leaf<Base> > lazy(const AD<Base>& x)
+{   typedef local::lazy_leaf<Base> node;
+    return lazy_ad<Base, node>( node(x) );
+}
+
+// construct an AD<Base> object from an expression template
+template <class Base>
+template <class Node>
+AD<Base>::AD(const lazy_ad<Base, Node>& e)
+{   *this = e.node().eval(); }
+
+// assign an expression template to an AD<Base> object
+template <class Base>
+template <class Node>
+AD<Base>& AD<Base>::operator=(const lazy_ad<Base, Node>& e)
+{   *this = e.node().eval();
+    return *this;
+}
+
+// unary operators
+template <class Base, class Node>
+lazy_ad<Base, Node> operator + (const lazy_ad<Base, Node>& right)
+{   return right; }
+template <class Base, class Node>
+lazy_ad< Base, local::lazy_neg<Base, Node> >
+operator - (const lazy_ad<Base, Node>& right)
+{   typedef local::lazy_neg<Base, Node> node;
+    return lazy_ad<Base, node>( node( right.node() ) );
+}
+
+// binary operators
+# define CPPAD_LAZY_BINARY_OPERATOR(Op, Node, flag)                         \
+template <class Base, class Left, class Right>                               \
+lazy_ad< Base, local::Node<Base, Left, Right, flag> > operator Op (          \
+    const lazy_ad<Base, Left>& left, const lazy_ad<Base, Right>& right )     \
+{   typedef local::Node<Base, Left, Right, flag> node;                       \
+    return lazy_ad<Base, node>( node( left.node(), right.node() ) );         \
+}                                                                            \
+template <class Base, class Left>                                            \
+lazy_ad< Base, local::Node<Base, Left, local::lazy_leaf<Base>, flag> >       \
+operator Op (const lazy_ad<Base, Left>& left, const AD<Base>& right )        \
+{   typedef local::Node<Base, Left, local::lazy_leaf<Base>, flag> node;      \
+    return lazy_ad<Base, node>( node( left.node(), right ) );                \
+}                                                                            \
+template <class Base, class Right>                                           \
+lazy_ad< Base, local::Node<Base, local::lazy_leaf<Base>, Right, flag> >      \
+operator Op (const AD<Base>& left, const lazy_ad<Base, Right>& right )       \
+{   typedef local::Node<Base, local::lazy_leaf<Base>, Right, flag> node;     \
+    return lazy_ad<Base, node>( node( left, right.node() ) );                \
+}                                                                            \
+template <class Base, class Left>                                            \
+lazy_ad< Base, local::Node<Base, Left, local::lazy_leaf<Base>, flag> >       \
+operator Op (                                                                \
+    const lazy_ad<Base, Left>&                        left  ,                \
+    const typename lazy_ad<Base, Left>::value_type&   right )                \
+{   typedef local::Node<Base, Left, local::lazy_leaf<Base>, flag> node;      \
+    return lazy_ad<Base, node>( node( left.node(), AD<Base>(right) ) );      \
+}                                                                            \
+template <class Base, class Right>                                           \
+lazy_ad< Base, local::Node<Base, local::lazy_leaf<Base>, Right, flag> >      \
+operator Op (                                                                \
+    const typename lazy_ad<Base, Right>::value_type&  left  ,                \
+    const lazy_ad<Base, Right>&                       right )                \
+{   typedef local::Node<Base, local::lazy_leaf<Base>, Right, flag> node;     \
+    return lazy_ad<Base, node>( node( AD<Base>(left), right.node() ) );      \
+}
+
+CPPAD_LAZY_BINARY_OPERATOR( +, lazy_sum,     false )
+CPPAD_LAZY_BINARY_OPERATOR( -, lazy_sum,     true  )
+CPPAD_LAZY_BINARY_OPERATOR( *, lazy_product, false )
+CPPAD_LAZY_BINARY_OPERATOR( /, lazy_product, true  )
+
+# undef CPPAD_LAZY_BINARY_OPERATOR
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_NEW_DYNAMIC_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 /*
@@ -66,6 +66,30 @@ order zero coefficients (because they may depend on the dynamic parameters).
 In order words;
 :ref:`f.size_order<size_order-name>` returns zero directly after
 *f* . ``new_dynamic`` is called.
+
+Incremental Evaluation
+**********************
+Only the dependent dynamic parameters that depend on
+independent dynamic parameters whose values changed are recomputed
+(dynamic parameters that are results of atomic functions are always
+recomputed).
+In addition, the next zero order :ref:`forward_zero-name` calculation
+only evaluates the variable operations that depend on
+dynamic parameters or independent variables whose values changed
+(atomic function calls, comparisons and print operations are always
+evaluated).
+This does not apply to operation sequences that use
+:ref:`VecAD-name` operations or conditional skip operations
+(see :ref:`optimize@options@no_conditional_skip` ),
+nor to the *Base* = ``AD`` < *RecBase* > case; see :ref:`base2ad-name` .
+
+Sparsity Cache
+**************
+If *f* contains an :ref:`atomic function<atomic-name>` call,
+the patterns in its :ref:`sparsity_cache-name` are removed
+(because an atomic sparsity pattern may depend on the values of its
+parameter arguments).
+
 {xrst_toc_hidden
     example/general/new_dynamic.cpp
 }
@@ -76,6 +100,7 @@ contains an example and test of this operation.
 
 {xrst_end new_dynamic}
 */
+# include <type_traits>
 # include <cppad/local/sweep/dynamic.hpp>
 
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
@@ -109,8 +134,14 @@ void ADFun<Base,RecBase>::new_dynamic(const BaseVector& dynamic)
     const pod_vector<addr_t>&          dyn_par_arg( play_.dyn_par_arg() );
     const pod_vector<addr_t>&     dyn2par_index ( play_.dyn2par_index() );
 
+    // incremental
+    // If Base is AD<RecBase>, the dynamic parameters may be variables
+    // in a recording that is in progress, so they are all recomputed.
+    bool incremental = std::is_same<Base, RecBase>::value;
+
     // set the dependent dynamic parameters
     RecBase not_used_rec_base(0.0);
+    local::pod_vector<bool> par_changed;
     local::sweep::dynamic(
         par_all             ,
         dynamic             ,
@@ -118,12 +149,32 @@ void ADFun<Base,RecBase>::new_dynamic(const BaseVector& dynamic)
         dyn2par_index       ,
         dyn_par_op          ,
         dyn_par_arg         ,
+        incremental         ,
+        par_changed         ,
         not_used_rec_base
     );
 
+    // par_changed_
+    // accumulate the changes since the previous zero order forward
+    if( par_changed_.size() == par_changed.size() )
+    {   for(size_t i = 0; i < par_changed.size(); ++i)
+            par_changed_[i] = par_changed_[i] || par_changed[i];
+    }
+
     // the existing Taylor coefficients are no longer valid
     num_order_taylor_ = 0;
 
+    // sparsity_cache_
+    // the sparsity pattern for an atomic function call may depend on the
+    // value of its parameter arguments; e.g., atomic_three jac_sparsity
+    if( sparsity_cache_.size() > 0 )
+    {   bool has_atomic = false;
+        for(size_t i_op = 0; i_op < play_.num_var_op(); ++i_op)
+            has_atomic |= play_.GetOp(i_op) == local::AFunOp;
+        if( has_atomic )
+            sparsity_cache_.clear();
+    }
+
     return;
 }
 
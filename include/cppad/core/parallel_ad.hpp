@@ -2,7 +2,7 @@
 # define CPPAD_CORE_PARALLEL_AD_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin parallel_ad}
@@ -138,6 +138,8 @@ void parallel_ad(void)
     // statics that depend on the value of Base
     AD<Base>::tape_id_ptr(0);                  // tape_link.hpp
     AD<Base>::tape_handle(0);                  // tape_link.hpp
+    AD<Base>::tape_spare(0);                   // tape_link.hpp
+    AD<Base>::tape_reuse(0);                   // tape_link.hpp
     local::val_graph::enable_parallel<Base>(); // val_graph/*_op.hpp
     discrete<Base>::List();                    // discrete.hpp
 
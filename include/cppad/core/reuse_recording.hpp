@@ -0,0 +1,94 @@
+# ifndef CPPAD_CORE_REUSE_RECORDING_HPP
+# define CPPAD_CORE_REUSE_RECORDING_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin reuse_recording}
+{xrst_spell
+    retaped
+}
+
+Reuse Recording Memory Between Operation Sequences
+##################################################
+
+Syntax
+******
+| ``AD`` < *Base* >:: ``reuse_recording`` ( *reuse* )
+
+Purpose
+*******
+Some functions have control flow that depends on the value of the
+independent variables and must be retaped for each new argument value; e.g.,
+the :ref:`ipopt_solve@options@Retape` option for ``ipopt::solve`` .
+Each recording starts with empty vectors for the operators, arguments, and
+parameters, and these vectors are grown as the operations are recorded.
+If *reuse* is true, the vectors used by one recording are kept,
+after :ref:`Dependent-name` or :ref:`abort_recording-name` ,
+and used by the next call to :ref:`Independent-name` .
+This includes the hash table used to detect duplicate constant parameters.
+
+Dependent
+*********
+The call *f* . ``Dependent`` ( *x* , *y* ) swaps the recorded vectors
+with the vectors that *f* was using for its previous operation sequence.
+Hence, if the same *f* is retaped over and over again,
+the recording vectors already have enough capacity
+and no memory is allocated for them once a steady state is reached.
+
+reuse
+*****
+This argument has prototype
+
+    ``bool`` *reuse*
+
+Its default value (before any call to ``reuse_recording`` ) is false.
+If it is false, the memory that is being kept is returned to
+:ref:`thread_alloc-name` and recordings no longer keep their memory.
+
+Thread
+******
+This setting is for ``AD`` < *Base* > recordings by the current thread; see
+:ref:`thread_num<ta_thread_num-name>` .
+The memory that is kept is in use by the current thread and should be
+freed, by calling ``reuse_recording`` with *reuse* false, before
+checking for memory leaks with :ref:`ta_inuse-name` .
+
+Restriction
+***********
+This routine cannot be called while the current thread is recording
+``AD`` < *Base* > operations.
+{xrst_toc_hidden
+    example/general/reuse_recording.cpp
+}
+Example
+*******
+The file
+:ref:`reuse_recording.cpp-name`
+contains an example and test of this operation.
+
+{xrst_end reuse_recording}
+----------------------------------------------------------------------------
+*/
+
+namespace CppAD {
+    template <class Base>
+    void AD<Base>::reuse_recording(bool reuse)
+    {   CPPAD_ASSERT_KNOWN(
+            AD<Base>::tape_ptr() == nullptr ,
+            "reuse_recording: called while a tape recording is in progress"
+        );
+        size_t thread = thread_alloc::thread_num();
+        *AD<Base>::tape_reuse(thread) = reuse;
+        //
+        // free the tape that is being kept for this thread
+        local::ADTape<Base>** spare_h = AD<Base>::tape_spare(thread);
+        if( ! reuse && *spare_h != nullptr )
+        {   delete *spare_h;
+            *spare_h = nullptr;
+        }
+    }
+}
+
+# endif
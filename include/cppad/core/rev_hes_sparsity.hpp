@@ -2,7 +2,7 @@
 # define CPPAD_CORE_REV_HES_SPARSITY_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin rev_hes_sparsity}
@@ -178,6 +178,20 @@ void ADFun<Base,RecBase>::rev_hes_sparsity(
         "rev_hes_sparsity: size of select_range is not equal to "
         "number of dependent variables"
     );
+    // cache_key
+    // key for this calculation in the sparsity pattern cache
+    local::sparse::pattern_cache::key_type cache_key;
+    if( sparsity_cache_.use() && sparsity_cache_.for_jac_key().size() > 0 )
+    {   cache_key.push_back( local::sparse::pattern_cache::rev_hes_enum );
+        cache_key.push_back( size_t(transpose) );
+        cache_key.push_back( size_t(internal_bool) );
+        local::sparse::pattern_cache::append_select(cache_key, select_range);
+        // this result depends on the previous for_jac_sparsity calculation
+        for(size_t k = 0; k < sparsity_cache_.for_jac_key().size(); ++k)
+            cache_key.push_back( sparsity_cache_.for_jac_key()[k] );
+        if( sparsity_cache_.get(cache_key, pattern_out) )
+            return;
+    }
     //
     // vector that holds reverse Jacobian sparsity flag
     local::pod_vector<bool> rev_jac_pattern(num_var_tape_);
@@ -245,6 +259,9 @@ void ADFun<Base,RecBase>::rev_hes_sparsity(
             transpose, ind_taddr_, internal_hes, pattern_out
         );
     }
+    // store pattern_out in the sparsity pattern cache
+    if( cache_key.size() > 0 )
+        sparsity_cache_.set(cache_key, pattern_out);
     return;
 }
 } // END_CPPAD_NAMESPACE
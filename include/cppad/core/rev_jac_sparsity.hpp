@@ -2,7 +2,7 @@
 # define CPPAD_CORE_REV_JAC_SPARSITY_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin rev_jac_sparsity}
@@ -187,6 +187,19 @@ void ADFun<Base,RecBase>::rev_jac_sparsity(
     // number of independent variables
     size_t n = Domain();
     //
+    // cache_key
+    // key for this calculation in the sparsity pattern cache
+    local::sparse::pattern_cache::key_type cache_key;
+    if( sparsity_cache_.use() )
+    {   cache_key.push_back( local::sparse::pattern_cache::rev_jac_enum );
+        cache_key.push_back( size_t(transpose) );
+        cache_key.push_back( size_t(dependency) );
+        cache_key.push_back( size_t(internal_bool) );
+        local::sparse::pattern_cache::append_pattern(cache_key, pattern_in);
+        if( sparsity_cache_.get(cache_key, pattern_out) )
+            return;
+    }
+    //
     bool zero_empty  = true;
     bool input_empty = true;
     if( internal_bool )
@@ -251,6 +264,9 @@ void ADFun<Base,RecBase>::rev_jac_sparsity(
             ! transpose, ind_taddr_, internal_jac, pattern_out
         );
     }
+    // store pattern_out in the sparsity pattern cache
+    if( cache_key.size() > 0 )
+        sparsity_cache_.set(cache_key, pattern_out);
     return;
 }
 } // END_CPPAD_NAMESPACE
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_REVERSE_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <algorithm>
@@ -154,19 +154,33 @@ BaseVector ADFun<Base,RecBase>::Reverse(size_t q, const BaseVector &w)
     // evaluate the derivatives
     CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_var_op() );
     CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load() );
-    local::play::const_sequential_iterator play_itr = play_.end();
-    local::sweep::reverse(
-        num_var_tape_,
-        &play_,
-        cap_order_taylor_,
-        taylor_.data(),
-        q,
-        Partial.data(),
-        cskip_op_.data(),
-        load_op2var_,
-        play_itr,
-        not_used_rec_base
-    );
+    bool done = false;
+    if( q == 1 && parallel_reverse_ != "none" )
+    {   // use parallel tasks if parallel_for_ is set and play_ is wide enough
+        done = local::sweep::reverse_1_level(
+            &play_,
+            parallel_for_,
+            parallel_reverse_ == "accumulate",
+            cap_order_taylor_,
+            taylor_.data(),
+            Partial.data()
+        );
+    }
+    if( ! done )
+    {   local::play::const_sequential_iterator play_itr = play_.end();
+        local::sweep::reverse(
+            num_var_tape_,
+            &play_,
+            cap_order_taylor_,
+            taylor_.data(),
+            q,
+            Partial.data(),
+            cskip_op_.data(),
+            load_op2var_,
+            play_itr,
+            not_used_rec_base
+        );
+    }
 
     // return the derivative values
     BaseVector value(n * q);
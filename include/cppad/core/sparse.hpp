@@ -2,12 +2,13 @@
 # define CPPAD_CORE_SPARSE_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 //
 # include <cppad/core/for_jac_sparsity.hpp>
 # include <cppad/core/rev_jac_sparsity.hpp>
+# include <cppad/core/jac_sparsity_chunk.hpp>
 //
 # include <cppad/core/for_hes_sparsity.hpp>
 # include <cppad/core/rev_hes_sparsity.hpp>
@@ -2,7 +2,7 @@
 # define CPPAD_CORE_SUBGRAPH_SPARSITY_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin subgraph_sparsity}
@@ -176,6 +176,18 @@ void ADFun<Base,RecBase>::subgraph_sparsity(
     bool                         transpose        ,
     sparse_rc<SizeVector>&       pattern_out      )
 {
+    // cache_key
+    // key for this calculation in the sparsity pattern cache
+    local::sparse::pattern_cache::key_type cache_key;
+    if( sparsity_cache_.use() )
+    {   cache_key.push_back( local::sparse::pattern_cache::subgraph_enum );
+        cache_key.push_back( size_t(transpose) );
+        local::sparse::pattern_cache::append_select(cache_key, select_domain);
+        local::sparse::pattern_cache::append_select(cache_key, select_range);
+        if( sparsity_cache_.get(cache_key, pattern_out) )
+            return;
+    }
+    //
     // compute the sparsity pattern in row, col
     local::pod_vector<size_t> row;
     local::pod_vector<size_t> col;
@@ -239,6 +251,9 @@ void ADFun<Base,RecBase>::subgraph_sparsity(
         for(size_t k = 0; k < nnz; k++)
             pattern_out.set(k, row[k], col[k]);
     }
+    // store pattern_out in the sparsity pattern cache
+    if( cache_key.size() > 0 )
+        sparsity_cache_.set(cache_key, pattern_out);
     return;
 }
 } // END_CPPAD_NAMESPACE
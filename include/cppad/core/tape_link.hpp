@@ -2,7 +2,7 @@
 # define CPPAD_CORE_TAPE_LINK_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cppad/local/define.hpp>
@@ -72,6 +72,59 @@ local::ADTape<Base>** AD<Base>::tape_handle(size_t thread)
     return tape_table + thread;
 }
 
+/*!
+Handle for the tape that is kept, between recordings, for this AD<Base> class
+and the specific thread.
+
+\tparam Base
+is the base type for this AD<Base> class.
+
+\param thread
+is the thread number; i.e.,
+\code
+(! thread_alloc::in_parallel()) || thread == thread_alloc::thread_num()
+\endcode
+
+\return
+is a handle for the tape that tape_manage will use for the next recording
+by this thread. If it is nullptr, a new tape is allocated.
+*/
+template <class Base>
+local::ADTape<Base>** AD<Base>::tape_spare(size_t thread)
+{   CPPAD_ASSERT_FIRST_CALL_NOT_PARALLEL;
+    static local::ADTape<Base>* spare_table[CPPAD_MAX_NUM_THREADS];
+    CPPAD_ASSERT_UNKNOWN(
+        (! thread_alloc::in_parallel()) || thread == thread_alloc::thread_num()
+    );
+    return spare_table + thread;
+}
+
+/*!
+Should the tape for this AD<Base> class and the specific thread be kept
+when a recording is done; see reuse_recording.
+
+\tparam Base
+is the base type for this AD<Base> class.
+
+\param thread
+is the thread number; i.e.,
+\code
+(! thread_alloc::in_parallel()) || thread == thread_alloc::thread_num()
+\endcode
+
+\return
+is a pointer to the reuse flag for this AD<Base> class and thread.
+*/
+template <class Base>
+bool* AD<Base>::tape_reuse(size_t thread)
+{   CPPAD_ASSERT_FIRST_CALL_NOT_PARALLEL;
+    static bool reuse_table[CPPAD_MAX_NUM_THREADS];
+    CPPAD_ASSERT_UNKNOWN(
+        (! thread_alloc::in_parallel()) || thread == thread_alloc::thread_num()
+    );
+    return reuse_table + thread;
+}
+
 /*!
 Pointer for the tape for this AD<Base> class and the current thread.
 
@@ -151,7 +204,7 @@ This argument determines if we are creating a new tape, or deleting an
 old one.
 
 - new_tape_manage :
-Creates and a new tape.
+Creates and a new tape (or uses the tape in <tt>*tape_spare(thread)</tt>).
 It is assumed that there is no tape recording AD<Base> operations
 for this thread when tape_manage is called.
 
@@ -160,6 +213,8 @@ It is assumed that there is a tape recording AD<Base> operations
 for this thread when tape_manage is called.
 The value of <tt>*tape_id_ptr(thread)</tt> will be advanced by
  CPPAD_MAX_NUM_THREADS.
+If <tt>*tape_reuse(thread)</tt> is true, the tape is reset and kept
+in <tt>*tape_spare(thread)</tt>. Otherwise it is deleted.
 
 
 \return
@@ -185,8 +240,15 @@ local::ADTape<Base>*  AD<Base>::tape_manage(tape_manage_enum job)
         // tape for this thread must be null at the start
         CPPAD_ASSERT_UNKNOWN( *tape_h  == nullptr );
 
-        // allocate separate memory to avoid false sharing
-        *tape_h = new local::ADTape<Base>();
+        // use the tape kept by a previous recording, if there is one,
+        // otherwise allocate separate memory to avoid false sharing
+        local::ADTape<Base>** spare_h = tape_spare(thread);
+        if( *spare_h != nullptr )
+        {   *tape_h  = *spare_h;
+            *spare_h = nullptr;
+        }
+        else
+            *tape_h = new local::ADTape<Base>();
 
         // if tape id is zero, initialize it so that
         // thread == tape id % CPPAD_MAX_NUM_THREADS
@@ -208,9 +270,17 @@ local::ADTape<Base>*  AD<Base>::tape_manage(tape_manage_enum job)
     // -----------------------------------------------------------------------
     // delete_tape_manage
     if( job == delete_tape_manage )
-    {   // delete this tape
+    {   // delete this tape, or keep its memory for the next recording
         CPPAD_ASSERT_UNKNOWN( *tape_h  != nullptr );
-        delete *tape_h;
+        if( *tape_reuse(thread) )
+        {   local::ADTape<Base>** spare_h = tape_spare(thread);
+            CPPAD_ASSERT_UNKNOWN( *spare_h == nullptr );
+            (*tape_h)->Rec_.reset();
+            (*tape_h)->size_independent_ = 0;
+            *spare_h = *tape_h;
+        }
+        else
+            delete *tape_h;
         *tape_h = nullptr;
         //
         // advance tape_id so that all AD<Base> variables become parameters
@@ -0,0 +1,465 @@
+# ifndef CPPAD_CORE_TENSOR_DIR_HPP
+# define CPPAD_CORE_TENSOR_DIR_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin TensorDir}
+{xrst_spell
+    griewank
+    utke
+    walther
+}
+
+Derivative Tensors Using Univariate Taylor Interpolation
+########################################################
+
+Syntax
+******
+| *ten* = *f* . ``TensorDir`` ( *x* , *d* , *r* )
+| *ten* = *f* . ``TensorDir`` ( *x* , *s* , *d* , *r* )
+
+Purpose
+*******
+We use :math:`F : \B{R}^n \rightarrow \B{R}^m` to denote the
+:ref:`glossary@AD Function` corresponding to *f* .
+Given a seed matrix :math:`S \in \B{R}^{n \times p}` , we define
+:math:`G : \B{R}^p \rightarrow \B{R}^m` by
+
+.. math::
+
+    G(z) = F( x + S z )
+
+This routine computes all the distinct partial derivatives of :math:`G`
+of order *d* at :math:`z = 0` .
+If *s* is not present, :math:`S` is the identity matrix and these are the
+partials of :math:`F` at *x* .
+If :math:`p < n` , these are contractions of the derivative tensor for
+:math:`F` with the columns of :math:`S` .
+
+Method
+******
+Let :math:`N` be the number of multi-indices :math:`k \in \B{Z}_+^p`
+with :math:`| k | = k_0 + \cdots + k_{p-1} = d` ; i.e.,
+
+.. math::
+
+    N = { p + d - 1 \choose d }
+
+For each such multi-index :math:`k` , the order *d* Taylor coefficient
+of :math:`G(t k)` with respect to :math:`t` is computed using
+:ref:`Forward(q, r, xq)<forward_dir-name>` .
+The partials of order *d* are then recovered from these
+:math:`N` univariate Taylor coefficients using the interpolation scheme of
+Griewank, Utke, and Walther,
+*Evaluating higher derivative tensors by forward propagation of
+univariate Taylor series* , Mathematics of Computation, 2000.
+
+Work and Memory
+***************
+The Taylor coefficients for *r* directions are propagated together.
+Hence, there are :math:`d \lceil N / r \rceil` forward sweeps,
+each of which propagates *r* directions,
+and the total work is about :math:`N d^2 / 2` times the work
+for a zero order forward sweep.
+The Taylor coefficient memory is proportional to :math:`1 + d r`
+times the number of variables in *f* .
+Each partial is a linear combination of at most
+:math:`{ 2 d - 1 \choose d }` of the univariate Taylor coefficients.
+Hence the memory and work for the interpolation is proportional to
+:math:`N` (for a fixed order *d* ).
+Using nested :ref:`base2ad-name` to tape order *d* derivatives,
+the size of the recording grows exponentially with *d* and all
+:math:`p^d` partials (including the duplicates) are computed.
+
+f
+*
+The object *f* has prototype
+
+    ``ADFun`` < *Base* > *f*
+
+After this call, the zero order Taylor coefficients in *f* correspond to
+*f* . ``Forward`` (0, *x* ) and the other coefficients are unspecified.
+
+x
+*
+The argument *x* has prototype
+
+    ``const`` *BaseVector* & *x*
+
+and its size must be equal to *n* , the dimension of the
+:ref:`fun_property@Domain` space for *f* .
+
+s
+*
+If the argument *s* is present, it has prototype
+
+    ``const`` *BaseVector* & *s*
+
+and its size is :math:`n * p` for some positive integer *p* .
+It is a row major representation of the seed matrix :math:`S` ; i.e.,
+:math:`S_{j, \ell} = s [ j * p + \ell ]` .
+
+d
+*
+The argument *d* has prototype
+
+    ``size_t`` *d*
+
+and is greater than zero. It is the order of the partial derivatives.
+
+r
+*
+The argument *r* has prototype
+
+    ``size_t`` *r*
+
+and is greater than zero.
+It is the number of directions that are propagated with each forward sweep.
+
+ten
+***
+The result *ten* has prototype
+
+    *BaseVector* *ten*
+
+and its size is :math:`m * N` .
+We use :math:`a = 0 , \ldots , N-1` to index the
+sequences of indices :math:`0 \leq j_1 \leq \cdots \leq j_d < p`
+in lexicographic order.
+For :math:`i = 0 , \ldots , m-1` and :math:`a = 0 , \ldots , N-1` ,
+
+.. math::
+
+    ten [ i * N + a ] =
+    \frac{ \partial^d G_i }{ \partial z_{j_1} \cdots \partial z_{j_d} } (0)
+
+For example, if :math:`p = 2` and :math:`d = 3` , the sequences are
+(0,0,0), (0,0,1), (0,1,1), (1,1,1) .
+
+BaseVector
+**********
+The type *BaseVector* must be a :ref:`SimpleVector-name` class with
+:ref:`elements of type<SimpleVector@Elements of Specified Type>`
+*Base* .
+
+Example
+*******
+{xrst_toc_hidden
+    example/general/tensor_dir.cpp
+    speed/example/tensor_dir_speed.cpp
+}
+The routine :ref:`tensor_dir.cpp-name`
+is an example and test of ``TensorDir`` .
+It returns ``true`` , if it succeeds and ``false`` otherwise.
+The program :ref:`tensor_dir_speed.cpp-name` compares the speed of
+``TensorDir`` with using nested ``base2ad`` recordings.
+
+{xrst_end TensorDir}
+-----------------------------------------------------------------------------
+*/
+
+//  BEGIN CppAD namespace
+namespace CppAD {
+
+namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+/*!
+Binomial coefficient as a size_t.
+*/
+inline size_t tensor_dir_binomial(size_t n, size_t k)
+{   size_t result = 1;
+    for(size_t t = 1; t <= k; ++t)
+        result = result * (n - k + t) / t;
+    return result;
+}
+/*!
+Advance to the next multi-index with the same order.
+
+\param p
+number of components in the multi-index.
+
+\param k [in,out]
+On input it is a multi-index of order |k| = k[0] + ... + k[p-1].
+Upon return it is the next multi-index in the order corresponding to
+the index sequences j_1 <= ... <= j_|k| in lexicographic order;
+i.e., k[0] decreasing, then k[1] decreasing, ... .
+
+\return
+is false (and k is not changed) if k is the last multi-index.
+*/
+inline bool tensor_dir_next(size_t p, size_t* k)
+{   // move one unit from the last non-zero component before the last
+    // component to its right neighbor and move the last component there too
+    size_t ell = p - 1;
+    while( ell > 0 )
+    {   --ell;
+        if( k[ell] > 0 )
+        {   size_t last = k[p-1];
+            k[p-1]      = 0;
+            k[ell]     -= 1;
+            k[ell+1]    = last + 1;
+            return true;
+        }
+    }
+    return false;
+}
+/*!
+Index of a multi-index in the order used by tensor_dir_next.
+
+\param p
+number of components in the multi-index.
+
+\param d
+order of the multi-index.
+
+\param k
+multi-index with |k| = d.
+*/
+inline size_t tensor_dir_rank(size_t p, size_t d, const size_t* k)
+{   // number of non-decreasing sequences of length L with values in
+    // [v, p-1] is binomial(p - v + L - 1, L)
+    size_t rank = 0;
+    size_t prev = 0;
+    size_t q    = 0;
+    for(size_t ell = 0; ell < p; ++ell)
+    {   for(size_t c = 0; c < k[ell]; ++c)
+        {   ++q;
+            size_t L = d - q;
+            for(size_t v = prev; v < ell; ++v)
+                rank += tensor_dir_binomial(p - v + L - 1, L);
+            prev = ell;
+        }
+    }
+    return rank;
+}
+} // END_CPPAD_LOCAL_NAMESPACE
+
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::TensorDir(
+    const BaseVector& x ,
+    size_t            d ,
+    size_t            r )
+{   size_t n = Domain();
+
+    // s = identity matrix
+    BaseVector s(n * n);
+    for(size_t j = 0; j < n; ++j)
+    {   for(size_t ell = 0; ell < n; ++ell)
+            s[j * n + ell] = Base(0.0);
+        s[j * n + j] = Base(1.0);
+    }
+    return TensorDir(x, s, d, r);
+}
+
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::TensorDir(
+    const BaseVector& x ,
+    const BaseVector& s ,
+    size_t            d ,
+    size_t            r )
+{   size_t n = Domain();
+    size_t m = Range();
+
+    // check BaseVector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+
+    CPPAD_ASSERT_KNOWN(
+        size_t(x.size()) == n,
+        "TensorDir: length of x not equal domain dimension for f"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t(s.size()) % n == 0 && size_t(s.size()) > 0,
+        "TensorDir: length of s is not a positive multiple of n"
+    );
+    CPPAD_ASSERT_KNOWN(
+        d > 0,
+        "TensorDir: order d is zero"
+    );
+    CPPAD_ASSERT_KNOWN(
+        r > 0,
+        "TensorDir: number of directions r is zero"
+    );
+    size_t p = size_t(s.size()) / n;
+    //
+    // multi_index
+    // multi-indices k with |k| = d in the order corresponding to the
+    // index sequences j_1 <= ... <= j_d in lexicographic order
+    CppAD::vector<size_t> multi_index;
+    {   CppAD::vector<size_t> k(p);
+        for(size_t ell = 0; ell < p; ++ell)
+            k[ell] = 0;
+        k[0] = d;
+        do
+        {   for(size_t ell = 0; ell < p; ++ell)
+                multi_index.push_back( k[ell] );
+        } while( local::tensor_dir_next(p, k.data() ) );
+    }
+    size_t N = multi_index.size() / p;
+    CPPAD_ASSERT_UNKNOWN( N == local::tensor_dir_binomial(p + d - 1, d) );
+    //
+    // gamma_start, gamma_index, gamma_value
+    // interpolation coefficients
+    // gamma_{a,b} = sum_{0 < k <= i} (-1)^{d-|k|} binomial(i, k)
+    //               binomial(d k / |k|, j) (|k| / d)^d
+    // where i (j) is the a-th (b-th) multi-index.
+    // This is zero unless the support of j is a subset of the support of i,
+    // so the non-zeros for row a are gamma_value[e] for
+    // e = gamma_start[a], ... , gamma_start[a+1]-1 and the corresponding
+    // column indices are gamma_index[e].
+    CppAD::vector<size_t> gamma_start(N + 1), gamma_index;
+    CppAD::vector<Base>   gamma_value;
+    {   CppAD::vector<size_t> support, k, j, global;
+        CppAD::vector<Base>   row;
+        gamma_start[0] = 0;
+        for(size_t a = 0; a < N; ++a)
+        {   const size_t* i = multi_index.data() + a * p;
+            //
+            // support
+            support.resize(0);
+            for(size_t ell = 0; ell < p; ++ell)
+                if( i[ell] > 0 )
+                    support.push_back(ell);
+            size_t t = support.size();
+            //
+            // row
+            // gamma_{a,b} for the multi-indices j with support in support,
+            // in the order given by tensor_dir_next for t components
+            size_t n_j = local::tensor_dir_binomial(t + d - 1, d);
+            row.resize(n_j);
+            for(size_t c = 0; c < n_j; ++c)
+                row[c] = Base(0.0);
+            //
+            // loop over 0 < k <= i (restricted to support)
+            k.resize(t);
+            j.resize(t);
+            for(size_t c = 0; c < t; ++c)
+                k[c] = 0;
+            while( true )
+            {   // next k
+                size_t c = 0;
+                while( c < t && k[c] == i[ support[c] ] )
+                    k[c++] = 0;
+                if( c == t )
+                    break;
+                ++k[c];
+                //
+                // abs_k
+                size_t abs_k = 0;
+                for(c = 0; c < t; ++c)
+                    abs_k += k[c];
+                //
+                // coef = (-1)^{d-|k|} binomial(i, k) (|k| / d)^d
+                Base coef = Base(1.0);
+                if( (d - abs_k) % 2 == 1 )
+                    coef = Base(-1.0);
+                for(c = 0; c < t; ++c)
+                {   for(size_t u = 0; u < k[c]; ++u)
+                    {   coef *= Base( double(i[ support[c] ] - u) );
+                        coef /= Base( double(u + 1) );
+                    }
+                }
+                Base ratio = Base( double(abs_k) ) / Base( double(d) );
+                for(size_t u = 0; u < d; ++u)
+                    coef *= ratio;
+                //
+                // row += coef * binomial(d k / |k|, j)
+                for(c = 0; c < t; ++c)
+                    j[c] = 0;
+                j[0] = d;
+                size_t index = 0;
+                do
+                {   Base term = coef;
+                    for(c = 0; c < t; ++c)
+                    {   Base top = Base( double(d * k[c]) );
+                        top     /= Base( double(abs_k) );
+                        for(size_t u = 0; u < j[c]; ++u)
+                        {   term *= top - Base( double(u) );
+                            term /= Base( double(u + 1) );
+                        }
+                    }
+                    row[index++] += term;
+                } while( local::tensor_dir_next(t, j.data() ) );
+                CPPAD_ASSERT_UNKNOWN( index == n_j );
+            }
+            //
+            // gamma_index, gamma_value
+            global.resize(p);
+            for(size_t ell = 0; ell < p; ++ell)
+                global[ell] = 0;
+            for(size_t c = 0; c < t; ++c)
+                j[c] = 0;
+            j[0] = d;
+            size_t index = 0;
+            do
+            {   for(size_t c = 0; c < t; ++c)
+                    global[ support[c] ] = j[c];
+                if( row[index] != Base(0.0) )
+                {   gamma_index.push_back(
+                        local::tensor_dir_rank(p, d, global.data() )
+                    );
+                    gamma_value.push_back( row[index] );
+                }
+                ++index;
+            } while( local::tensor_dir_next(t, j.data() ) );
+            gamma_start[a + 1] = gamma_index.size();
+        }
+    }
+    //
+    // zero order forward at x
+    Forward(0, x);
+    //
+    // taylor_d
+    // order d Taylor coefficient for each range component and direction
+    CppAD::vector<Base> taylor_d(m * N);
+    //
+    // r directions at a time
+    r = std::min(r, N);
+    BaseVector xq(n * r), yq(m * r), zero(n * r);
+    for(size_t ell = 0; ell < n * r; ++ell)
+        zero[ell] = Base(0.0);
+    for(size_t b_start = 0; b_start < N; b_start += r)
+    {   size_t n_dir = std::min(r, N - b_start);
+        //
+        // first order: direction S * k for each multi-index k
+        for(size_t j = 0; j < n; ++j)
+        {   for(size_t ell = 0; ell < r; ++ell)
+            {   Base sum = Base(0.0);
+                if( ell < n_dir )
+                {   const size_t* k = multi_index.data() + (b_start + ell) * p;
+                    for(size_t c = 0; c < p; ++c) if( k[c] != 0 )
+                        sum += s[j * p + c] * Base( double(k[c]) );
+                }
+                xq[j * r + ell] = sum;
+            }
+        }
+        yq = Forward(1, r, xq);
+        //
+        // higher orders are zero because x(t) = x + t * S * k
+        for(size_t q = 2; q <= d; ++q)
+            yq = Forward(q, r, zero);
+        //
+        for(size_t i = 0; i < m; ++i)
+            for(size_t ell = 0; ell < n_dir; ++ell)
+                taylor_d[i * N + b_start + ell] = yq[i * r + ell];
+    }
+    //
+    // ten = taylor_d * gamma^T
+    BaseVector ten(m * N);
+    for(size_t i = 0; i < m; ++i)
+    {   for(size_t a = 0; a < N; ++a)
+        {   Base sum = Base(0.0);
+            for(size_t e = gamma_start[a]; e < gamma_start[a+1]; ++e)
+                sum += gamma_value[e] * taylor_d[i * N + gamma_index[e] ];
+            ten[i * N + a] = sum;
+        }
+    }
+    return ten;
+}
+
+} // END CppAD namespace
+
+# endif
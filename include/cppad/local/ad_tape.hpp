@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_AD_TAPE_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 # include <cppad/local/define.hpp>
 
@@ -28,6 +28,7 @@ class ADTape {
     friend class discrete<Base>;
     friend class VecAD<Base>;
     friend class VecAD_reference<Base>;
+    friend class lazy_record<Base>;
 
     // functions -----------------------------------------------------------
     // PrintFor
@@ -2,9 +2,10 @@
 # define CPPAD_LOCAL_COLOR_GENERAL_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
+# include <algorithm>
 # include <cppad/configure.hpp>
 # include <cppad/local/cppad_colpack.hpp>
 
@@ -137,13 +138,21 @@ void color_general_cppad(
     fact that only the entries (subset of the sparsity pattern) specified by
     row and col need to be computed.
     */
+    //
+    // n_color: number of colors used by the rows that have been colored
+    // (it is less than or equal the initial value of color[i])
+    // (the loop below starts with row one)
+    size_t n_color = 0;
+    if( m > 0 && color[0] < m )
+        n_color = 1;
     CppAD::vector<bool> forbidden(m);
     for(size_t i = 1; i < m; i++) // for each row that appears
     if( color[i] < m )
     {
         // initial all colors as ok for this row
-        // (value of forbidden for ell > initial color[i] does not matter)
-        for(ell = 0; ell <= color[i]; ell++)
+        // (only colors less than n_color can be forbidden)
+        CPPAD_ASSERT_UNKNOWN( n_color <= color[i] );
+        for(ell = 0; ell <= n_color; ell++)
             forbidden[ell] = false;
 
         // -----------------------------------------------------
@@ -190,9 +199,10 @@ void color_general_cppad(
         ell = 0;
         while( forbidden[ell] )
         {   ell++;
-            CPPAD_ASSERT_UNKNOWN( ell <= color[i] );
+            CPPAD_ASSERT_UNKNOWN( ell <= n_color );
         }
         color[i] = ell;
+        n_color  = std::max(n_color, ell + 1);
     }
     return;
 }
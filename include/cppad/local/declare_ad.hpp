@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_DECLARE_AD_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cppad/configure.hpp>
@@ -17,6 +17,7 @@ namespace CppAD { namespace local {
     template <class Base> class player;
     template <class Base> class dyn_player;
     template <class Base> class recorder;
+    template <class Base> class lazy_record;
 } }
 namespace CppAD { namespace local { namespace val_graph {
     template <class Value> class tape_t;
@@ -52,6 +53,7 @@ namespace CppAD {
     template <class Base> class discrete;
     template <class Base> class VecAD;
     template <class Base> class VecAD_reference;
+    template <class Base, class Node> class lazy_ad;
 
     // functions with one VecAD<Base> argument
     template <class Base> bool Constant          (const VecAD<Base> &u);
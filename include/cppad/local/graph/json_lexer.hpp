@@ -2,10 +2,11 @@
 # define CPPAD_LOCAL_GRAPH_JSON_LEXER_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <string>
+# include <istream>
 # include <cppad/core/cppad_assert.hpp>
 
 // BEGIN_NAMESPACE_CPPAD_LOCAL_GRAPH
@@ -25,13 +26,29 @@ json lexer: Private Data
 Member Variables
 ****************
 
-graph\_
-=======
-The :ref:`json_ad_graph-name` .
+is\_
+====
+If this is null, the entire :ref:`json_ad_graph-name` is in ``json_`` .
+Otherwise, the graph is read from this stream one chunk at a time.
+
+buffer\_
+========
+If ``is_`` is not null, this holds the current chunk of the graph
+and a few characters before the current character
+(so that errors can report the recent input).
+
+json\_
+======
+is the start of the characters in the graph that are currently available;
+i.e., ``buffer_.data()`` if ``is_`` is not null.
+
+size\_
+======
+is the number of characters in ``json_`` .
 
 index\_
 =======
-is the index in the graph for the current character.
+is the index in ``json_`` for the current character.
 If a token is returned, this corresponds to the last character
 it the token.
 
@@ -46,6 +63,7 @@ character number in the graph for the current character
 token\_
 =======
 used to return tokens.
+The memory for this string is reused from one token to the next.
 
 function_name\_
 ===============
@@ -77,7 +95,10 @@ Source Code
 {xrst_spell_off}
 {xrst_code hpp} */
 private:
-    const std::string& json_;
+    std::istream*      is_;
+    std::string        buffer_;
+    const char*        json_;
+    size_t             size_;
     size_t             index_;
     size_t             line_number_;
     size_t             char_number_;
@@ -148,7 +169,7 @@ index\_
 *******
 The input value of ``index_`` is increased by one.
 It is an error to call this routine when the input value
-of ``index_`` is greater than or equal ``json_.size()`` .
+of ``index_`` is greater than or equal ``size_`` .
 
 line_number\_
 *************
@@ -172,6 +193,49 @@ private:
 
 {xrst_end json_lexer_next_index}
 -------------------------------------------------------------------------------
+{xrst_begin json_lexer_available dev}
+
+json lexer: Check That Characters are Available
+###############################################
+
+Syntax
+******
+
+| |tab| *ok* = *json_lexer* . ``available`` ( *k* )
+| |tab| *ok* = *json_lexer* . ``read_chunk`` ( *k* )
+
+k
+*
+is the number of characters, after the current character,
+that must be available.
+
+index\_
+*******
+If ``is_`` is not null and ``index_ + k`` is greater than or equal
+``size_`` , the next chunk of the graph is read from ``is_``
+and appended to ``buffer_`` .
+The ``available`` function only calls ``read_chunk`` in this case;
+i.e., it is fast when the characters are already available.
+In this case, the characters that are no longer needed are removed from the
+front of ``buffer_`` and ``index_`` , ``json_`` , ``size_`` are
+changed accordingly.
+
+ok
+**
+is true if ``index_ + k`` is less than ``size_`` upon return.
+
+Prototype
+*********
+{xrst_spell_off}
+{xrst_code hpp} */
+private:
+    bool available(size_t k);
+    bool read_chunk(size_t k);
+/* {xrst_code}
+{xrst_spell_on}
+
+{xrst_end json_lexer_available}
+-------------------------------------------------------------------------------
 {xrst_begin json_lexer_skip_white_space dev}
 
 json lexer: Skip White Space That Separates Tokens
@@ -189,8 +253,8 @@ is a json lexer object.
 Discussion
 **********
 This member functions is used to increase ``index_`` until either
-a non-white space character is found or ``index_`` is equal
-to ``json_.size()`` .
+a non-white space character is found or
+there are no more characters in the graph.
 
 Prototype
 *********
@@ -203,6 +267,44 @@ private:
 
 {xrst_end json_lexer_skip_white_space}
 -------------------------------------------------------------------------------
+{xrst_begin json_lexer_scan_token dev}
+
+json lexer: Scan a Number Token
+###############################
+
+Syntax
+******
+
+    *json_lexer* . ``scan_token`` ( *in_token* )
+
+in_token
+********
+This function returns true (false) if a character can (cannot) be
+part of the token.
+
+index\_
+*******
+On input, ``json_[index_]`` is the first character in the token.
+Upon return, it is the last character in the token; i.e.,
+the next character is not part of the token.
+
+token\_
+*******
+Upon return, ``token_`` contains the characters in the token.
+The characters in the current chunk of the graph are copied using
+one append operation.
+
+Prototype
+*********
+{xrst_spell_off}
+{xrst_code hpp} */
+private:
+    void scan_token( bool (*in_token)(char) );
+/* {xrst_code}
+{xrst_spell_on}
+
+{xrst_end json_lexer_scan_token}
+-------------------------------------------------------------------------------
 {xrst_begin json_lexer_constructor dev}
 
 json lexer: Constructor
@@ -211,7 +313,9 @@ json lexer: Constructor
 Syntax
 ******
 
-    ``local::graph::lexer`` *json_lexer* ( *json* )
+| ``local::graph::lexer`` *json_lexer* ( *json* )
+| ``local::graph::lexer`` *json_lexer* ( *data* , *size* )
+| ``local::graph::lexer`` *json_lexer* ( *is* )
 
 json
 ****
@@ -219,10 +323,22 @@ The argument *json* is an :ref:`json_ad_graph-name`
 and it is assumed that *json* does not change
 for as long as *json_lexer* exists.
 
+data, size
+**********
+The characters *data* [ *i* ] for *i* = 0 , ... , *size* - 1
+are a Json AD graph; e.g., a memory mapped file.
+These characters are not copied and it is assumed that they do not change
+for as long as *json_lexer* exists.
+
+is
+**
+The Json AD graph is read from this stream as it is parsed.
+Only a small chunk of the graph is in memory at any one time.
+
 Initialization
 **************
 The current token, index, line number, and character number
-are set to the first non white space character in ``json_`` .
+are set to the first non white space character in the graph.
 If this is not a left brace character ``'{'`` ,
 the error is reported and the constructor does not return.
 
@@ -232,6 +348,10 @@ Prototype
 {xrst_code hpp} */
 public:
     json_lexer(const std::string& json);
+    json_lexer(const char* data, size_t size);
+    json_lexer(std::istream& is);
+private:
+    void initialize(void);
 /* {xrst_code}
 {xrst_spell_on}
 
@@ -3,10 +3,11 @@
 
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <string>
+# include <istream>
 # include <cppad/utility/vector.hpp>
 # include <cppad/local/graph/cpp_graph_op.hpp>
 # include <cppad/core/graph/cpp_graph.hpp>
@@ -20,11 +21,22 @@ Json AD Graph Parser
 Syntax
 ******
 | ``json_parser`` ( *json* , *graph_obj* )
+| ``json_parser`` ( *data* , *size* , *graph_obj* )
+| ``json_parser`` ( *is* , *graph_obj* )
 
 json
 ****
 The :ref:`json_ad_graph-name` .
 
+data, size
+**********
+The characters *data* [ *i* ] for *i* = 0 , ... , *size* - 1
+are the Json AD graph.
+
+is
+**
+The Json AD graph is read from this stream as it is parsed.
+
 graph_obj
 *********
 This is a ``cpp_graph`` object.
@@ -40,6 +52,15 @@ namespace CppAD { namespace local { namespace graph {
         const std::string&  json      ,
         cpp_graph&          graph_obj
     );
+    CPPAD_LIB_EXPORT void json_parser(
+        const char*         data      ,
+        size_t              size      ,
+        cpp_graph&          graph_obj
+    );
+    CPPAD_LIB_EXPORT void json_parser(
+        std::istream&       is        ,
+        cpp_graph&          graph_obj
+    );
 } } }
 /* {xrst_code}
 {xrst_spell_on}
@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_OPTIMIZE_GET_PAR_USAGE_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*!
 \file get_cexp_info.hpp
@@ -250,8 +250,14 @@ void get_par_usage(
             break;
 
 
-            // cases where only first argument is a parameter
+            // cumulative summation: constant and dynamic parameter arguments
             case CSumOp:
+            par_usage[arg[0]] = true;
+            for(size_t i = size_t(arg[2]); i < size_t(arg[4]); ++i)
+                par_usage[arg[i]] = true;
+            break;
+
+            // cases where only first argument is a parameter
             case EqpvOp:
             case DivpvOp:
             case LepvOp:
@@ -261,7 +267,7 @@ void get_par_usage(
             case ParOp:
             case PowpvOp:
             case ZmulpvOp:
-            CPPAD_ASSERT_UNKNOWN( 1 <= NumArg(op) || op == CSumOp )
+            CPPAD_ASSERT_UNKNOWN( 1 <= NumArg(op) )
             par_usage[arg[0]] = true;
             break;
 
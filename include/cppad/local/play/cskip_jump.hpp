@@ -0,0 +1,326 @@
+# ifndef CPPAD_LOCAL_PLAY_CSKIP_JUMP_HPP
+# define CPPAD_LOCAL_PLAY_CSKIP_JUMP_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+# include <algorithm>
+# include <cppad/local/pod_vector.hpp>
+# include <cppad/local/play/sequential_iterator.hpp>
+
+// BEGIN_CPPAD_LOCAL_PLAY_NAMESPACE
+namespace CppAD { namespace local { namespace play {
+
+/*!
+\file cskip_jump.hpp
+*/
+
+/// a block of consecutive operators skipped by one case of a CSkipOp
+struct struct_cskip_block {
+    /// index of the first operator in the block
+    size_t begin_op;
+    /// index of the operator that follows the last operator in the block
+    size_t end_op;
+    /// index in the argument vector of the first argument for begin_op
+    size_t begin_arg;
+    /// index in the argument vector of the first argument for end_op
+    size_t end_arg;
+    /// index of the primary result for begin_op
+    size_t begin_var;
+    /// index of the primary result for end_op
+    size_t end_var;
+};
+
+} } } // END_CPPAD_LOCAL_PLAY_NAMESPACE
+
+namespace CppAD { namespace local {
+    template <> inline bool is_pod<play::struct_cskip_block>(void)
+    { return true; }
+} }
+
+// BEGIN_CPPAD_LOCAL_PLAY_NAMESPACE
+namespace CppAD { namespace local { namespace play {
+/*!
+Jumps over blocks of operators that are skipped by conditional skip operators.
+
+The operators that a CSkipOp skips are often in blocks with consecutive
+operator indices; e.g., the operators that only compute one case of
+a conditional expression. When a CSkipOp marks such a block as skipped,
+the sweeps jump over the entire block instead of checking each of its
+operators. The blocks are computed once for each recording;
+the jumps that are active are set during zero order forward sweeps
+and used by the other sweeps until the next zero order forward sweep.
+*/
+class cskip_jump {
+private:
+    /// have the blocks been computed for the current recording
+    bool                            setup_;
+    /// operator index for each CSkipOp in the recording (increasing order)
+    pod_vector<size_t>              cskip_index_;
+    /// The blocks for the true (false) case of the k-th CSkipOp are
+    /// block_[ list_begin_[2*k] ] , ... , block_[ list_begin_[2*k+1] - 1 ]
+    /// ( block_[ list_begin_[2*k+1] ] , ... , block_[ list_begin_[2*k+2] - 1])
+    pod_vector<size_t>              list_begin_;
+    /// all the blocks for all the CSkipOp operators
+    pod_vector<struct_cskip_block>  block_;
+    /// for each operator index, zero or one plus the index in block_
+    /// of the active block that starts at this operator
+    pod_vector<addr_t>              forward_jump_;
+    /// for each operator index, zero or one plus the index in block_
+    /// of the active block that ends at this operator
+    pod_vector<addr_t>              reverse_jump_;
+    /// indices in block_ for the blocks that are active
+    pod_vector<size_t>              changed_;
+    //
+    /// is an operator in a block (its arguments and results are fixed)
+    static bool block_op(op_code_var op)
+    {   switch( op )
+        {   case AFunOp:
+            case BeginOp:
+            case CSkipOp:
+            case CSumOp:
+            case EndOp:
+            case FunapOp:
+            case FunavOp:
+            case FunrpOp:
+            case FunrvOp:
+            return false;
+
+            default:
+            break;
+        }
+        return true;
+    }
+public:
+    /*!
+    Compute the blocks for the CSkipOp operators in a player.
+
+    \param play
+    is the player for the operation sequence. This object must have been
+    cleared, or only used with this player, since the player's recording
+    was last changed.
+    If the blocks have already been computed, this routine does nothing.
+    It is only called when a CSkipOp is executed, so that recordings
+    without conditional skips do not use any memory for the blocks.
+    */
+    template <class Player>
+    void setup(const Player* play)
+    {   if( setup_ )
+            return;
+        setup_ = true;
+        //
+        // op2arg, op2var, cskip_index_
+        size_t num_op = play->num_var_op();
+        pod_vector<size_t> op2arg(num_op), op2var(num_op);
+        cskip_index_.resize(0);
+        const_sequential_iterator itr = play->begin();
+        op_code_var   op;
+        const addr_t* arg;
+        size_t        i_var;
+        itr.op_info(op, arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+        const addr_t* arg_begin = arg;
+        for(size_t i_op = 0; i_op < num_op; ++i_op)
+        {   op2arg[i_op] = size_t(arg - arg_begin);
+            op2var[i_op] = i_var;
+            if( op == CSkipOp )
+                cskip_index_.push_back(i_op);
+            if( op == CSkipOp || op == CSumOp )
+                itr.correct_before_increment();
+            if( i_op + 1 < num_op )
+                (++itr).op_info(op, arg, i_var);
+        }
+        CPPAD_ASSERT_UNKNOWN( op == EndOp );
+        //
+        // list_begin_, block_
+        size_t num_cskip = cskip_index_.size();
+        list_begin_.resize(2 * num_cskip + 1);
+        block_.resize(0);
+        for(size_t k = 0; k < num_cskip; ++k)
+        {   arg = arg_begin + op2arg[ cskip_index_[k] ];
+            for(size_t true_false = 0; true_false < 2; ++true_false)
+            {   list_begin_[2 * k + true_false] = block_.size();
+                const addr_t* list = arg + 6;
+                size_t        n    = size_t( arg[4] );
+                if( true_false == 1 )
+                {   list += arg[4];
+                    n     = size_t( arg[5] );
+                }
+                size_t j = 0;
+                while( j < n )
+                {   // [ begin_op, end_op ) is a block
+                    size_t begin_op = size_t( list[j] );
+                    size_t end_op   = begin_op;
+                    while( j < n &&
+                        size_t( list[j] ) == end_op &&
+                        block_op( play->GetOp(end_op) )
+                    )
+                    {   ++end_op;
+                        ++j;
+                    }
+                    if( end_op == begin_op )
+                        ++j;
+                    else if( end_op > begin_op + 1 )
+                    {   struct_cskip_block block;
+                        block.begin_op  = begin_op;
+                        block.end_op    = end_op;
+                        block.begin_arg = op2arg[begin_op];
+                        block.end_arg   = op2arg[end_op];
+                        block.begin_var = op2var[begin_op];
+                        block.end_var   = op2var[end_op];
+                        block_.push_back(block);
+                    }
+                }
+            }
+        }
+        list_begin_[2 * num_cskip] = block_.size();
+        //
+        // forward_jump_, reverse_jump_
+        if( block_.size() == 0 )
+        {   forward_jump_.clear();
+            reverse_jump_.clear();
+        }
+        else
+        {   forward_jump_.resize(num_op);
+            reverse_jump_.resize(num_op);
+            for(size_t i_op = 0; i_op < num_op; ++i_op)
+            {   forward_jump_[i_op] = 0;
+                reverse_jump_[i_op] = 0;
+            }
+        }
+        changed_.resize(0);
+    }
+    /// default constructor
+    cskip_jump(void) : setup_(false)
+    { }
+    /// free all the memory for this object; the next setup recomputes
+    /// the blocks
+    void clear(void)
+    {   setup_ = false;
+        cskip_index_.clear();
+        list_begin_.clear();
+        block_.clear();
+        forward_jump_.clear();
+        reverse_jump_.clear();
+        changed_.clear();
+    }
+    /// exchange this object with another object
+    void swap(cskip_jump& other)
+    {   std::swap( setup_, other.setup_ );
+        cskip_index_.swap( other.cskip_index_ );
+        list_begin_.swap( other.list_begin_ );
+        block_.swap( other.block_ );
+        forward_jump_.swap( other.forward_jump_ );
+        reverse_jump_.swap( other.reverse_jump_ );
+        changed_.swap( other.changed_ );
+    }
+    /// make all the jumps inactive; e.g., at the start of a zero order
+    /// forward sweep
+    void clear_jump(void)
+    {   for(size_t k = 0; k < changed_.size(); ++k)
+        {   const struct_cskip_block& block = block_[ changed_[k] ];
+            forward_jump_[ block.begin_op ]   = 0;
+            reverse_jump_[ block.end_op - 1 ] = 0;
+        }
+        changed_.resize(0);
+    }
+    /*!
+    Activate the jumps for one case of a CSkipOp.
+
+    \param i_op
+    is the operator index for the CSkipOp.
+
+    \param true_case
+    if true (false) the operators that are skipped when the comparison
+    is true (false) have been marked as skipped.
+
+    \par Prerequisite
+    setup must have been called for the current recording.
+    */
+    void set(size_t i_op, bool true_case)
+    {   CPPAD_ASSERT_UNKNOWN( setup_ );
+        if( block_.size() == 0 )
+            return;
+        //
+        // k
+        const size_t* cskip_begin = cskip_index_.data();
+        const size_t* cskip_end   = cskip_begin + cskip_index_.size();
+        size_t k = size_t(
+            std::lower_bound(cskip_begin, cskip_end, i_op) - cskip_begin
+        );
+        CPPAD_ASSERT_UNKNOWN( cskip_index_[k] == i_op );
+        //
+        size_t start = list_begin_[2 * k + 1];
+        size_t stop  = list_begin_[2 * k + 2];
+        if( true_case )
+        {   start = list_begin_[2 * k];
+            stop  = list_begin_[2 * k + 1];
+        }
+        for(size_t b = start; b < stop; ++b)
+        {   const struct_cskip_block& block = block_[b];
+            //
+            // forward_jump_: keep the block that ends last
+            size_t f = size_t( forward_jump_[block.begin_op] );
+            if( f == 0 || block_[f-1].end_op < block.end_op )
+                forward_jump_[block.begin_op] = addr_t(b + 1);
+            //
+            // reverse_jump_: keep the block that begins first
+            size_t r = size_t( reverse_jump_[block.end_op - 1] );
+            if( r == 0 || block.begin_op < block_[r-1].begin_op )
+                reverse_jump_[block.end_op - 1] = addr_t(b + 1);
+            //
+            changed_.push_back(b);
+        }
+    }
+    /*!
+    Jump forward over an active block.
+
+    \param itr [in,out]
+    On input, the current operator for itr is skipped.
+    If an active block starts at this operator, on output the current
+    operator is the one that follows the block.
+
+    \return
+    is true if itr was changed.
+    */
+    bool forward(const_sequential_iterator& itr) const
+    {   if( forward_jump_.size() == 0 )
+            return false;
+        size_t b = size_t( forward_jump_[ itr.op_index() ] );
+        if( b == 0 )
+            return false;
+        const struct_cskip_block& block = block_[b-1];
+        itr.jump(block.end_op, block.end_arg, block.end_var);
+        return true;
+    }
+    /*!
+    Jump backward over an active block.
+
+    \param itr [in,out]
+    On input, the current operator for itr is skipped.
+    If an active block ends at this operator, on output the current
+    operator is the first operator in the block.
+
+    \return
+    is true if itr was changed.
+    */
+    bool reverse(const_sequential_iterator& itr) const
+    {   if( reverse_jump_.size() == 0 )
+            return false;
+        size_t b = size_t( reverse_jump_[ itr.op_index() ] );
+        if( b == 0 )
+            return false;
+        const struct_cskip_block& block = block_[b-1];
+        itr.jump(block.begin_op, block.begin_arg, block.begin_var);
+        return true;
+    }
+    /// other iterators (e.g. subgraph iterators) do not jump
+    template <class Iterator>
+    bool reverse(Iterator& /* itr */) const
+    {   return false; }
+};
+
+} } } // END_CPPAD_LOCAL_PLAY_NAMESPACE
+
+# endif
@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_PLAY_DYN_PLAYER_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 # include <cppad/local/pod_vector.hpp>
 
@@ -54,6 +54,15 @@ This returns a AD<Base> player corresponding with the same operation sequence.
     // END_BASE2AD
 }
 
+base2float
+**********
+This returns a float player corresponding with the same operation sequence.
+The parameter values are converted to ``float`` .
+{xrst_literal
+    // BEGIN_BASE2FLOAT
+    // END_BASE2FLOAT
+}
+
 get_recording
 *************
 This transfers a dynamic parameter recording to a dynamic parameter player.
@@ -306,6 +315,30 @@ public:
         //
         return dyn_play;
     }
+    // BEGIN_BASE2FLOAT
+    // float_dyn_play = dyn_play
+    dyn_player<float> base2float(void) const
+    // END_BASE2FLOAT
+    {   //
+        // dyn_play
+        dyn_player<float> dyn_play;
+        //
+        // size_t objects
+        dyn_play.n_dyn_independent_  = n_dyn_independent_;
+        //
+        // pod_vectors
+        dyn_play.par_is_dyn_         = par_is_dyn_;
+        dyn_play.dyn2par_index_      = dyn2par_index_;
+        dyn_play.dyn_par_op_         = dyn_par_op_;
+        dyn_play.dyn_par_arg_        = dyn_par_arg_;
+        //
+        // pod_maybe_vector<float> = pod_maybe_vector<Base>
+        dyn_play.par_all_.resize( par_all_.size() );
+        for(size_t i = 0; i < par_all_.size(); ++i)
+            dyn_play.par_all_[i] = float( par_all_[i] );
+        //
+        return dyn_play;
+    }
     // BEGIN_SWAP
     // dyn_play_1.swap( dyn_play_2 )
     void swap(dyn_player& other)
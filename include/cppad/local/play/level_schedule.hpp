@@ -0,0 +1,308 @@
+# ifndef CPPAD_LOCAL_PLAY_LEVEL_SCHEDULE_HPP
+# define CPPAD_LOCAL_PLAY_LEVEL_SCHEDULE_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+# include <algorithm>
+# include <cppad/local/pod_vector.hpp>
+# include <cppad/local/play/sequential_iterator.hpp>
+
+// BEGIN_CPPAD_LOCAL_PLAY_NAMESPACE
+namespace CppAD { namespace local { namespace play {
+
+/*!
+\file level_schedule.hpp
+*/
+
+/// type of the user routine that executes tasks in parallel
+typedef void (*parallel_for_type)(
+    size_t n_task, void (*task)(size_t i_task, void* info), void* info
+);
+
+/// an operator in a level schedule
+struct struct_level_op {
+    /// the operator
+    op_code_var op;
+    /// index of the operator in the recording
+    addr_t      i_op;
+    /// index in the argument vector of the first argument for the operator
+    addr_t      i_arg;
+    /// index of the primary result for the operator
+    addr_t      i_var;
+};
+
+} } } // END_CPPAD_LOCAL_PLAY_NAMESPACE
+
+namespace CppAD { namespace local {
+    template <> inline bool is_pod<play::struct_level_op>(void)
+    { return true; }
+} }
+
+// BEGIN_CPPAD_LOCAL_PLAY_NAMESPACE
+namespace CppAD { namespace local { namespace play {
+/*!
+Groups the operators in a recording by level so that the operators
+in one level can be evaluated in parallel.
+
+The level of an operator is zero if none of its arguments are results
+of other operators (other than independent variables).
+Otherwise, it is one plus the maximum level of the operators that
+compute its variable arguments.
+Hence, the operators in one level do not depend on each other
+and only depend on the operators in previous levels.
+The schedule is computed once for each recording;
+i.e., the first time it is used after the recording changes.
+*/
+class level_schedule {
+private:
+    /// has the schedule been computed for the current recording
+    bool                          setup_;
+    /// can the operators be evaluated using this schedule
+    bool                          ok_;
+    /// the operators that have results in level order; i.e.,
+    /// level ell is level_op_[ level_begin_[ell] ] , ... ,
+    /// level_op_[ level_begin_[ell+1] - 1 ] (in operator index order)
+    pod_vector<struct_level_op>   level_op_;
+    /// index in level_op_ where each level begins (size is number levels + 1)
+    pod_vector<size_t>            level_begin_;
+    /// the comparison operators in operator index order
+    pod_vector<struct_level_op>   compare_op_;
+public:
+    /// is this a comparison operator
+    static bool is_compare_op(op_code_var op)
+    {   switch( op )
+        {   case EqppOp:
+            case EqpvOp:
+            case EqvvOp:
+            case LeppOp:
+            case LepvOp:
+            case LevpOp:
+            case LevvOp:
+            case LtppOp:
+            case LtpvOp:
+            case LtvpOp:
+            case LtvvOp:
+            case NeppOp:
+            case NepvOp:
+            case NevvOp:
+            return true;
+
+            default:
+            break;
+        }
+        return false;
+    }
+    /// is this an operator that a schedule cannot contain; i.e., one that
+    /// has state, side effects, or results that are not its own variables
+    static bool is_sequential_op(op_code_var op)
+    {   switch( op )
+        {   case AFunOp:
+            case CSkipOp:
+            case DisOp:
+            case FunapOp:
+            case FunavOp:
+            case FunrpOp:
+            case FunrvOp:
+            case LdpOp:
+            case LdvOp:
+            case PriOp:
+            case StppOp:
+            case StpvOp:
+            case StvpOp:
+            case StvvOp:
+            return true;
+
+            default:
+            break;
+        }
+        return false;
+    }
+    /// minimum number of operators in one task
+    static size_t min_task_size(void)
+    {   return 256; }
+    /*!
+    Compute the schedule for the operators in a player.
+
+    \param play
+    is the player for the operation sequence. This object must have been
+    cleared, or only used with this player, since the player's recording
+    was last changed.
+    If the schedule has already been computed, this routine does nothing.
+    It is only called when parallel evaluation is requested,
+    so that other recordings do not use any memory for the schedule.
+
+    \par ok
+    After this call, ok() is false (and no memory is used) if the recording
+    contains an operator that must be evaluated in order (e.g., VecAD,
+    atomic function, or conditional skip operators), or if less than half
+    of the operators are in levels with at least two tasks worth of
+    operators; i.e., the recording is too narrow to benefit from parallel
+    evaluation.
+    */
+    template <class Player>
+    void setup(const Player* play)
+    {   if( setup_ )
+            return;
+        setup_ = true;
+        ok_    = true;
+        level_op_.resize(0);
+        level_begin_.resize(0);
+        compare_op_.resize(0);
+        //
+        // var_level
+        // zero for independent variables, otherwise one plus the level of
+        // the operator that computes the variable
+        size_t num_var = play->num_var();
+        pod_vector<addr_t> var_level(num_var);
+        //
+        // op_list, op_level, level_count
+        // operators with results in operator index order and their levels
+        pod_vector<struct_level_op> op_list;
+        pod_vector<addr_t>          op_level;
+        pod_vector<size_t>          level_count;
+        //
+        // itr, op, arg, i_var
+        const_sequential_iterator itr = play->begin();
+        op_code_var   op;
+        const addr_t* arg;
+        size_t        i_var;
+        itr.op_info(op, arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+        const addr_t* arg_begin = arg;
+        var_level[i_var] = 0;
+        //
+        pod_vector<bool> is_variable;
+        bool more_operators = true;
+        while( more_operators )
+        {   (++itr).op_info(op, arg, i_var);
+            //
+            // op_info
+            struct_level_op op_info;
+            op_info.op    = op;
+            op_info.i_op  = addr_t( itr.op_index() );
+            op_info.i_arg = addr_t( arg - arg_begin );
+            op_info.i_var = addr_t( i_var );
+            //
+            if( is_sequential_op(op) )
+            {   clear();
+                setup_ = true;
+                ok_    = false;
+                return;
+            }
+            if( op == EndOp )
+                more_operators = false;
+            else if( op == InvOp )
+                var_level[i_var] = 0;
+            else if( is_compare_op(op) )
+                compare_op_.push_back(op_info);
+            else
+            {   // level
+                arg_is_variable(op, arg, is_variable);
+                size_t level = 0;
+                for(size_t j = 0; j < is_variable.size(); ++j)
+                {   if( is_variable[j] )
+                        level = std::max(level, size_t( var_level[arg[j]] ) );
+                }
+                //
+                // var_level
+                size_t n_res = NumRes(op);
+                for(size_t k = 0; k < n_res; ++k)
+                    var_level[i_var - k] = addr_t(level + 1);
+                //
+                // op_list, op_level, level_count
+                op_list.push_back(op_info);
+                op_level.push_back( addr_t(level) );
+                if( level_count.size() <= level )
+                    level_count.push_back(0);
+                CPPAD_ASSERT_UNKNOWN( level < level_count.size() );
+                ++level_count[level];
+            }
+            if( op == CSumOp )
+                itr.correct_before_increment();
+        }
+        //
+        // ok_
+        // true if at least half the operators are in levels that have two
+        // or more tasks worth of operators
+        size_t n_level    = level_count.size();
+        size_t n_parallel = 0;
+        for(size_t ell = 0; ell < n_level; ++ell)
+        {   if( 2 * min_task_size() <= level_count[ell] )
+                n_parallel += level_count[ell];
+        }
+        if( 2 * n_parallel < op_list.size() )
+        {   clear();
+            setup_ = true;
+            ok_    = false;
+            return;
+        }
+        //
+        // level_begin_
+        level_begin_.resize(n_level + 1);
+        level_begin_[0] = 0;
+        for(size_t ell = 0; ell < n_level; ++ell)
+            level_begin_[ell + 1] = level_begin_[ell] + level_count[ell];
+        //
+        // level_op_
+        // level_count is used for the next index in each level
+        level_op_.resize( op_list.size() );
+        for(size_t ell = 0; ell < n_level; ++ell)
+            level_count[ell] = level_begin_[ell];
+        for(size_t k = 0; k < op_list.size(); ++k)
+        {   size_t ell = size_t( op_level[k] );
+            level_op_[ level_count[ell]++ ] = op_list[k];
+        }
+    }
+    /// default constructor
+    level_schedule(void) : setup_(false), ok_(false)
+    { }
+    /// free all the memory for this object; the next setup recomputes
+    /// the schedule
+    void clear(void)
+    {   setup_ = false;
+        ok_    = false;
+        level_op_.clear();
+        level_begin_.clear();
+        compare_op_.clear();
+    }
+    /// exchange this object with another object
+    void swap(level_schedule& other)
+    {   std::swap( setup_, other.setup_ );
+        std::swap( ok_, other.ok_ );
+        level_op_.swap( other.level_op_ );
+        level_begin_.swap( other.level_begin_ );
+        compare_op_.swap( other.compare_op_ );
+    }
+    /// can the operators be evaluated using this schedule
+    /// (setup must have been called for the current recording)
+    bool ok(void) const
+    {   CPPAD_ASSERT_UNKNOWN( setup_ );
+        return ok_;
+    }
+    /// number of levels
+    size_t n_level(void) const
+    {   CPPAD_ASSERT_UNKNOWN( ok_ );
+        return level_begin_.size() - 1;
+    }
+    /// index in level_op() of the first operator in level ell
+    size_t level_begin(size_t ell) const
+    {   CPPAD_ASSERT_UNKNOWN( ok_ );
+        return level_begin_[ell];
+    }
+    /// the operators that have results in level order
+    const struct_level_op* level_op(void) const
+    {   CPPAD_ASSERT_UNKNOWN( ok_ );
+        return level_op_.data();
+    }
+    /// the comparison operators in operator index order
+    const pod_vector<struct_level_op>& compare_op(void) const
+    {   CPPAD_ASSERT_UNKNOWN( ok_ );
+        return compare_op_;
+    }
+};
+
+} } } // END_CPPAD_LOCAL_PLAY_NAMESPACE
+
+# endif
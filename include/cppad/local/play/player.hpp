@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_PLAY_PLAYER_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cppad/local/play/addr_enum.hpp>
@@ -10,6 +10,10 @@
 # include <cppad/local/play/subgraph_iterator.hpp>
 # include <cppad/local/play/dyn_player.hpp>
 # include <cppad/local/play/random_setup.hpp>
+# include <cppad/local/play/vecad_state.hpp>
+# include <cppad/local/play/cskip_jump.hpp>
+# include <cppad/local/play/level_schedule.hpp>
+# include <cppad/local/play/reverse_level_schedule.hpp>
 # include <cppad/local/atom_state.hpp>
 # include <cppad/local/is_pod.hpp>
 
@@ -185,6 +189,27 @@ private:
     // and for using const_subgraph_iterator.
     random_itr_info_t random_itr_info_;
     //
+    // vecad_state_
+    // State of the VecAD vectors during the previous zero order forward sweep.
+    // This is mutable because it does not change the recording; it is only
+    // used to speed up the next sweep (and is not copied for the same reason).
+    mutable play::vecad_state vecad_state_;
+    //
+    // cskip_jump_
+    // Blocks of operators that the conditional skip operators jump over
+    // (mutable and not copied for the same reason as vecad_state_).
+    mutable play::cskip_jump cskip_jump_;
+    //
+    // level_schedule_
+    // Operators grouped by level for parallel evaluation
+    // (mutable and not copied for the same reason as vecad_state_).
+    mutable play::level_schedule level_schedule_;
+    //
+    // reverse_level_schedule_
+    // Operators grouped by level for parallel reverse mode
+    // (mutable and not copied for the same reason as vecad_state_).
+    mutable play::reverse_level_schedule reverse_level_schedule_;
+    //
 public:
     //
     /// default constructor
@@ -294,6 +319,16 @@ public:
         // random access information
         clear_random();
 
+        // VecAD state
+        vecad_state_.clear();
+
+        // conditional skip jumps
+        cskip_jump_.clear();
+
+        // level schedules
+        level_schedule_.clear();
+        reverse_level_schedule_.clear();
+
         // some checks
         check_inv_op(n_ind);
         check_variable_dag();
@@ -517,6 +552,16 @@ public:
         //
         // random_itr_info_
         random_itr_info_    = play.random_itr_info_;
+        //
+        // vecad_state_
+        vecad_state_.clear();
+        //
+        // cskip_jump_
+        cskip_jump_.clear();
+        //
+        // level_schedule_, reverse_level_schedule_
+        level_schedule_.clear();
+        reverse_level_schedule_.clear();
     }
     //
     // base2ad
@@ -544,6 +589,31 @@ public:
         return play;
     }
     //
+    // base2float
+    // Create a player<float> from this player<Base>
+    player<float> base2float(void) const
+    {   player<float> play;
+        //
+        // dyn_play_
+        play.dyn_play_            = dyn_play_.base2float();
+        //
+        // size_t objects
+        play.num_var_            = num_var_;
+        play.num_var_load_       = num_var_load_;
+        play.num_var_vecad_      = num_var_vecad_;
+        //
+        // pod_vectors
+        play.var_op_             = var_op_;
+        play.var_arg_            = var_arg_;
+        play.var_text_           = var_text_;
+        play.var_vecad_ind_      = var_vecad_ind_;
+        //
+        // random_itr_info_
+        play.random_itr_info_    = random_itr_info_;
+        //
+        return play;
+    }
+    //
     // swap
     /// used for move semantics version of ADFun assignment operation
     void swap(player& other)
@@ -564,6 +634,16 @@ public:
         //
         // random_itr_info_
         random_itr_info_.swap(    other.random_itr_info_);
+        //
+        // vecad_state_
+        vecad_state_.swap(        other.vecad_state_);
+        //
+        // cskip_jump_
+        cskip_jump_.swap(         other.cskip_jump_);
+        //
+        // level_schedule_, reverse_level_schedule_
+        level_schedule_.swap(     other.level_schedule_);
+        reverse_level_schedule_.swap( other.reverse_level_schedule_);
     }
     //
     // setup_random
@@ -660,6 +740,26 @@ public:
     size_t GetVecInd (size_t i) const
     {   return size_t( var_vecad_ind_[i] ); }
     //
+    // vecad_state
+    /// State of the VecAD vectors used by zero order forward sweeps
+    play::vecad_state& vecad_state(void) const
+    {   return vecad_state_; }
+    //
+    // cskip_jump
+    /// Blocks of operators that the conditional skip operators jump over
+    play::cskip_jump& cskip_jump(void) const
+    {   return cskip_jump_; }
+    //
+    // level_schedule
+    /// Operators grouped by level for parallel evaluation
+    play::level_schedule& level_schedule(void) const
+    {   return level_schedule_; }
+    //
+    // reverse_level_schedule
+    /// Operators grouped by level for parallel reverse mode
+    play::reverse_level_schedule& reverse_level_schedule(void) const
+    {   return reverse_level_schedule_; }
+    //
     // par_one
     Base par_one(size_t i) const
     {   return dyn_play_.par_one(i);  }
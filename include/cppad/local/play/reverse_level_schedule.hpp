@@ -0,0 +1,611 @@
+# ifndef CPPAD_LOCAL_PLAY_REVERSE_LEVEL_SCHEDULE_HPP
+# define CPPAD_LOCAL_PLAY_REVERSE_LEVEL_SCHEDULE_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+# include <algorithm>
+# include <limits>
+# include <cppad/local/play/level_schedule.hpp>
+
+// BEGIN_CPPAD_LOCAL_PLAY_NAMESPACE
+namespace CppAD { namespace local { namespace play {
+
+/*!
+\file reverse_level_schedule.hpp
+*/
+
+/*!
+Groups the operators in a recording by level so that the operators
+in one level can be evaluated in parallel during a first order reverse sweep.
+
+A reverse sweep operator reads the partials for its results and adds to
+the partials for its variable arguments.
+The levels are determined by going through the operators in reverse order.
+The level of an operator is the smallest level that is greater than
+the level of each operator, with a larger index,
+that wrote to a partial that this operator reads or writes.
+Hence the operators in one level do not write to the same partial,
+and each partial receives its contributions in the same order as for
+the sequential sweep.
+
+\par Shadows
+If a variable is an argument to more than one operator,
+the ordering above would put each of those operators in a different level.
+A variable that is an argument for min_shadow_use() or more operators
+is not used to determine the levels of the operators that use it.
+Instead, the operators add to shadow partials for the variable,
+and the shadows are added to the variable's partial by a reduction
+at the end of a level.
+If there are shadows, the operator routines require that the index of
+an argument be less than the index of the result.
+Hence shadow s has index s, variable i has index i + n_shadow(),
+and level_op() and rev_arg() use these indices.
+
+\par Deterministic Mode
+Each use of a shadowed variable has its own shadow and the reduction
+adds the shadows in decreasing operator index order.
+The reduction for a variable is at the end of the last level that uses it;
+i.e., before the level of the operator that computes the variable.
+If an operator uses a variable more than once, the shadows for the
+operator are in the order that its reverse action adds to the partials;
+i.e., increasing argument index except for PowvvOp.
+In a first order sweep, an operator adds one non-zero value for each use
+of a variable. Hence the results are the same as for the sequential sweep
+provided that the compiler does not contract the multiply and add in the
+sequential sweep to one fused multiply-add; e.g., -ffp-contract=off.
+
+\par Accumulate Mode
+The operators in a level are divided into tasks; see min_task_size().
+Each task that uses a shadowed variable in a level has one shadow for the
+variable and the reduction, at the end of the level, adds the shadows in
+task order. Hence the results do not depend on the order of the tasks,
+but they may differ by roundoff from the sequential sweep.
+Shadows are not used in levels that are evaluated without tasks.
+
+\par PowvpOp
+The reverse mode action for a PowvpOp sets the partial for its variable
+argument to zero when the argument is zero. The partial must include all
+the contributions from operators with a larger index at that point.
+Hence a variable that is an argument to a PowvpOp is not shadowed.
+*/
+class reverse_level_schedule {
+private:
+    /// has the schedule been computed for the current recording
+    bool                          setup_;
+    /// was the schedule computed for accumulate mode
+    bool                          accumulate_;
+    /// can the operators be evaluated using this schedule
+    bool                          ok_;
+    /// the operators that have a reverse mode action in level order; i.e.,
+    /// level ell is level_op_[ level_begin_[ell] ] , ... ,
+    /// level_op_[ level_begin_[ell+1] - 1 ]
+    pod_vector<struct_level_op>   level_op_;
+    /// index in level_op_ where each level begins (size is number levels + 1)
+    pod_vector<size_t>            level_begin_;
+    /// argument vector with variable arguments replaced by shadows
+    /// (empty if there are no shadows)
+    pod_vector<addr_t>            rev_arg_;
+    /// variable for each reduction
+    pod_vector<addr_t>            red_var_;
+    /// reduction e adds the shadows red_begin_[e], ..., red_begin_[e+1]-1
+    /// to the partial for red_var_[e] (size is number of reductions + 1)
+    pod_vector<size_t>            red_begin_;
+    /// index in red_var_ of the first reduction for each level
+    /// (size is number levels + 1)
+    pod_vector<size_t>            red_level_;
+    //
+    /// does this operator have an action during a reverse sweep
+    static bool has_reverse(op_code_var op)
+    {   switch( op )
+        {   case BeginOp:
+            case EndOp:
+            case InvOp:
+            case ParOp:
+            return false;
+
+            default:
+            break;
+        }
+        return ! level_schedule::is_compare_op(op);
+    }
+    /// state for a recording that can not use this schedule
+    void not_ok(bool accumulate)
+    {   clear();
+        setup_      = true;
+        accumulate_ = accumulate;
+    }
+public:
+    /// minimum number of uses for a variable to have shadows
+    static size_t min_shadow_use(void)
+    {   return 2; }
+    /*!
+    Compute the schedule for the operators in a player.
+
+    \param play
+    is the player for the operation sequence. This object must have been
+    cleared, or only used with this player, since the player's recording
+    was last changed.
+    If the schedule has already been computed for this value of accumulate,
+    this routine does nothing.
+
+    \param accumulate
+    if true (false) the schedule is for accumulate (deterministic) mode.
+
+    \par ok
+    After this call, ok() is false (and no memory is used) if the recording
+    contains an operator that must be evaluated in order, or if less than
+    half of the operators are in levels with at least two tasks worth of
+    operators.
+    */
+    template <class Player>
+    void setup(const Player* play, bool accumulate)
+    {   if( setup_ && accumulate_ == accumulate )
+            return;
+        clear();
+        setup_      = true;
+        accumulate_ = accumulate;
+        ok_         = true;
+        //
+        // num_var, min_task_size
+        size_t num_var       = play->num_var();
+        size_t min_task_size = level_schedule::min_task_size();
+        //
+        // op_list, use_count, shadow, arg_begin
+        // op_list: operators that have a reverse action in operator index order
+        // use_count[i]: number of uses of variable i as an argument
+        // shadow[i]: false if variable i can not be shadowed
+        pod_vector<struct_level_op> op_list;
+        pod_vector<addr_t>          use_count(num_var);
+        pod_vector<bool>            shadow(num_var);
+        for(size_t i = 0; i < num_var; ++i)
+        {   use_count[i] = 0;
+            shadow[i]    = true;
+        }
+        const_sequential_iterator itr = play->begin();
+        op_code_var   op;
+        const addr_t* arg;
+        size_t        i_var;
+        itr.op_info(op, arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+        const addr_t* arg_begin = arg;
+        //
+        pod_vector<bool> is_variable;
+        while( op != EndOp )
+        {   (++itr).op_info(op, arg, i_var);
+            if( level_schedule::is_sequential_op(op) )
+            {   not_ok(accumulate);
+                return;
+            }
+            if( has_reverse(op) )
+            {   struct_level_op op_info;
+                op_info.op    = op;
+                op_info.i_op  = addr_t( itr.op_index() );
+                op_info.i_arg = addr_t( arg - arg_begin );
+                op_info.i_var = addr_t( i_var );
+                op_list.push_back(op_info);
+                //
+                arg_is_variable(op, arg, is_variable);
+                for(size_t j = 0; j < is_variable.size(); ++j)
+                {   if( is_variable[j] )
+                        ++use_count[ arg[j] ];
+                }
+                if( op == PowvpOp )
+                    shadow[ arg[0] ] = false;
+            }
+            if( op == CSumOp )
+                itr.correct_before_increment();
+        }
+        //
+        // shadow, n_shadow_var
+        size_t n_shadow_var = 0;
+        for(size_t i = 0; i < num_var; ++i)
+        {   shadow[i]    &= min_shadow_use() <= size_t( use_count[i] );
+            n_shadow_var += size_t( shadow[i] );
+        }
+        //
+        // op_level, level_count, next_level
+        // next_level[i] is the smallest level that an operator, with a smaller
+        // index, can use if it reads or writes the partial for variable i
+        pod_vector<addr_t> op_level( op_list.size() );
+        pod_vector<size_t> level_count;
+        pod_vector<addr_t> next_level(num_var);
+        for(size_t i = 0; i < num_var; ++i)
+            next_level[i] = 0;
+        size_t k_op = op_list.size();
+        while( k_op-- )
+        {   op    = op_list[k_op].op;
+            arg   = arg_begin + op_list[k_op].i_arg;
+            i_var = size_t( op_list[k_op].i_var );
+            //
+            // level
+            size_t n_res = NumRes(op);
+            size_t level = 0;
+            for(size_t k = 0; k < n_res; ++k)
+                level = std::max(level, size_t( next_level[i_var - k] ) );
+            arg_is_variable(op, arg, is_variable);
+            for(size_t j = 0; j < is_variable.size(); ++j)
+            {   if( is_variable[j] && ! shadow[ arg[j] ] )
+                    level = std::max(level, size_t( next_level[arg[j]] ) );
+            }
+            //
+            // next_level
+            for(size_t j = 0; j < is_variable.size(); ++j)
+            {   if( is_variable[j] )
+                {   addr_t& next = next_level[ arg[j] ];
+                    next         = std::max(next, addr_t(level + 1) );
+                }
+            }
+            //
+            // op_level, level_count
+            op_level[k_op] = addr_t(level);
+            if( level_count.size() <= level )
+                level_count.push_back(0);
+            ++level_count[level];
+        }
+        //
+        // ok_
+        size_t n_level    = level_count.size();
+        size_t n_parallel = 0;
+        for(size_t ell = 0; ell < n_level; ++ell)
+        {   if( 2 * min_task_size <= level_count[ell] )
+                n_parallel += level_count[ell];
+        }
+        if( 2 * n_parallel < op_list.size() )
+        {   not_ok(accumulate);
+            return;
+        }
+        //
+        // level_begin_
+        level_begin_.resize(n_level + 1);
+        level_begin_[0] = 0;
+        for(size_t ell = 0; ell < n_level; ++ell)
+            level_begin_[ell + 1] = level_begin_[ell] + level_count[ell];
+        //
+        // level_op_
+        // in each level, the operators are in decreasing operator index order
+        level_op_.resize( op_list.size() );
+        for(size_t ell = 0; ell < n_level; ++ell)
+            level_count[ell] = level_begin_[ell];
+        k_op = op_list.size();
+        while( k_op-- )
+        {   size_t ell = size_t( op_level[k_op] );
+            level_op_[ level_count[ell]++ ] = op_list[k_op];
+        }
+        op_level.clear();
+        if( n_shadow_var == 0 )
+            return;
+        //
+        // rev_arg_
+        size_t num_arg = play->num_var_arg();
+        rev_arg_.resize(num_arg);
+        for(size_t i = 0; i < num_arg; ++i)
+            rev_arg_[i] = arg_begin[i];
+        //
+        // red_var_, red_begin_, red_level_, rev_arg_
+        if( accumulate )
+            setup_accumulate(arg_begin, shadow, use_count);
+        else
+            setup_deterministic(
+                op_list, arg_begin, shadow, next_level, use_count
+            );
+        //
+        // check that there are shadows and their indices fit in addr_t
+        size_t n_shadow = red_begin_[ red_begin_.size() - 1 ];
+        size_t max_addr = size_t( std::numeric_limits<addr_t>::max() );
+        if( n_shadow == 0 )
+        {   rev_arg_.clear();
+            red_var_.clear();
+            red_begin_.clear();
+            red_level_.clear();
+        }
+        else if( max_addr - num_var < n_shadow )
+            not_ok(accumulate);
+        else
+        {   // level_op_, rev_arg_
+            // during the computations above, shadow s has index num_var + s
+            for(size_t k = 0; k < level_op_.size(); ++k)
+            {   size_t i_arg        = size_t( level_op_[k].i_arg );
+                level_op_[k].i_var += addr_t( n_shadow );
+                arg = arg_begin + i_arg;
+                arg_is_variable(level_op_[k].op, arg, is_variable);
+                for(size_t j = 0; j < is_variable.size(); ++j)
+                {   if( is_variable[j] )
+                    {   size_t index = size_t( rev_arg_[i_arg + j] );
+                        if( index < num_var )
+                            index += n_shadow;
+                        else
+                            index -= num_var;
+                        rev_arg_[i_arg + j] = addr_t( index );
+                    }
+                }
+            }
+        }
+    }
+private:
+    /*!
+    Compute the shadows and reductions for deterministic mode.
+
+    \param op_list
+    operators that have a reverse action in operator index order.
+
+    \param arg_begin
+    beginning of the argument vector for the recording.
+
+    \param shadow
+    is variable i shadowed.
+
+    \param next_level
+    next_level[i] - 1 is the last level that uses variable i.
+
+    \param use_count
+    number of uses of each variable.
+    */
+    void setup_deterministic(
+        const pod_vector<struct_level_op>& op_list      ,
+        const addr_t*                      arg_begin    ,
+        const pod_vector<bool>&            shadow       ,
+        const pod_vector<addr_t>&          next_level   ,
+        const pod_vector<addr_t>&          use_count    )
+    {   size_t num_var = shadow.size();
+        size_t n_level = level_begin_.size() - 1;
+        //
+        // red_level_
+        // the reduction for variable i is at the end of level next_level[i]-1
+        pod_vector<size_t> level_count(n_level);
+        for(size_t ell = 0; ell < n_level; ++ell)
+            level_count[ell] = 0;
+        for(size_t i = 0; i < num_var; ++i)
+        {   if( shadow[i] )
+                ++level_count[ next_level[i] - 1 ];
+        }
+        red_level_.resize(n_level + 1);
+        red_level_[0] = 0;
+        for(size_t ell = 0; ell < n_level; ++ell)
+            red_level_[ell + 1] = red_level_[ell] + level_count[ell];
+        //
+        // red_var_
+        size_t n_red = red_level_[n_level];
+        red_var_.resize(n_red);
+        for(size_t ell = 0; ell < n_level; ++ell)
+            level_count[ell] = red_level_[ell];
+        for(size_t i = 0; i < num_var; ++i)
+        {   if( shadow[i] )
+                red_var_[ level_count[ next_level[i] - 1 ]++ ] = addr_t(i);
+        }
+        //
+        // red_begin_, offset
+        // offset[i] is the next shadow for variable i
+        pod_vector<size_t> offset(num_var);
+        red_begin_.resize(n_red + 1);
+        size_t n_shadow = 0;
+        for(size_t e = 0; e < n_red; ++e)
+        {   size_t i      = size_t( red_var_[e] );
+            red_begin_[e] = n_shadow;
+            offset[i]     = n_shadow;
+            n_shadow     += size_t( use_count[i] );
+        }
+        red_begin_[n_red] = n_shadow;
+        //
+        // rev_arg_
+        // the shadows for a variable are in decreasing operator index order
+        // and in the order that each operator adds to the partials
+        pod_vector<bool> is_variable;
+        size_t k_op = op_list.size();
+        while( k_op-- )
+        {   op_code_var   op    = op_list[k_op].op;
+            size_t        i_arg = size_t( op_list[k_op].i_arg );
+            const addr_t* arg   = arg_begin + i_arg;
+            arg_is_variable(op, arg, is_variable);
+            size_t n_arg = is_variable.size();
+            for(size_t k = 0; k < n_arg; ++k)
+            {   // PowvvOp adds to the partial for arg[1] before arg[0]
+                size_t j = k;
+                if( op == PowvvOp )
+                    j = n_arg - 1 - k;
+                if( is_variable[j] && shadow[ arg[j] ] )
+                {   size_t s            = offset[ arg[j] ]++;
+                    rev_arg_[i_arg + j] = addr_t( num_var + s );
+                }
+            }
+        }
+    }
+    /*!
+    Compute the shadows and reductions for accumulate mode.
+
+    \param arg_begin
+    beginning of the argument vector for the recording.
+
+    \param shadow
+    is variable i shadowed.
+
+    \param use_count
+    work space with size equal to the number of variables.
+    */
+    void setup_accumulate(
+        const addr_t*                      arg_begin    ,
+        const pod_vector<bool>&            shadow       ,
+        pod_vector<addr_t>&                use_count    )
+    {   size_t num_var       = shadow.size();
+        size_t n_level       = level_begin_.size() - 1;
+        size_t min_task_size = level_schedule::min_task_size();
+        //
+        // stamp[i] is one plus the index of the last task that used variable i
+        pod_vector<size_t> stamp(num_var);
+        for(size_t i = 0; i < num_var; ++i)
+            stamp[i] = 0;
+        //
+        // offset[i] is the next shadow for variable i
+        pod_vector<size_t> offset(num_var);
+        //
+        pod_vector<bool> is_variable;
+        red_level_.resize(n_level + 1);
+        size_t n_shadow     = 0;
+        size_t n_task_total = 0;
+        for(size_t ell = 0; ell < n_level; ++ell)
+        {   red_level_[ell] = red_var_.size();
+            size_t n_op     = level_begin_[ell + 1] - level_begin_[ell];
+            size_t n_task   = n_op / min_task_size;
+            if( n_task < 2 )
+                continue;
+            //
+            // red_var_, use_count
+            // use_count[i] is the number of tasks in this level that use
+            // variable i
+            size_t n_task_begin = n_task_total;
+            for(size_t i_task = 0; i_task < n_task; ++i_task)
+            {   ++n_task_total;
+                size_t k_begin = (i_task * n_op) / n_task;
+                size_t k_end   = ( (i_task + 1) * n_op ) / n_task;
+                k_begin       += level_begin_[ell];
+                k_end         += level_begin_[ell];
+                for(size_t k = k_begin; k < k_end; ++k)
+                {   const addr_t* arg = arg_begin + level_op_[k].i_arg;
+                    arg_is_variable(level_op_[k].op, arg, is_variable);
+                    for(size_t j = 0; j < is_variable.size(); ++j)
+                    {   size_t i = 0;
+                        if( is_variable[j] && shadow[ arg[j] ] )
+                            i = size_t( arg[j] );
+                        if( i != 0 && stamp[i] != n_task_total )
+                        {   if( stamp[i] <= n_task_begin )
+                            {   // first use of this variable in this level
+                                red_var_.push_back( addr_t(i) );
+                                use_count[i] = 0;
+                            }
+                            stamp[i] = n_task_total;
+                            ++use_count[i];
+                        }
+                    }
+                }
+            }
+            //
+            // red_begin_, offset
+            for(size_t e = red_level_[ell]; e < red_var_.size(); ++e)
+            {   size_t i = size_t( red_var_[e] );
+                red_begin_.push_back(n_shadow);
+                offset[i]  = n_shadow;
+                n_shadow  += size_t( use_count[i] );
+            }
+            //
+            // rev_arg_
+            // the shadows for a variable are in task order
+            // (n_task_total keeps increasing so stamp values from the
+            // loop above are not confused with the values for this loop)
+            for(size_t i_task = 0; i_task < n_task; ++i_task)
+            {   ++n_task_total;
+                size_t k_begin = (i_task * n_op) / n_task;
+                size_t k_end   = ( (i_task + 1) * n_op ) / n_task;
+                k_begin       += level_begin_[ell];
+                k_end         += level_begin_[ell];
+                for(size_t k = k_begin; k < k_end; ++k)
+                {   size_t        i_arg = size_t( level_op_[k].i_arg );
+                    const addr_t* arg   = arg_begin + i_arg;
+                    arg_is_variable(level_op_[k].op, arg, is_variable);
+                    for(size_t j = 0; j < is_variable.size(); ++j)
+                    {   size_t i = 0;
+                        if( is_variable[j] && shadow[ arg[j] ] )
+                            i = size_t( arg[j] );
+                        if( i != 0 )
+                        {   if( stamp[i] != n_task_total )
+                            {   // first use of this variable by this task
+                                stamp[i] = n_task_total;
+                                ++offset[i];
+                            }
+                            rev_arg_[i_arg + j] =
+                                addr_t( num_var + offset[i] - 1 );
+                        }
+                    }
+                }
+            }
+        }
+        red_level_[n_level] = red_var_.size();
+        red_begin_.push_back(n_shadow);
+    }
+public:
+    /// default constructor
+    reverse_level_schedule(void)
+    : setup_(false), accumulate_(false), ok_(false)
+    { }
+    /// free all the memory for this object; the next setup recomputes
+    /// the schedule
+    void clear(void)
+    {   setup_      = false;
+        accumulate_ = false;
+        ok_         = false;
+        level_op_.clear();
+        level_begin_.clear();
+        rev_arg_.clear();
+        red_var_.clear();
+        red_begin_.clear();
+        red_level_.clear();
+    }
+    /// exchange this object with another object
+    void swap(reverse_level_schedule& other)
+    {   std::swap( setup_, other.setup_ );
+        std::swap( accumulate_, other.accumulate_ );
+        std::swap( ok_, other.ok_ );
+        level_op_.swap( other.level_op_ );
+        level_begin_.swap( other.level_begin_ );
+        rev_arg_.swap( other.rev_arg_ );
+        red_var_.swap( other.red_var_ );
+        red_begin_.swap( other.red_begin_ );
+        red_level_.swap( other.red_level_ );
+    }
+    /// can the operators be evaluated using this schedule
+    /// (setup must have been called for the current recording)
+    bool ok(void) const
+    {   CPPAD_ASSERT_UNKNOWN( setup_ );
+        return ok_;
+    }
+    /// number of levels
+    size_t n_level(void) const
+    {   CPPAD_ASSERT_UNKNOWN( ok_ );
+        return level_begin_.size() - 1;
+    }
+    /// index in level_op() of the first operator in level ell
+    size_t level_begin(size_t ell) const
+    {   CPPAD_ASSERT_UNKNOWN( ok_ );
+        return level_begin_[ell];
+    }
+    /// the operators that have a reverse action in level order
+    /// (if n_shadow() > 0, variable i has index i + n_shadow())
+    const struct_level_op* level_op(void) const
+    {   CPPAD_ASSERT_UNKNOWN( ok_ );
+        return level_op_.data();
+    }
+    /// number of shadows
+    size_t n_shadow(void) const
+    {   CPPAD_ASSERT_UNKNOWN( ok_ );
+        if( red_begin_.size() == 0 )
+            return 0;
+        return red_begin_[ red_begin_.size() - 1 ];
+    }
+    /// argument vector with shadows (only defined if n_shadow() > 0)
+    /// where shadow s has index s and variable i has index i + n_shadow()
+    const addr_t* rev_arg(void) const
+    {   CPPAD_ASSERT_UNKNOWN( 0 < n_shadow() );
+        return rev_arg_.data();
+    }
+    /// the variable for each reduction (only defined if n_shadow() > 0)
+    /// using the index in the recording
+    const addr_t* red_var(void) const
+    {   CPPAD_ASSERT_UNKNOWN( 0 < n_shadow() );
+        return red_var_.data();
+    }
+    /// the first shadow for each reduction (only defined if n_shadow() > 0)
+    const size_t* red_begin(void) const
+    {   CPPAD_ASSERT_UNKNOWN( 0 < n_shadow() );
+        return red_begin_.data();
+    }
+    /// index in red_var() of the first reduction for level ell
+    /// (only defined if n_shadow() > 0)
+    size_t red_level(size_t ell) const
+    {   CPPAD_ASSERT_UNKNOWN( 0 < n_shadow() );
+        return red_level_[ell];
+    }
+};
+
+} } } // END_CPPAD_LOCAL_PLAY_NAMESPACE
+
+# endif
@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_PLAY_SEQUENTIAL_ITERATOR_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 // BEGIN_CPPAD_LOCAL_PLAY_NAMESPACE
@@ -20,7 +20,7 @@ An integer type capable of representing the largest value in the vectors
 var_arg, op2arg_index, op2var_index, var2op_index.
 
 \par
-Except for constructor, the public API for this class is the same as
+Except for constructor and jump, the public API for this class is the same as
 for the subgraph_iterator class.
 */
 class const_sequential_iterator {
@@ -282,6 +282,28 @@ public:
         CPPAD_ASSERT_UNKNOWN( var_index_ < num_var_ || NumRes(op) == 0 );
         var_index = var_index_;
     }
+    /*!
+    Move iterator to an arbitrary operator
+
+    \param op_index
+    is the index of the new current operator.
+
+    \param arg_index
+    is the index in var_arg of the first argument for this operator.
+
+    \param var_index
+    is the index of the last result for this operator; i.e.,
+    the value that op_info would return for var_index if the iterator
+    had been incremented to this operator.
+    */
+    void jump(size_t op_index, size_t arg_index, size_t var_index)
+    {   op_cur_    = op_begin_ + op_index;
+        CPPAD_ASSERT_UNKNOWN( op_cur_ < op_end_ );
+        op_        = op_code_var( *op_cur_ );
+        arg_       = arg_begin_ + arg_index;
+        CPPAD_ASSERT_UNKNOWN( arg_ <= arg_end_ );
+        var_index_ = var_index;
+    }
     /// current operator index
     size_t op_index(void)
     {   return size_t(op_cur_ - op_begin_); }
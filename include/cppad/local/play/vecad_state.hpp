@@ -0,0 +1,106 @@
+# ifndef CPPAD_LOCAL_PLAY_VECAD_STATE_HPP
+# define CPPAD_LOCAL_PLAY_VECAD_STATE_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+# include <cppad/local/pod_vector.hpp>
+
+// BEGIN_CPPAD_LOCAL_PLAY_NAMESPACE
+namespace CppAD { namespace local { namespace play {
+
+/*!
+\file vecad_state.hpp
+*/
+/*!
+State of the VecAD vectors during a zero order forward sweep.
+
+The state is kept between sweeps so that it does not need to be
+recomputed for every element of every VecAD vector at the start of each
+zero order forward sweep. Instead, only the elements that were changed
+by a store operation during the previous sweep are restored to
+their initial values.
+*/
+class vecad_state {
+private:
+    /// is the value of each element a variable (otherwise a parameter)
+    pod_vector<bool>   isvar_;
+    /// variable or parameter index for each element
+    /// (and the length of each vector at the index before its first element)
+    pod_vector<size_t> index_;
+    /// indices in isvar_ and index_ that have been set since the last reset
+    pod_vector<size_t> changed_;
+public:
+    /// free all the memory for this state; the next reset does a full
+    /// initialization
+    void clear(void)
+    {   isvar_.clear();
+        index_.clear();
+        changed_.clear();
+    }
+    /// exchange this state with another state
+    void swap(vecad_state& other)
+    {   isvar_.swap( other.isvar_ );
+        index_.swap( other.index_ );
+        changed_.swap( other.changed_ );
+    }
+    /*!
+    Set the state to the initial value for the VecAD vectors in a player.
+
+    \param play
+    is the player for the operation sequence. This state must have been
+    cleared, or only used with this player, since the player's recording
+    was last changed.
+    */
+    template <class Player>
+    void reset(const Player* play)
+    {   size_t num = play->num_var_vec_ind();
+        if( index_.size() != num )
+        {   // initialize all the elements
+            isvar_.resize(num);
+            index_.resize(num);
+            for(size_t i = 0; i < num; ++i)
+            {   index_[i] = play->GetVecInd(i);
+                isvar_[i] = false;
+            }
+        }
+        else
+        {   // restore the elements that have changed
+            for(size_t k = 0; k < changed_.size(); ++k)
+            {   size_t i  = changed_[k];
+                index_[i] = play->GetVecInd(i);
+                isvar_[i] = false;
+            }
+        }
+        changed_.resize(0);
+    }
+    /*!
+    Set the value of one element of a VecAD vector.
+
+    \param i
+    is the index of the element in isvar and index.
+
+    \param isvar
+    is the new value is a variable (otherwise it is a parameter).
+
+    \param index
+    is the variable or parameter index for the new value.
+    */
+    void set(size_t i, bool isvar, size_t index)
+    {   CPPAD_ASSERT_UNKNOWN( i < index_.size() );
+        changed_.push_back(i);
+        isvar_[i] = isvar;
+        index_[i] = index;
+    }
+    /// is the value of each element a variable
+    const pod_vector<bool>& isvar(void) const
+    {   return isvar_; }
+    /// variable or parameter index for each element
+    const pod_vector<size_t>& index(void) const
+    {   return index_; }
+};
+
+} } } // BEGIN_CPPAD_LOCAL_PLAY_NAMESPACE
+
+# endif
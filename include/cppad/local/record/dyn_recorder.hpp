@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_RECORD_DYN_RECORDER_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 # include <cppad/core/hash_code.hpp>
 # include <cppad/local/pod_vector.hpp>
@@ -49,6 +49,27 @@ memory
     // END_MEMORY
 }
 
+reset
+*****
+{xrst_literal
+    // BEGIN_RESET
+    // END_RESET
+}
+This sets the dynamic parameter recording to its state directly after
+the constructor. The hash table is not zeroed because each of its entries
+is checked before it is used.
+The capacity of the vectors is not changed so that they can be reused
+by the next recording.
+
+reserve
+*******
+{xrst_literal
+    // BEGIN_RESERVE
+    // END_RESERVE
+}
+This makes sure the capacity of the vectors that hold the parameters is
+at least *n_par* so that they are not reallocated while recording
+the first *n_par* parameters.
 
 {xrst_end dyn_recorder}
 */
@@ -114,6 +135,32 @@ public:
     ~dyn_recorder(void)
     { }
     //
+    // BEGIN_RESET
+    // dyn_record.reset()
+    void reset(void)
+    // END_RESET
+    {   n_dyn_independent_ = 0;
+        dyn_vecad_ind_.resize(0);
+        par_all_.resize(0);
+        par_is_dyn_.resize(0);
+        dyn_par_op_.resize(0);
+        dyn_par_arg_.resize(0);
+    }
+    //
+    // BEGIN_RESERVE
+    // dyn_record.reserve(n_par)
+    void reserve(size_t n_par)
+    // END_RESERVE
+    {   // extend followed by resize does not change the capacity
+        size_t size = par_all_.size();
+        if( size < n_par )
+        {   par_all_.extend(n_par - size);
+            par_all_.resize(size);
+            par_is_dyn_.extend(n_par - size);
+            par_is_dyn_.resize(size);
+        }
+    }
+    //
     // BEGIN_SET_NUM_DYNAMIC_IND
     // dyn_record.set_n_dyn_independent(n_dyn_independent)
     void set_n_dyn_independent(size_t n_dyn_independent)
@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_RECORD_RECORDER_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 # include <cppad/core/hash_code.hpp>
 # include <cppad/local/pod_vector.hpp>
@@ -105,6 +105,29 @@ Memory
     // END_MEMORY
 }
 
+reset
+*****
+{xrst_literal
+    // BEGIN_RESET
+    // END_RESET
+}
+This sets the recording to its state directly after the constructor.
+The capacity of the vectors is not changed so that they can be reused
+by the next recording; see :ref:`dyn_recorder@reset` .
+
+reserve
+*******
+{xrst_literal
+    // BEGIN_RESERVE
+    // END_RESERVE
+}
+This makes sure the capacity of the vectors that hold the variable
+operators, their arguments, and the parameters is at least
+*n_var_op* , *n_var_arg* , and *n_par* respectively;
+see :ref:`dyn_recorder@reserve` .
+This is useful when the size of a recording is known in advance; e.g.,
+:ref:`from_graph-name` .
+
 
 Contents
 ********
@@ -181,6 +204,40 @@ public:
     // Destructor
     ~recorder(void)
     { }
+    //
+    // BEGIN_RESET
+    // recorder.reset()
+    void reset(void)
+    // END_RESET
+    {   dyn_record_.reset();
+        record_compare_ = true;
+        abort_op_index_ = 0;
+        num_var_        = 0;
+        num_var_load_   = 0;
+        var_op_.resize(0);
+        var_vecad_ind_.resize(0);
+        var_arg_.resize(0);
+        var_text_.resize(0);
+    }
+    //
+    // BEGIN_RESERVE
+    // recorder.reserve(n_var_op, n_var_arg, n_par)
+    void reserve(size_t n_var_op, size_t n_var_arg, size_t n_par)
+    // END_RESERVE
+    {   dyn_record_.reserve(n_par);
+        //
+        // extend followed by resize does not change the capacity
+        size_t size = var_op_.size();
+        if( size < n_var_op )
+        {   var_op_.extend(n_var_op - size);
+            var_op_.resize(size);
+        }
+        size = var_arg_.size();
+        if( size < n_var_arg )
+        {   var_arg_.extend(n_var_arg - size);
+            var_arg_.resize(size);
+        }
+    }
     // ------------------------------------------------------------------------
     // Parameter Operations
     // ------------------------------------------------------------------------
@@ -0,0 +1,170 @@
+# ifndef CPPAD_LOCAL_SPARSE_CHUNK_HPP
+# define CPPAD_LOCAL_SPARSE_CHUNK_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+// necessary definitions
+# include <cppad/local/define.hpp>
+# include <cppad/utility/sparse_rc.hpp>
+
+// BEGIN_CPPAD_LOCAL_SPARSE_NAMESPACE
+namespace CppAD { namespace local { namespace sparse {
+
+/*!
+\file sparse/chunk.hpp
+Routines that convert between a sparsity pattern and the sparsity pattern
+for a contiguous chunk of its seed indices.
+*/
+// ---------------------------------------------------------------------------
+/*!
+Extract the sparsity pattern for a chunk of the seed indices.
+
+\tparam SizeVector
+The type used for index sparsity patterns. This is a simple vector
+with elements of type size_t.
+
+\param seed_is_row
+If this is true (false) the seed index is the row (column) index
+in pattern_in and pattern_out.
+
+\param chunk_begin
+is the first seed index in the chunk.
+
+\param chunk_end
+is one greater than the last seed index in the chunk.
+
+\param pattern_in
+is the sparsity pattern that the chunk is extracted from.
+
+\param pattern_out
+The input value of pattern_out does not matter.
+Upon return it contains the entries in pattern_in that have seed index
+in the interval [chunk_begin, chunk_end) with chunk_begin subtracted
+from the seed index.
+The seed dimension of pattern_out is chunk_end - chunk_begin.
+The other dimension is the same as for pattern_in.
+*/
+template <class SizeVector>
+void get_chunk_pattern(
+    bool                          seed_is_row  ,
+    size_t                        chunk_begin  ,
+    size_t                        chunk_end    ,
+    const sparse_rc<SizeVector>&  pattern_in   ,
+    sparse_rc<SizeVector>&        pattern_out  )
+{   CPPAD_ASSERT_UNKNOWN( chunk_begin <= chunk_end );
+    //
+    const SizeVector& row( pattern_in.row() );
+    const SizeVector& col( pattern_in.col() );
+    size_t nnz_in = pattern_in.nnz();
+    //
+    // nr, nc
+    size_t nr = pattern_in.nr();
+    size_t nc = pattern_in.nc();
+    if( seed_is_row )
+    {   CPPAD_ASSERT_UNKNOWN( chunk_end <= nr );
+        nr = chunk_end - chunk_begin;
+    }
+    else
+    {   CPPAD_ASSERT_UNKNOWN( chunk_end <= nc );
+        nc = chunk_end - chunk_begin;
+    }
+    //
+    // nnz
+    size_t nnz = 0;
+    for(size_t k = 0; k < nnz_in; ++k)
+    {   size_t seed = seed_is_row ? row[k] : col[k];
+        if( chunk_begin <= seed && seed < chunk_end )
+            ++nnz;
+    }
+    //
+    // pattern_out
+    pattern_out.resize(nr, nc, nnz);
+    size_t ell = 0;
+    for(size_t k = 0; k < nnz_in; ++k)
+    {   size_t r = row[k];
+        size_t c = col[k];
+        size_t seed = seed_is_row ? r : c;
+        if( chunk_begin <= seed && seed < chunk_end )
+        {   if( seed_is_row )
+                r -= chunk_begin;
+            else
+                c -= chunk_begin;
+            pattern_out.set(ell++, r, c);
+        }
+    }
+    CPPAD_ASSERT_UNKNOWN( ell == nnz );
+    return;
+}
+// ---------------------------------------------------------------------------
+/*!
+Convert the sparsity pattern for a chunk of the seed indices to a sparsity
+pattern with the full seed dimension.
+
+\tparam SizeVector
+The type used for index sparsity patterns. This is a simple vector
+with elements of type size_t.
+
+\param seed_is_row
+If this is true (false) the seed index is the row (column) index
+in pattern_in and pattern_out.
+
+\param chunk_begin
+is the first seed index in the chunk.
+
+\param n_seed
+is the seed dimension for pattern_out.
+
+\param pattern_in
+is the sparsity pattern for the chunk; i.e., its seed dimension is
+the number of seeds in the chunk.
+
+\param pattern_out
+The input value of pattern_out does not matter.
+Upon return it contains the entries in pattern_in with chunk_begin
+added to the seed index.
+The seed dimension of pattern_out is n_seed.
+The other dimension is the same as for pattern_in.
+*/
+template <class SizeVector>
+void set_chunk_pattern(
+    bool                          seed_is_row  ,
+    size_t                        chunk_begin  ,
+    size_t                        n_seed       ,
+    const sparse_rc<SizeVector>&  pattern_in   ,
+    sparse_rc<SizeVector>&        pattern_out  )
+{   //
+    const SizeVector& row( pattern_in.row() );
+    const SizeVector& col( pattern_in.col() );
+    size_t nnz = pattern_in.nnz();
+    //
+    // nr, nc
+    size_t nr = pattern_in.nr();
+    size_t nc = pattern_in.nc();
+    if( seed_is_row )
+    {   CPPAD_ASSERT_UNKNOWN( chunk_begin + nr <= n_seed );
+        nr = n_seed;
+    }
+    else
+    {   CPPAD_ASSERT_UNKNOWN( chunk_begin + nc <= n_seed );
+        nc = n_seed;
+    }
+    //
+    // pattern_out
+    pattern_out.resize(nr, nc, nnz);
+    for(size_t k = 0; k < nnz; ++k)
+    {   size_t r = row[k];
+        size_t c = col[k];
+        if( seed_is_row )
+            r += chunk_begin;
+        else
+            c += chunk_begin;
+        pattern_out.set(k, r, c);
+    }
+    return;
+}
+
+} } } // END_CPPAD_LOCAL_SPARSE_NAMESPACE
+
+# endif
@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_SPARSE_PACK_SETVEC_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 # include <cppad/core/cppad_assert.hpp>
 # include <cppad/local/pod_vector.hpp>
@@ -418,10 +418,11 @@ public:
             return count;
         //
         // count bits in other units
+        mask = one_;
         for(size_t bit = 0; bit < n_bit_; ++bit)
         {  CPPAD_ASSERT_UNKNOWN( mask >= one_ );
-            size_t k = n_pack_;
-            while(--k)
+            size_t k = n_pack_ - 1;
+            while(k--)
             {  if( data_[i * n_pack_ + k] & mask )
                     ++count;
             }
@@ -0,0 +1,256 @@
+# ifndef CPPAD_LOCAL_SPARSE_PATTERN_CACHE_HPP
+# define CPPAD_LOCAL_SPARSE_PATTERN_CACHE_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+# include <limits>
+# include <cppad/local/define.hpp>
+# include <cppad/utility/vector.hpp>
+# include <cppad/utility/sparse_rc.hpp>
+
+// BEGIN_CPPAD_LOCAL_SPARSE_NAMESPACE
+namespace CppAD { namespace local { namespace sparse {
+/*!
+\file pattern_cache.hpp
+Sparsity patterns attached to an ADFun object and keyed by the arguments
+that were used to compute them.
+*/
+
+/// class for caching the sparsity patterns computed by one ADFun object.
+class pattern_cache {
+public:
+    /// type used for the key that identifies a sparsity calculation
+    typedef CppAD::vector<size_t> key_type;
+
+    /// routine that computed a sparsity pattern (first element of a key)
+    enum routine_enum {
+        for_jac_enum,
+        rev_jac_enum,
+        for_hes_enum,
+        rev_hes_enum,
+        subgraph_enum
+    };
+private:
+    /// type used to store the patterns
+    typedef sparse_rc< CppAD::vector<size_t> > pattern_type;
+
+    /// is the cache in use
+    bool use_cache_;
+
+    /// number of times a pattern was found in the cache
+    size_t n_hit_;
+
+    /// number of times a pattern was computed while the cache was in use
+    size_t n_miss_;
+
+    /// key for the for_jac_sparsity calculation that set the forward
+    /// Jacobian sparsity patterns stored in the ADFun object
+    /// (size zero if these patterns do not correspond to a key).
+    key_type for_jac_key_;
+
+    /// key_[k] is the key corresponding to pattern_[k]
+    CppAD::vector<key_type> key_;
+
+    /// pattern_[k] is the result for the calculation corresponding to key_[k]
+    CppAD::vector<pattern_type> pattern_;
+
+    /// are two keys equal (the keys may have different sizes)
+    static bool equal(const key_type& left, const key_type& right)
+    {   if( left.size() != right.size() )
+            return false;
+        for(size_t i = 0; i < left.size(); ++i)
+            if( left[i] != right[i] )
+                return false;
+        return true;
+    }
+public:
+    // -----------------------------------------------------------------------
+    /// default constructor (cache not in use)
+    pattern_cache(void)
+    : use_cache_(false), n_hit_(0), n_miss_(0)
+    { }
+
+    /// swap with another cache
+    void swap(pattern_cache& other)
+    {   std::swap(use_cache_, other.use_cache_);
+        std::swap(n_hit_,     other.n_hit_);
+        std::swap(n_miss_,    other.n_miss_);
+        for_jac_key_.swap( other.for_jac_key_ );
+        key_.swap( other.key_ );
+        pattern_.swap( other.pattern_ );
+    }
+    // -----------------------------------------------------------------------
+    /// is the cache in use
+    bool use(void) const
+    {   return use_cache_; }
+
+    /// number of cache hits
+    size_t n_hit(void) const
+    {   return n_hit_; }
+
+    /// number of cache misses
+    size_t n_miss(void) const
+    {   return n_miss_; }
+
+    /// number of patterns in the cache
+    size_t size(void) const
+    {   return key_.size(); }
+
+    /// is key the key for the forward Jacobian sparsity patterns
+    /// in the ADFun object
+    bool is_for_jac(const key_type& key) const
+    {   return for_jac_key_.size() != 0 && equal(for_jac_key_, key); }
+
+    /// key for the forward Jacobian sparsity patterns in the ADFun object
+    const key_type& for_jac_key(void) const
+    {   return for_jac_key_; }
+    // -----------------------------------------------------------------------
+    /*!
+    Set the use flag for this cache.
+
+    \param use_cache
+    If true (false) the cache is (is not) used.
+    If false, all the patterns are removed from the cache and the
+    hit and miss counters are set to zero.
+    */
+    void use(bool use_cache)
+    {   use_cache_ = use_cache;
+        if( ! use_cache )
+        {   clear();
+            n_hit_  = 0;
+            n_miss_ = 0;
+        }
+    }
+
+    /// remove all patterns from the cache
+    /// (call this whenever the operation sequence changes)
+    void clear(void)
+    {   for_jac_key_.clear();
+        key_.clear();
+        pattern_.clear();
+    }
+
+    /// forward Jacobian sparsity patterns in the ADFun object have changed
+    void clear_for_jac(void)
+    {   for_jac_key_.clear(); }
+
+    /// set key for forward Jacobian sparsity patterns in the ADFun object
+    void set_for_jac(const key_type& key)
+    {   for_jac_key_ = key; }
+    // -----------------------------------------------------------------------
+    /*!
+    Search for a pattern in the cache.
+
+    \param key
+    is the key for the sparsity calculation.
+
+    \param pattern_out
+    If the return value is true, pattern_out is set to the
+    corresponding pattern. Otherwise it is not modified.
+
+    \return
+    is true (false) if the pattern is (is not) in the cache.
+    If it is true, the hit counter is incremented.
+    */
+    template <class SizeVector>
+    bool get(const key_type& key, sparse_rc<SizeVector>& pattern_out)
+    {   CPPAD_ASSERT_UNKNOWN( use_cache_ );
+        for(size_t k = 0; k < key_.size(); ++k)
+        {   if( equal(key_[k], key) )
+            {   const pattern_type& pattern = pattern_[k];
+                size_t nnz = pattern.nnz();
+                pattern_out.resize(pattern.nr(), pattern.nc(), nnz);
+                for(size_t ell = 0; ell < nnz; ++ell) pattern_out.set(
+                    ell, pattern.row()[ell], pattern.col()[ell]
+                );
+                ++n_hit_;
+                return true;
+            }
+        }
+        return false;
+    }
+    /*!
+    Store a pattern in the cache and increment the miss counter.
+
+    \param key
+    is the key for the sparsity calculation.
+
+    \param pattern
+    is the result of the sparsity calculation.
+    */
+    template <class SizeVector>
+    void set(const key_type& key, const sparse_rc<SizeVector>& pattern)
+    {   CPPAD_ASSERT_UNKNOWN( use_cache_ );
+        size_t nnz = pattern.nnz();
+        pattern_type pattern_copy(pattern.nr(), pattern.nc(), nnz);
+        for(size_t ell = 0; ell < nnz; ++ell)
+            pattern_copy.set(ell, pattern.row()[ell], pattern.col()[ell]);
+        //
+        // replace the pattern if this key is already in the cache
+        size_t k = 0;
+        while( k < key_.size() && ! equal(key_[k], key) )
+            ++k;
+        if( k == key_.size() )
+        {   key_.push_back(key);
+            pattern_.push_back(pattern_copy);
+        }
+        else
+            pattern_[k] = pattern_copy;
+        ++n_miss_;
+    }
+    // -----------------------------------------------------------------------
+    /*!
+    Append a vector of boolean values to a key.
+
+    \param key
+    The size of the vector followed by its values, packed into size_t bits,
+    is appended to key.
+
+    \param select
+    is the vector of boolean values.
+    */
+    template <class BoolVector>
+    static void append_select(key_type& key, const BoolVector& select)
+    {   size_t n     = size_t( select.size() );
+        size_t n_bit = size_t( std::numeric_limits<size_t>::digits );
+        key.push_back(n);
+        size_t pack = 0;
+        for(size_t j = 0; j < n; ++j)
+        {   if( select[j] )
+                pack |= size_t(1) << (j % n_bit);
+            if( j % n_bit == n_bit - 1 || j + 1 == n )
+            {   key.push_back(pack);
+                pack = 0;
+            }
+        }
+    }
+    /*!
+    Append a sparsity pattern to a key.
+
+    \param key
+    The number of rows, columns, possibly non-zeros, row indices,
+    and column indices for the pattern are appended to key.
+
+    \param pattern
+    is the sparsity pattern.
+    */
+    template <class SizeVector>
+    static void append_pattern(
+        key_type& key, const sparse_rc<SizeVector>& pattern
+    )
+    {   size_t nnz = pattern.nnz();
+        key.push_back( pattern.nr() );
+        key.push_back( pattern.nc() );
+        key.push_back( nnz );
+        for(size_t k = 0; k < nnz; ++k)
+            key.push_back( pattern.row()[k] );
+        for(size_t k = 0; k < nnz; ++k)
+            key.push_back( pattern.col()[k] );
+    }
+};
+
+} } } // END_CPPAD_LOCAL_SPARSE_NAMESPACE
+
+# endif
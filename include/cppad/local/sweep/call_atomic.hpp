@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_SWEEP_CALL_ATOMIC_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cppad/local/atomic_index.hpp>
@@ -341,6 +341,132 @@ void call_atomic_reverse(
 }
 // ----------------------------------------------------------------------------
 /*
+{xrst_begin atomic_batch_callback dev}
+
+Batched Forward and Reverse Callbacks to Atomic Functions
+#########################################################
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_FORWARD_BATCH
+    // END_FORWARD_BATCH
+}
+{xrst_literal
+    // BEGIN_REVERSE_BATCH
+    // END_REVERSE_BATCH
+}
+
+Base, RecBase, vector
+*********************
+see :ref:`atomic_forward_callback-name` .
+
+atom_index
+**********
+is the index, in local::atomic_index, corresponding to this atomic function.
+If this is not an atomic_three or atomic_four function,
+the return value is false.
+
+call_id
+*******
+is the vector of atomic_four :ref:`atomic_four_call@call_id` values
+for the calls in this batch.
+Its size is the number of calls in the batch
+(its values are not used for atomic_three functions).
+
+Other Arguments
+***************
+The other arguments are the same as for
+:ref:`atomic_three_batch-name` and :ref:`atomic_four_batch-name` .
+
+ok
+**
+The return value is true if the batch callback succeeded.
+If it is false, the caller must evaluate the calls one at a time.
+
+{xrst_end atomic_batch_callback}
+*/
+// BEGIN_FORWARD_BATCH
+template <class Base, class RecBase>
+bool call_atomic_forward_batch(
+    const vector<Base>&          parameter_x ,
+    const vector<ad_type_enum>&  type_x      ,
+    size_t                       need_y      ,
+    const vector<bool>&          select_y    ,
+    size_t                       order_low   ,
+    size_t                       order_up    ,
+    size_t                       atom_index  ,
+    const vector<size_t>&        call_id     ,
+    const vector<Base>&          taylor_x    ,
+    vector<Base>&                taylor_y    )
+// END_FORWARD_BATCH
+{  CPPAD_ASSERT_UNKNOWN( 0 < atom_index );
+    bool         set_null = false;
+    size_t       type     = 0;          // set to avoid warning
+    std::string* name_ptr = nullptr;
+    void*        v_ptr    = nullptr; // set to avoid warning
+    local::atomic_index<RecBase>(set_null, atom_index, type, name_ptr, v_ptr);
+    if( v_ptr == nullptr )
+        return false;
+    if( type == 3 )
+    {   atomic_three<RecBase>* afun =
+            reinterpret_cast< atomic_three<RecBase>* >(v_ptr);
+        return afun->forward_batch(
+            call_id.size(), parameter_x, type_x,
+            need_y, order_low, order_up, taylor_x, taylor_y
+        );
+    }
+    if( type == 4 )
+    {   atomic_four<RecBase>* afun =
+            reinterpret_cast< atomic_four<RecBase>* >(v_ptr);
+        return afun->forward_batch(
+            call_id, select_y, order_low, order_up, taylor_x, taylor_y
+        );
+    }
+    return false;
+}
+// BEGIN_REVERSE_BATCH
+template <class Base, class RecBase>
+bool call_atomic_reverse_batch(
+    const vector<Base>&          parameter_x ,
+    const vector<ad_type_enum>&  type_x      ,
+    const vector<bool>&          select_x    ,
+    size_t                       order_up    ,
+    size_t                       atom_index  ,
+    const vector<size_t>&        call_id     ,
+    const vector<Base>&          taylor_x    ,
+    const vector<Base>&          taylor_y    ,
+    vector<Base>&                partial_x   ,
+    const vector<Base>&          partial_y   )
+// END_REVERSE_BATCH
+{  CPPAD_ASSERT_UNKNOWN( 0 < atom_index );
+    bool         set_null = false;
+    size_t       type     = 0;          // set to avoid warning
+    std::string* name_ptr = nullptr;
+    void*        v_ptr    = nullptr; // set to avoid warning
+    local::atomic_index<RecBase>(set_null, atom_index, type, name_ptr, v_ptr);
+    if( v_ptr == nullptr )
+        return false;
+    if( type == 3 )
+    {   atomic_three<RecBase>* afun =
+            reinterpret_cast< atomic_three<RecBase>* >(v_ptr);
+        return afun->reverse_batch(
+            call_id.size(), parameter_x, type_x,
+            order_up, taylor_x, taylor_y, partial_x, partial_y
+        );
+    }
+    if( type == 4 )
+    {   atomic_four<RecBase>* afun =
+            reinterpret_cast< atomic_four<RecBase>* >(v_ptr);
+        return afun->reverse_batch(
+            call_id, select_x,
+            order_up, taylor_x, taylor_y, partial_x, partial_y
+        );
+    }
+    return false;
+}
+// ----------------------------------------------------------------------------
+/*
 {xrst_begin atomic_for_jac_sparsity_callback dev}
 {xrst_spell
     setvec
@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_SWEEP_DYNAMIC_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cppad/local/play/atom_op_info.hpp>
@@ -68,8 +68,26 @@ where
 The arguments for each dynamic parameter have index value
 lower than the index value for the parameter.
 
+\param incremental
+If incremental is true, a dependent dynamic parameter is only recomputed
+if one of its arguments has changed, or if its current value is nan,
+or if it is the result of an atomic function call.
+In this case, the values in par_all for the dynamic parameters must
+correspond to a previous call to this routine (or to the recording).
+If incremental is false, all the dynamic parameters are recomputed.
+
+\param par_changed
+The input size of this vector does not matter.
+Upon return it has size par_all.size() and par_changed[i] is true if
+the i-th parameter is dynamic and its value was changed by this call.
+If incremental is false, par_changed[i] is equal to par_is_dyn[i].
+
 \param not_used_rec_base
 Specifies RecBase for this call.
+
+\return
+The return value is the number of dynamic parameter operators that were
+evaluated (atomic function results are not included in this count).
 */
 
 template <class RecBase>
@@ -84,18 +102,28 @@ AD<RecBase> discrete_eval(
 
 
 template <class Base, class BaseVector, class RecBase>
-void dynamic(
+size_t dynamic(
     pod_vector_maybe<Base>&       par_all            ,
     const BaseVector&             ind_dynamic        ,
     const pod_vector<bool>&       par_is_dyn         ,
     const pod_vector<addr_t>&     dyn2par_index      ,
     const pod_vector<opcode_t>&   dyn_par_op         ,
     const pod_vector<addr_t>&     dyn_par_arg        ,
+    bool                          incremental        ,
+    pod_vector<bool>&             par_changed        ,
     const RecBase&                not_used_rec_base  )
 {
     // number of dynamic parameters
     size_t num_dynamic_par = dyn2par_index.size();
 
+    // par_changed
+    par_changed.resize( par_all.size() );
+    for(size_t i = 0; i < par_all.size(); ++i)
+        par_changed[i] = false;
+
+    // n_eval
+    size_t n_eval = 0;
+
     // vectors used in call to atomic functions
     vector<ad_type_enum> type_x;
     vector<Base>         taylor_x, taylor_y;
@@ -164,6 +192,34 @@ void dynamic(
                 par[j] = & par_all[ dyn_par_arg[i_arg + j] ];
         }
         //
+        // eval
+        // Atomic functions may have state that is not in their arguments
+        // so they are always evaluated.
+        bool eval = true;
+        if( incremental && op != atom_dyn && op != result_dyn )
+        {   if( op == ind_dyn )
+                eval = ! IdenticalEqualCon(par_all[i_par], ind_dynamic[i_dyn]);
+            else
+            {   // j_first: index of first argument that is a parameter
+                size_t j_first = 0;
+                if( op == dis_dyn || op == cond_exp_dyn )
+                    j_first = 1;
+                eval = CppAD::isnan( par_all[i_par] );
+                for(size_t j = j_first; j < n_arg; ++j)
+                    eval |= par_changed[ dyn_par_arg[i_arg + j] ];
+            }
+        }
+        if( ! eval )
+        {   i_arg += n_arg;
+            i_dyn += n_dyn;
+            continue;
+        }
+        if( op != atom_dyn && op != result_dyn )
+            ++n_eval;
+        //
+        // old_par
+        Base old_par = par_all[i_par];
+        //
         switch(op)
         {
             // ---------------------------------------------------------------
@@ -492,6 +548,8 @@ void dynamic(
                 {   i_par = size_t( dyn_par_arg[i_arg + 5 + n + i] );
                     if( par_is_dyn[i_par] )
                     {   CPPAD_ASSERT_UNKNOWN( i_par != 0 );
+                        par_changed[i_par] = ! incremental ||
+                            ! IdenticalEqualCon(par_all[i_par], taylor_y[i]);
                         par_all[i_par] = taylor_y[i];
 # ifndef NDEBUG
                         ++count_dyn;
@@ -555,11 +613,17 @@ void dynamic(
             std::cout << ")" << std::endl;
         }
 # endif
+        //
+        // par_changed
+        if( op != atom_dyn && op != result_dyn )
+        {   par_changed[i_par] = ! incremental ||
+                ! IdenticalEqualCon(old_par, par_all[i_par]);
+        }
         i_arg += n_arg;
         i_dyn += n_dyn;
     }
     CPPAD_ASSERT_UNKNOWN( i_arg == dyn_par_arg.size() )
-    return;
+    return n_eval;
 }
 
 // preprocessor symbols that are local to this file
@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_SWEEP_FORWARD_0_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cppad/local/play/atom_op_info.hpp>
@@ -39,6 +39,23 @@ namespace CppAD { namespace local { namespace sweep {
     @****@  ; *********
 }
 
+unchanged
+*********
+If *unchanged* is null, all the operators are evaluated.
+Otherwise, it has size *play* ``->num_var_op()`` and the
+operators for which *unchanged* [ *i_op* ] is true are not evaluated;
+i.e., *taylor* already contains their zero order results.
+This is used to skip operators that do not depend on
+parameters or independent variables that changed since the
+previous zero order forward sweep; see :ref:`sweep_unchanged_op-name` .
+
+double_sum
+**********
+If *double_sum* is true, the cumulative summation operators are evaluated
+using :ref:`var_csum_forward_sum-name` ; i.e., if *Base* is ``float`` ,
+the summations are done using ``double`` .
+Otherwise, they are evaluated using :ref:`var_csum_forward_any-name` .
+
 {xrst_end sweep_forward_0}
 */
 
@@ -56,7 +73,9 @@ void forward_0(
     size_t&                    change_op_index,
     std::ostream&              s_out,
     bool                       print,
-    Base*                      taylor
+    Base*                      taylor,
+    const bool*                unchanged,
+    bool                       double_sum
 )
 // END_FORWARD_0
 {   CPPAD_ASSERT_UNKNOWN( cap_order >= 1 );
@@ -74,25 +93,31 @@ void forward_0(
     }
 
     // If this includes a zero calculation, initialize this information
-    pod_vector<bool>   vec_ad2isvar;
-    pod_vector<size_t> vec_ad2index;
+    // (the VecAD state is kept by play between zero order sweeps)
+    local::play::vecad_state& vecad = play->vecad_state();
+    //
+    // blocks of operators that are jumped over when they are skipped
+    local::play::cskip_jump& cskip = play->cskip_jump();
     if( order_low == 0 )
     {   size_t i;
 
         // this includes order zero calculation, initialize vector indices
-        size_t num = play->num_var_vec_ind();
-        if( num > 0 )
-        {   vec_ad2isvar.extend(num);
-            vec_ad2index.extend(num);
-            for(i = 0; i < num; i++)
-            {   vec_ad2index[i] = play->GetVecInd(i);
-                vec_ad2isvar[i] = false;
-            }
-        }
+        // (only the elements changed by the previous sweep are restored)
+        vecad.reset(play);
+
+        // no operators are skipped yet, so no blocks of operators are
+        // jumped over
+        cskip.clear_jump();
+
         // includes zero order, so initialize conditional skip flags
-        num = play->num_var_op();
+        // (skip the operators with unchanged results)
+        size_t num = play->num_var_op();
         for(i = 0; i < num; i++)
             cskip_op[i] = false;
+        if( unchanged != nullptr )
+        {   for(i = 0; i < num; i++)
+                cskip_op[i] = unchanged[i];
+        }
     }
 
     // information used by atomic function operators
@@ -143,7 +168,12 @@ void forward_0(
 
         // check if we are skipping this operation
         while( cskip_op[itr.op_index()] )
-        {   switch(op)
+        {   // jump over a block of skipped operators
+            if( cskip.forward(itr) )
+            {   itr.op_info(op, arg, i_var);
+                continue;
+            }
+            switch(op)
             {
                 case AFunOp:
                 {   // get information for this atomic function call
@@ -279,15 +309,20 @@ void forward_0(
             // -------------------------------------------------
 
             case CSkipOp:
+            cskip.setup(play);
             var_op::cskip_forward_0(
-                i_var, arg, num_par, parameter, cap_order, taylor, cskip_op
+                itr.op_index(), i_var, arg, num_par, parameter,
+                cap_order, taylor, cskip_op, cskip
             );
             itr.correct_before_increment();
             break;
             // -------------------------------------------------
 
             case CSumOp:
-            var_op::csum_forward_any(
+            if( double_sum ) var_op::csum_forward_sum(
+                i_var, arg, num_par, parameter, cap_order, taylor
+            );
+            else var_op::csum_forward_any(
                 0, 0, i_var, arg, num_par, parameter, cap_order, taylor
             );
             itr.correct_before_increment();
@@ -357,8 +392,8 @@ void forward_0(
                 parameter,
                 cap_order,
                 taylor,
-                vec_ad2isvar,
-                vec_ad2index,
+                vecad.isvar(),
+                vecad.index(),
                 load_op2var
             );
             break;
@@ -460,8 +495,7 @@ void forward_0(
                 parameter,
                 cap_order,
                 taylor,
-                vec_ad2isvar,
-                vec_ad2index
+                vecad
             );
             break;
             // -------------------------------------------------
@@ -498,12 +532,13 @@ void forward_0(
             // -------------------------------------------------
 
             case AFunOp:
-            // start of an atomic function call
-            var_op::atomic_forward_any<Base, RecBase>(
+            // start of an atomic function call (or a batch of calls)
+            var_op::atomic_forward_batch<Base, RecBase>(
                 itr,
                 play,
                 parameter,
                 atom_trace,
+                cskip_op,
                 atom_work,
                 cap_order,
                 order_low,
@@ -567,7 +602,16 @@ void forward_0(
 # else
     }
 # endif
-
+    // operators with unchanged results do not need to be skipped
+    // by other sweeps (so blocks of skipped operators may be broken)
+    if( unchanged != nullptr )
+    {   cskip.clear_jump();
+        size_t num = play->num_var_op();
+        for(size_t i = 0; i < num; i++)
+        {   if( unchanged[i] )
+                cskip_op[i] = false;
+        }
+    }
     return;
 }
 
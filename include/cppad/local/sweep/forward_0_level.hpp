@@ -0,0 +1,419 @@
+# ifndef CPPAD_LOCAL_SWEEP_FORWARD_0_LEVEL_HPP
+# define CPPAD_LOCAL_SWEEP_FORWARD_0_LEVEL_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+# include <cppad/local/play/level_schedule.hpp>
+# include <cppad/local/var_op/compare_op.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*
+------------------------------------------------------------------------------
+{xrst_begin sweep_forward_0_level dev}
+{xrst_spell
+    cskip
+}
+
+Zero Order Forward Mode Using a Level Schedule and Parallel Tasks
+#################################################################
+
+Syntax
+******
+| *ok* = ``forward_0_level`` ( *play* , *parallel_for* , *cap_order* ,
+| |tab| *cskip_op* , *change_count* , *change_number* , *change_op_index* ,
+| |tab| *taylor* , *unchanged* , *double_sum* )
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_FORWARD_0_LEVEL
+    // END_FORWARD_0_LEVEL
+}
+
+Purpose
+*******
+This computes the same values as :ref:`sweep_forward_0-name`
+with *print* false.
+The operators are evaluated one level at a time where the
+operators in a level do not depend on each other;
+see ``include/cppad/local/play/level_schedule.hpp`` .
+The operators in a level are divided into tasks,
+each task is a contiguous block of operators
+(so that its results are close together in *taylor* ),
+and the tasks are executed using *parallel_for* .
+Levels that do not have enough operators for two tasks
+are evaluated by the calling thread.
+The comparison operators are evaluated,
+in order, after all the other operators.
+Each operator is evaluated the same way as in the sequential sweep,
+so the results are the same.
+
+Base
+****
+Operations using this type must be thread safe.
+
+parallel_for
+************
+This is the user routine that executes the tasks; see
+:ref:`fun_parallel_for@parallel` .
+If it is null, or if this routine is called in
+:ref:`parallel<ta_in_parallel-name>` mode, *ok* is false.
+
+cskip_op
+********
+This has size *play* ``->num_var_op()`` and all of its elements
+are set to false (the recording does not have any conditional skips).
+
+unchanged
+*********
+If *unchanged* is null, all the operators are evaluated.
+Otherwise, the operators for which *unchanged* [ *i_op* ] is true
+are not evaluated; see :ref:`sweep_forward_0@unchanged` .
+
+Other Arguments
+***************
+The other arguments are the same as for :ref:`sweep_forward_0-name` .
+
+ok
+**
+If *ok* is false, nothing has been calculated and the sequential
+sweep must be used.
+This happens when *play* cannot be evaluated by levels,
+or it is too narrow to benefit from parallel evaluation.
+
+{xrst_end sweep_forward_0_level}
+*/
+/// information for evaluating the tasks in one level
+template <class Base>
+struct forward_0_level_info {
+    /// first operator in this level
+    const play::struct_level_op* level_op;
+    /// number of operators in this level
+    size_t                       n_op;
+    /// number of tasks for this level
+    size_t                       n_task;
+    /// beginning of the argument vector for the recording
+    const addr_t*                arg_vec;
+    /// number of parameters
+    size_t                       num_par;
+    /// beginning of the parameter vector
+    const Base*                  parameter;
+    /// capacity for orders in the Taylor coefficient vector
+    size_t                       cap_order;
+    /// Taylor coefficient vector
+    Base*                        taylor;
+    /// operators that do not need to be evaluated (null for none)
+    const bool*                  unchanged;
+    /// evaluate cumulative summations using csum_forward_sum
+    bool                         double_sum;
+};
+
+/// evaluate one operator that has results; i.e., not a comparison
+template <class Base>
+inline void forward_0_level_op(
+    const play::struct_level_op& level_op   ,
+    const addr_t*                 arg_vec    ,
+    size_t                        num_par    ,
+    const Base*                   parameter  ,
+    size_t                        cap_order  ,
+    Base*                         taylor     ,
+    bool                          double_sum )
+{   op_code_var   op    = level_op.op;
+    size_t        i_var = size_t( level_op.i_var );
+    const addr_t* arg   = arg_vec + level_op.i_arg;
+    switch( op )
+    {
+        case AbsOp:
+        var_op::abs_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case AddvvOp:
+        var_op::addvv_forward_0(i_var, arg, parameter, cap_order, taylor);
+        break;
+
+        case AddpvOp:
+        var_op::addpv_forward_0(i_var, arg, parameter, cap_order, taylor);
+        break;
+
+        case AcosOp:
+        var_op::acos_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case AcoshOp:
+        var_op::acosh_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case AsinOp:
+        var_op::asin_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case AsinhOp:
+        var_op::asinh_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case AtanOp:
+        var_op::atan_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case AtanhOp:
+        var_op::atanh_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case CExpOp:
+        var_op::cexp_forward_0(
+            i_var, arg, num_par, parameter, cap_order, taylor
+        );
+        break;
+
+        case CosOp:
+        var_op::cos_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case CoshOp:
+        var_op::cosh_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case CSumOp:
+        if( double_sum ) var_op::csum_forward_sum(
+            i_var, arg, num_par, parameter, cap_order, taylor
+        );
+        else var_op::csum_forward_any(
+            0, 0, i_var, arg, num_par, parameter, cap_order, taylor
+        );
+        break;
+
+        case DivvvOp:
+        var_op::divvv_forward_0(i_var, arg, parameter, cap_order, taylor);
+        break;
+
+        case DivpvOp:
+        var_op::divpv_forward_0(i_var, arg, parameter, cap_order, taylor);
+        break;
+
+        case DivvpOp:
+        var_op::divvp_forward_0(i_var, arg, parameter, cap_order, taylor);
+        break;
+
+        case ErfOp:
+        case ErfcOp:
+        var_op::erf_forward_0(op, i_var, arg, parameter, cap_order, taylor);
+        break;
+
+        case ExpOp:
+        var_op::exp_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case Expm1Op:
+        var_op::expm1_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case LogOp:
+        var_op::log_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case Log1pOp:
+        var_op::log1p_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case MulpvOp:
+        var_op::mulpv_forward_0(i_var, arg, parameter, cap_order, taylor);
+        break;
+
+        case MulvvOp:
+        var_op::mulvv_forward_0(i_var, arg, parameter, cap_order, taylor);
+        break;
+
+        case NegOp:
+        var_op::neg_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case ParOp:
+        var_op::par_forward_0(
+            i_var, arg, num_par, parameter, cap_order, taylor
+        );
+        break;
+
+        case PowvpOp:
+        var_op::powvp_forward_0(i_var, arg, parameter, cap_order, taylor);
+        break;
+
+        case PowpvOp:
+        var_op::powpv_forward_0(i_var, arg, parameter, cap_order, taylor);
+        break;
+
+        case PowvvOp:
+        var_op::powvv_forward_0(i_var, arg, parameter, cap_order, taylor);
+        break;
+
+        case SignOp:
+        var_op::sign_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case SinOp:
+        var_op::sin_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case SinhOp:
+        var_op::sinh_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case SqrtOp:
+        var_op::sqrt_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case SubvvOp:
+        var_op::subvv_forward_0(i_var, arg, parameter, cap_order, taylor);
+        break;
+
+        case SubpvOp:
+        var_op::subpv_forward_0(i_var, arg, parameter, cap_order, taylor);
+        break;
+
+        case SubvpOp:
+        var_op::subvp_forward_0(i_var, arg, parameter, cap_order, taylor);
+        break;
+
+        case TanOp:
+        var_op::tan_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case TanhOp:
+        var_op::tanh_forward_0(i_var, arg, cap_order, taylor);
+        break;
+
+        case ZmulpvOp:
+        var_op::zmulpv_forward_0(i_var, arg, parameter, cap_order, taylor);
+        break;
+
+        case ZmulvpOp:
+        var_op::zmulvp_forward_0(i_var, arg, parameter, cap_order, taylor);
+        break;
+
+        case ZmulvvOp:
+        var_op::zmulvv_forward_0(i_var, arg, parameter, cap_order, taylor);
+        break;
+
+        default:
+        CPPAD_ASSERT_UNKNOWN(false);
+    }
+}
+
+/// evaluate operators k_begin, ..., k_end - 1 in a level
+template <class Base>
+inline void forward_0_level_range(
+    const forward_0_level_info<Base>& info    ,
+    size_t                            k_begin ,
+    size_t                            k_end   )
+{   const play::struct_level_op* level_op = info.level_op;
+    for(size_t k = k_begin; k < k_end; ++k)
+    {   if( info.unchanged == nullptr || ! info.unchanged[ level_op[k].i_op ] )
+        {   forward_0_level_op(level_op[k],
+                info.arg_vec, info.num_par, info.parameter,
+                info.cap_order, info.taylor, info.double_sum
+            );
+        }
+    }
+}
+
+/// evaluate one task in a level (called by the user's parallel_for)
+template <class Base>
+void forward_0_level_task(size_t i_task, void* void_info)
+{   const forward_0_level_info<Base>& info =
+        *reinterpret_cast< forward_0_level_info<Base>* >(void_info);
+    CPPAD_ASSERT_UNKNOWN( i_task < info.n_task );
+    size_t k_begin = (i_task * info.n_op) / info.n_task;
+    size_t k_end   = ( (i_task + 1) * info.n_op ) / info.n_task;
+    forward_0_level_range(info, k_begin, k_end);
+}
+
+// BEGIN_FORWARD_0_LEVEL
+template <class Base>
+bool forward_0_level(
+    const local::player<Base>* play,
+    play::parallel_for_type    parallel_for,
+    size_t                     cap_order,
+    bool*                      cskip_op,
+    size_t                     change_count,
+    size_t&                    change_number,
+    size_t&                    change_op_index,
+    Base*                      taylor,
+    const bool*                unchanged,
+    bool                       double_sum
+)
+// END_FORWARD_0_LEVEL
+{   CPPAD_ASSERT_UNKNOWN( cap_order >= 1 );
+    if( parallel_for == nullptr || thread_alloc::in_parallel() )
+        return false;
+    //
+    // schedule
+    play::level_schedule& schedule = play->level_schedule();
+    schedule.setup(play);
+    if( ! schedule.ok() )
+        return false;
+    //
+    // cskip_op
+    size_t num_op = play->num_var_op();
+    for(size_t i_op = 0; i_op < num_op; ++i_op)
+        cskip_op[i_op] = false;
+    //
+    // arg_vec
+    // the arguments for the BeginOp are at the beginning of the arguments
+    play::const_sequential_iterator itr = play->begin();
+    op_code_var   op;
+    const addr_t* arg_vec;
+    size_t        i_var;
+    itr.op_info(op, arg_vec, i_var);
+    CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+    //
+    // info
+    forward_0_level_info<Base> info;
+    info.arg_vec    = arg_vec;
+    info.num_par    = play->num_par_all();
+    info.parameter  = play->par_ptr();
+    info.cap_order  = cap_order;
+    info.taylor     = taylor;
+    info.unchanged  = unchanged;
+    info.double_sum = double_sum;
+    //
+    // evaluate the operators with results one level at a time
+    size_t min_task_size = play::level_schedule::min_task_size();
+    size_t n_level       = schedule.n_level();
+    for(size_t ell = 0; ell < n_level; ++ell)
+    {   size_t k_begin = schedule.level_begin(ell);
+        size_t k_end   = schedule.level_begin(ell + 1);
+        info.level_op  = schedule.level_op() + k_begin;
+        info.n_op      = k_end - k_begin;
+        info.n_task    = info.n_op / min_task_size;
+        if( info.n_task < 2 )
+            forward_0_level_range(info, 0, info.n_op);
+        else
+        {   parallel_for(
+                info.n_task,
+                forward_0_level_task<Base>,
+                reinterpret_cast<void*>(&info)
+            );
+        }
+    }
+    //
+    // comparison operators (in order so that change_op_index is the same
+    // as for the sequential sweep)
+    change_number   = 0;
+    change_op_index = 0;
+    const pod_vector<play::struct_level_op>& compare_op = schedule.compare_op();
+    for(size_t k = 0; k < compare_op.size(); ++k)
+    {   const addr_t* arg = info.arg_vec + compare_op[k].i_arg;
+        var_op::compare_forward_any(compare_op[k].op,
+            arg, info.parameter, cap_order, taylor,
+            size_t( compare_op[k].i_op ),
+            change_count, change_number, change_op_index
+        );
+    }
+    return true;
+}
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_SWEEP_FORWARD_ANY_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cppad/local/play/atom_op_info.hpp>
@@ -80,23 +80,24 @@ void forward_any(
     }
 
     // If this includes a zero calculation, initialize this information
-    pod_vector<bool>   vec_ad2isvar;
-    pod_vector<size_t> vec_ad2index;
+    // (the VecAD state is kept by play between zero order sweeps)
+    local::play::vecad_state& vecad = play->vecad_state();
+    //
+    // blocks of operators that are jumped over when they are skipped
+    local::play::cskip_jump& cskip = play->cskip_jump();
     if( order_low == 0 )
     {   size_t i;
 
         // this includes order zero calculation, initialize vector indices
-        size_t num = play->num_var_vec_ind();
-        if( num > 0 )
-        {   vec_ad2isvar.extend(num);
-            vec_ad2index.extend(num);
-            for(i = 0; i < num; i++)
-            {   vec_ad2index[i] = play->GetVecInd(i);
-                vec_ad2isvar[i] = false;
-            }
-        }
+        // (only the elements changed by the previous sweep are restored)
+        vecad.reset(play);
+
+        // no operators are skipped yet, so no blocks of operators are
+        // jumped over
+        cskip.clear_jump();
+
         // includes zero order, so initialize conditional skip flags
-        num = play->num_var_op();
+        size_t num = play->num_var_op();
         for(i = 0; i < num; i++)
             cskip_op[i] = false;
     }
@@ -154,7 +155,12 @@ void forward_any(
 
         // check if we are skipping this operation
         while( cskip_op[itr.op_index()] )
-        {   switch(op)
+        {   // jump over a block of skipped operators
+            if( cskip.forward(itr) )
+            {   itr.op_info(op, arg, i_var);
+                continue;
+            }
+            switch(op)
             {
                 case AFunOp:
                 {   // get information for this atomic function call
@@ -310,8 +316,10 @@ void forward_any(
 
             case CSkipOp:
             if( order_low == 0 )
-            {   var_op::cskip_forward_0(
-                    i_var, arg, num_par, parameter, cap_order, taylor, cskip_op
+            {   cskip.setup(play);
+                var_op::cskip_forward_0(
+                    itr.op_index(), i_var, arg, num_par, parameter,
+                    cap_order, taylor, cskip_op, cskip
                 );
             }
             itr.correct_before_increment();
@@ -402,8 +410,8 @@ void forward_any(
                     parameter,
                     cap_order,
                     taylor,
-                    vec_ad2isvar,
-                    vec_ad2index,
+                    vecad.isvar(),
+                    vecad.index(),
                     load_op2var
                 );
                 if(order_low < order_up ) var_op::load_forward_nonzero(
@@ -553,8 +561,7 @@ void forward_any(
                     parameter,
                     cap_order,
                     taylor,
-                    vec_ad2isvar,
-                    vec_ad2index
+                    vecad
                 );
             }
             break;
@@ -602,12 +609,13 @@ void forward_any(
             // -------------------------------------------------
 
             case AFunOp:
-            // start of an atomic function call
-            var_op::atomic_forward_any<Base, RecBase>(
+            // start of an atomic function call (or a batch of calls)
+            var_op::atomic_forward_batch<Base, RecBase>(
                 itr,
                 play,
                 parameter,
                 atom_trace,
+                cskip_op,
                 atom_work,
                 cap_order,
                 order_low,
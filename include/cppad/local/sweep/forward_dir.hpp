@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_SWEEP_FORWARD_DIR_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cppad/local/play/atom_op_info.hpp>
@@ -80,6 +80,9 @@ void forward_dir(
     // temporary indices
     size_t i;
 
+    // blocks of operators that are jumped over when they are skipped
+    const play::cskip_jump& cskip = play->cskip_jump();
+
     // skip the BeginOp at the beginning of the recording
     play::const_sequential_iterator itr = play->begin();
     // op_info
@@ -104,7 +107,12 @@ void forward_dir(
 
         // check if we are skipping this operation
         while( cskip_op[itr.op_index()] )
-        {   switch(op)
+        {   // jump over a block of skipped operators
+            if( cskip.forward(itr) )
+            {   itr.op_info(op, arg, i_var);
+                continue;
+            }
+            switch(op)
             {
                 case AFunOp:
                 {   // get information for this atomic function call
@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_SWEEP_REVERSE_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 
@@ -193,6 +193,9 @@ void reverse(
     // routines do not need to re-allocate it
     vector<Base> work;
 
+    // blocks of operators that are jumped over when they are skipped
+    const play::cskip_jump& cskip = play->cskip_jump();
+
     // Initialize
 # if CPPAD_REVERSE_TRACE
     std::cout << std::endl;
@@ -213,7 +216,10 @@ void reverse(
         // check if we are skipping this operation
         size_t i_op = play_itr.op_index();
         while( cskip_op[i_op] )
-        {   switch(op)
+        {   // jump to the first operator in a block of skipped operators
+            if( cskip.reverse(play_itr) )
+                play_itr.op_info(op, arg, i_var);
+            switch(op)
             {
                 case CSumOp:
                 case CSkipOp:
@@ -636,11 +642,13 @@ void reverse(
             // --------------------------------------------------
 
             case AFunOp:
-            var_op::atomic_reverse<Base, RecBase, Iterator>(
+            // end of an atomic function call (or a batch of calls)
+            var_op::atomic_reverse_batch<Base, RecBase, Iterator>(
                 play_itr,
                 play,
                 parameter,
                 atom_trace,
+                cskip_op,
                 atom_work,
                 cap_order,
                 K,
@@ -0,0 +1,595 @@
+# ifndef CPPAD_LOCAL_SWEEP_REVERSE_1_LEVEL_HPP
+# define CPPAD_LOCAL_SWEEP_REVERSE_1_LEVEL_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+# include <cppad/local/play/reverse_level_schedule.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*
+------------------------------------------------------------------------------
+{xrst_begin sweep_reverse_1_level dev}
+
+First Order Reverse Mode Using a Level Schedule and Parallel Tasks
+##################################################################
+
+Syntax
+******
+| *ok* = ``reverse_1_level`` ( *play* , *parallel_for* , *accumulate* ,
+| |tab| *cap_order* , *taylor* , *partial* )
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_REVERSE_1_LEVEL
+    // END_REVERSE_1_LEVEL
+}
+
+Purpose
+*******
+This computes the same partials as the sequential reverse sweep
+with one order of partials; i.e., first order reverse mode.
+The operators are evaluated one level at a time; see
+``include/cppad/local/play/reverse_level_schedule.hpp`` .
+The operators in a level are divided into tasks,
+each task is a contiguous block of operators,
+and the tasks are executed using *parallel_for* .
+Levels that do not have enough operators for two tasks
+are evaluated by the calling thread.
+
+Base
+****
+Operations using this type must be thread safe.
+
+parallel_for
+************
+This is the user routine that executes the tasks; see
+:ref:`fun_parallel_for@parallel` .
+If it is null, or if this routine is called in
+:ref:`parallel<ta_in_parallel-name>` mode, *ok* is false.
+
+accumulate
+**********
+A variable that is an argument for many operators has shadow partials
+that are added to its partial by a reduction step; see
+``include/cppad/local/play/reverse_level_schedule.hpp`` .
+If *accumulate* is false, each use of the variable has its own shadow
+and the reduction adds them in the same order as the sequential sweep.
+Hence the results are identical to the sequential sweep.
+If *accumulate* is true, each task that uses the variable
+has its own shadow and the reduction adds them in task order.
+In this case the results may differ by roundoff from the sequential sweep,
+but they do not depend on the order in which the tasks are executed.
+
+cap_order
+*********
+Is the maximum number of orders that can be stored in *taylor* .
+
+taylor
+******
+The zero order Taylor coefficient for the variable with index *i*
+is *taylor* [ *i* * *cap_order* ] .
+
+partial
+*******
+On input, this vector has size *play* ``->num_var()`` and
+*partial* [ *i* ] is the partial of the function being differentiated
+with respect to the variable with index *i* ,
+not counting the dependence through operators in *play* .
+If *ok* is true, upon return *partial* [ *i* ] is the partial
+with respect to the variable with index *i* ,
+including the dependence through all the operators in *play* .
+
+ok
+**
+If *ok* is false, nothing has been calculated and the sequential
+sweep must be used.
+This happens when *play* cannot be evaluated by levels,
+or it is too narrow to benefit from parallel evaluation.
+
+{xrst_end sweep_reverse_1_level}
+*/
+/// information for evaluating the tasks in one level
+template <class Base>
+struct reverse_1_level_info {
+    /// first operator in this level
+    const play::struct_level_op* level_op;
+    /// number of operators in this level
+    size_t                       n_op;
+    /// number of tasks for this level
+    size_t                       n_task;
+    /// beginning of the argument vector (with shadows if there are any)
+    const addr_t*                arg_vec;
+    /// number of parameters
+    size_t                       num_par;
+    /// beginning of the parameter vector
+    const Base*                  parameter;
+    /// capacity for orders in the Taylor coefficient vector
+    size_t                       cap_order;
+    /// Taylor coefficient vector
+    const Base*                  taylor;
+    /// partial derivative vector
+    Base*                        partial;
+    /// work space for each task (only used by PowvpOp)
+    vector< vector<Base> >*      work;
+};
+
+/// evaluate the reverse action for one operator
+template <class Base>
+inline void reverse_1_level_op(
+    const play::struct_level_op& level_op   ,
+    const addr_t*                 arg_vec    ,
+    size_t                        num_par    ,
+    const Base*                   parameter  ,
+    size_t                        cap_order  ,
+    const Base*                   taylor     ,
+    Base*                         partial    ,
+    vector<Base>&                 work       )
+{   op_code_var   op    = level_op.op;
+    size_t        i_var = size_t( level_op.i_var );
+    const addr_t* arg   = arg_vec + level_op.i_arg;
+    switch( op )
+    {
+        case AbsOp:
+        var_op::abs_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case AcosOp:
+        var_op::acos_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case AcoshOp:
+        var_op::acosh_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case AddvvOp:
+        var_op::addvv_reverse(
+            i_var, arg, parameter, cap_order, taylor, 1, partial
+        );
+        break;
+
+        case AddpvOp:
+        var_op::addpv_reverse(
+            i_var, arg, parameter, cap_order, taylor, 1, partial
+        );
+        break;
+
+        case AsinOp:
+        var_op::asin_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case AsinhOp:
+        var_op::asinh_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case AtanOp:
+        var_op::atan_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case AtanhOp:
+        var_op::atanh_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case CExpOp:
+        var_op::cexp_reverse(
+            i_var, arg, num_par, parameter, cap_order, taylor, 1, partial
+        );
+        break;
+
+        case CosOp:
+        var_op::cos_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case CoshOp:
+        var_op::cosh_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case CSumOp:
+        var_op::csum_reverse(i_var, arg, 1, partial);
+        break;
+
+        case DivvvOp:
+        var_op::divvv_reverse(
+            i_var, arg, parameter, cap_order, taylor, 1, partial
+        );
+        break;
+
+        case DivpvOp:
+        var_op::divpv_reverse(
+            i_var, arg, parameter, cap_order, taylor, 1, partial
+        );
+        break;
+
+        case DivvpOp:
+        var_op::divvp_reverse(
+            i_var, arg, parameter, cap_order, taylor, 1, partial
+        );
+        break;
+
+        case ErfOp:
+        case ErfcOp:
+        var_op::erf_reverse(
+            op, i_var, arg, parameter, cap_order, taylor, 1, partial
+        );
+        break;
+
+        case ExpOp:
+        var_op::exp_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case Expm1Op:
+        var_op::expm1_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case LogOp:
+        var_op::log_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case Log1pOp:
+        var_op::log1p_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case MulpvOp:
+        var_op::mulpv_reverse(
+            i_var, arg, parameter, cap_order, taylor, 1, partial
+        );
+        break;
+
+        case MulvvOp:
+        var_op::mulvv_reverse(
+            i_var, arg, parameter, cap_order, taylor, 1, partial
+        );
+        break;
+
+        case NegOp:
+        var_op::neg_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case PowvpOp:
+        var_op::powvp_reverse(
+            i_var, arg, parameter, cap_order, taylor, 1, partial, work
+        );
+        break;
+
+        case PowpvOp:
+        var_op::powpv_reverse(
+            i_var, arg, parameter, cap_order, taylor, 1, partial
+        );
+        break;
+
+        case PowvvOp:
+        var_op::powvv_reverse(
+            i_var, arg, parameter, cap_order, taylor, 1, partial
+        );
+        break;
+
+        case SignOp:
+        var_op::sign_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case SinOp:
+        var_op::sin_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case SinhOp:
+        var_op::sinh_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case SqrtOp:
+        var_op::sqrt_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case SubvvOp:
+        var_op::subvv_reverse(
+            i_var, arg, parameter, cap_order, taylor, 1, partial
+        );
+        break;
+
+        case SubpvOp:
+        var_op::subpv_reverse(
+            i_var, arg, parameter, cap_order, taylor, 1, partial
+        );
+        break;
+
+        case SubvpOp:
+        var_op::subvp_reverse(
+            i_var, arg, parameter, cap_order, taylor, 1, partial
+        );
+        break;
+
+        case TanOp:
+        var_op::tan_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case TanhOp:
+        var_op::tanh_reverse(i_var, arg, cap_order, taylor, 1, partial);
+        break;
+
+        case ZmulpvOp:
+        var_op::zmulpv_reverse(
+            i_var, arg, parameter, cap_order, taylor, 1, partial
+        );
+        break;
+
+        case ZmulvpOp:
+        var_op::zmulvp_reverse(
+            i_var, arg, parameter, cap_order, taylor, 1, partial
+        );
+        break;
+
+        case ZmulvvOp:
+        var_op::zmulvv_reverse(
+            i_var, arg, parameter, cap_order, taylor, 1, partial
+        );
+        break;
+
+        default:
+        CPPAD_ASSERT_UNKNOWN(false);
+    }
+}
+
+/// evaluate operators k_begin, ..., k_end - 1 in a level
+template <class Base>
+inline void reverse_1_level_range(
+    const reverse_1_level_info<Base>& info    ,
+    size_t                            k_begin ,
+    size_t                            k_end   ,
+    vector<Base>&                     work    )
+{   const play::struct_level_op* level_op = info.level_op;
+    for(size_t k = k_begin; k < k_end; ++k)
+    {   reverse_1_level_op(level_op[k],
+            info.arg_vec, info.num_par, info.parameter,
+            info.cap_order, info.taylor, info.partial, work
+        );
+    }
+}
+
+/// evaluate one task in a level (called by the user's parallel_for)
+template <class Base>
+void reverse_1_level_task(size_t i_task, void* void_info)
+{   const reverse_1_level_info<Base>& info =
+        *reinterpret_cast< reverse_1_level_info<Base>* >(void_info);
+    CPPAD_ASSERT_UNKNOWN( i_task < info.n_task );
+    size_t k_begin = (i_task * info.n_op) / info.n_task;
+    size_t k_end   = ( (i_task + 1) * info.n_op ) / info.n_task;
+    reverse_1_level_range(info, k_begin, k_end, (*info.work)[i_task] );
+}
+
+/// information for copying one element for each variable
+template <class Base>
+struct reverse_1_level_copy {
+    /// number of variables
+    size_t      num_var;
+    /// number of tasks
+    size_t      n_task;
+    /// element for variable i is src[i * stride]
+    const Base* src;
+    /// stride for the source
+    size_t      stride;
+    /// element for variable i is dst[i]
+    Base*       dst;
+};
+
+/// copy the elements for one block of variables
+template <class Base>
+void reverse_1_level_copy_task(size_t i_task, void* void_info)
+{   const reverse_1_level_copy<Base>& info =
+        *reinterpret_cast< reverse_1_level_copy<Base>* >(void_info);
+    CPPAD_ASSERT_UNKNOWN( i_task < info.n_task );
+    size_t i_begin = (i_task * info.num_var) / info.n_task;
+    size_t i_end   = ( (i_task + 1) * info.num_var ) / info.n_task;
+    for(size_t i = i_begin; i < i_end; ++i)
+        info.dst[i] = info.src[i * info.stride];
+}
+
+/// copy one element for each variable using parallel tasks
+template <class Base>
+void reverse_1_level_copy_all(
+    play::parallel_for_type parallel_for ,
+    size_t                  num_var      ,
+    const Base*             src          ,
+    size_t                  stride       ,
+    Base*                   dst          )
+{   reverse_1_level_copy<Base> copy;
+    copy.num_var = num_var;
+    copy.n_task  = num_var / (64 * play::level_schedule::min_task_size());
+    copy.src     = src;
+    copy.stride  = stride;
+    copy.dst     = dst;
+    if( copy.n_task < 2 )
+    {   copy.n_task = 1;
+        reverse_1_level_copy_task<Base>(0, &copy);
+    }
+    else
+    {   parallel_for(
+            copy.n_task,
+            reverse_1_level_copy_task<Base>,
+            reinterpret_cast<void*>(&copy)
+        );
+    }
+}
+
+/// information for the reductions in one level
+template <class Base>
+struct reverse_1_level_reduce {
+    /// number of shadows (index of the first variable in partial)
+    size_t        n_shadow;
+    /// variable for each reduction in this level
+    const addr_t* red_var;
+    /// first shadow for each reduction in this level (one extra element)
+    const size_t* red_begin;
+    /// number of reductions in this level
+    size_t        n_red;
+    /// number of tasks
+    size_t        n_task;
+    /// partial derivatives for the shadows followed by the variables
+    Base*         partial;
+};
+
+/// evaluate the reductions for one task
+template <class Base>
+void reverse_1_level_reduce_task(size_t i_task, void* void_info)
+{   const reverse_1_level_reduce<Base>& info =
+        *reinterpret_cast< reverse_1_level_reduce<Base>* >(void_info);
+    CPPAD_ASSERT_UNKNOWN( i_task < info.n_task );
+    size_t e_begin = (i_task * info.n_red) / info.n_task;
+    size_t e_end   = ( (i_task + 1) * info.n_red ) / info.n_task;
+    for(size_t e = e_begin; e < e_end; ++e)
+    {   Base& sum = info.partial[ info.n_shadow + size_t(info.red_var[e]) ];
+        for(size_t s = info.red_begin[e]; s < info.red_begin[e+1]; ++s)
+            sum += info.partial[s];
+    }
+}
+
+// BEGIN_REVERSE_1_LEVEL
+template <class Base>
+bool reverse_1_level(
+    const local::player<Base>* play,
+    play::parallel_for_type    parallel_for,
+    bool                       accumulate,
+    size_t                     cap_order,
+    const Base*                taylor,
+    Base*                      partial
+)
+// END_REVERSE_1_LEVEL
+{   CPPAD_ASSERT_UNKNOWN( cap_order >= 1 );
+    if( parallel_for == nullptr || thread_alloc::in_parallel() )
+        return false;
+    //
+    // schedule
+    play::reverse_level_schedule& schedule = play->reverse_level_schedule();
+    schedule.setup(play, accumulate);
+    if( ! schedule.ok() )
+        return false;
+    //
+    // min_task_size, n_level, num_var, n_shadow
+    size_t min_task_size = play::level_schedule::min_task_size();
+    size_t n_level       = schedule.n_level();
+    size_t num_var       = play->num_var();
+    size_t n_shadow      = schedule.n_shadow();
+    //
+    // info
+    reverse_1_level_info<Base> info;
+    info.num_par   = play->num_par_all();
+    info.parameter = play->par_ptr();
+    info.cap_order = cap_order;
+    info.taylor    = taylor;
+    info.partial   = partial;
+    //
+    // reduce
+    reverse_1_level_reduce<Base> reduce;
+    reduce.n_shadow = n_shadow;
+    //
+    // taylor_0, partial_s
+    // zero order coefficients and partials for the shadows followed by
+    // the variables
+    pod_vector_maybe<Base> taylor_0, partial_s;
+    if( n_shadow == 0 )
+    {   // the arguments for the BeginOp are at the beginning of the arguments
+        play::const_sequential_iterator itr = play->begin();
+        op_code_var   op;
+        size_t        i_var;
+        itr.op_info(op, info.arg_vec, i_var);
+        CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+    }
+    else
+    {   info.arg_vec = schedule.rev_arg();
+        //
+        // taylor_0
+        taylor_0.resize(n_shadow + num_var);
+        reverse_1_level_copy_all(
+            parallel_for, num_var, taylor, cap_order, taylor_0.data() + n_shadow
+        );
+        const addr_t* red_var   = schedule.red_var();
+        const size_t* red_begin = schedule.red_begin();
+        size_t        n_red     = schedule.red_level(n_level);
+        for(size_t e = 0; e < n_red; ++e)
+        {   Base value = taylor_0[ n_shadow + size_t( red_var[e] ) ];
+            for(size_t s = red_begin[e]; s < red_begin[e+1]; ++s)
+                taylor_0[s] = value;
+        }
+        info.cap_order = 1;
+        info.taylor    = taylor_0.data();
+        //
+        // partial_s
+        // The shadows start at minus zero because -0 + x is equal to x
+        // for all x. Hence, in deterministic mode, each shadow is equal to
+        // the value that the sequential sweep adds to the partial.
+        partial_s.resize(n_shadow + num_var);
+        for(size_t s = 0; s < n_shadow; ++s)
+            partial_s[s] = - Base(0.0);
+        reverse_1_level_copy_all(
+            parallel_for, num_var, partial, 1, partial_s.data() + n_shadow
+        );
+        info.partial   = partial_s.data();
+        reduce.partial = partial_s.data();
+    }
+    //
+    // work
+    // allocated here because tasks can not allocate memory
+    size_t max_task = 1;
+    for(size_t ell = 0; ell < n_level; ++ell)
+    {   size_t n_op = schedule.level_begin(ell+1) - schedule.level_begin(ell);
+        max_task    = std::max(max_task, n_op / min_task_size);
+    }
+    vector< vector<Base> > work(max_task);
+    for(size_t i_task = 0; i_task < max_task; ++i_task)
+        work[i_task].resize(1);
+    info.work = &work;
+    //
+    // evaluate the operators one level at a time
+    for(size_t ell = 0; ell < n_level; ++ell)
+    {   size_t k_begin = schedule.level_begin(ell);
+        size_t k_end   = schedule.level_begin(ell + 1);
+        info.level_op  = schedule.level_op() + k_begin;
+        info.n_op      = k_end - k_begin;
+        info.n_task    = info.n_op / min_task_size;
+        if( info.n_task < 2 )
+            reverse_1_level_range(info, 0, info.n_op, work[0]);
+        else
+        {   parallel_for(
+                info.n_task,
+                reverse_1_level_task<Base>,
+                reinterpret_cast<void*>(&info)
+            );
+        }
+        //
+        // add the shadows to the corresponding partials
+        if( n_shadow > 0 )
+        {   size_t e_begin   = schedule.red_level(ell);
+            size_t e_end     = schedule.red_level(ell + 1);
+            reduce.red_var   = schedule.red_var() + e_begin;
+            reduce.red_begin = schedule.red_begin() + e_begin;
+            reduce.n_red     = e_end - e_begin;
+            size_t n_add     =
+                reduce.red_begin[reduce.n_red] - reduce.red_begin[0];
+            reduce.n_task    = std::min(reduce.n_red, n_add / min_task_size);
+            if( reduce.n_task < 2 )
+            {   reduce.n_task = 1;
+                reverse_1_level_reduce_task<Base>(0, &reduce);
+            }
+            else
+            {   parallel_for(
+                    reduce.n_task,
+                    reverse_1_level_reduce_task<Base>,
+                    reinterpret_cast<void*>(&reduce)
+                );
+            }
+        }
+    }
+    //
+    // partial
+    if( n_shadow > 0 )
+    {   reverse_1_level_copy_all(
+            parallel_for, num_var, partial_s.data() + n_shadow, 1, partial
+        );
+    }
+    return true;
+}
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
@@ -0,0 +1,188 @@
+# ifndef CPPAD_LOCAL_SWEEP_UNCHANGED_OP_HPP
+# define CPPAD_LOCAL_SWEEP_UNCHANGED_OP_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*
+------------------------------------------------------------------------------
+{xrst_begin sweep_unchanged_op dev}
+{xrst_spell
+    cskip
+}
+
+Determine Operators With Unchanged Zero Order Results
+#####################################################
+
+Syntax
+******
+| *ok* = ``unchanged_op`` ( *play* , *par_changed* , *var_changed* ,
+| |tab| *unchanged* )
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_UNCHANGED_OP
+    // END_UNCHANGED_OP
+}
+
+Purpose
+*******
+Suppose that the zero order Taylor coefficients for all the variables
+have been computed, and then some of the parameter values
+and independent variable values have changed.
+This routine determines which of the variable operators
+have results that do not change.
+The zero order forward sweep can skip these operators.
+
+play
+****
+is the player for this operation sequence.
+
+par_changed
+***********
+has size *play* ``->num_par_all()`` and
+*par_changed* [ *i* ] is true if the *i*-th parameter may have changed.
+
+var_changed
+***********
+has size *play* ``->num_var()`` .
+On input, it is true for the independent variables that may have changed
+and false for all the other variables.
+Upon return, *var_changed* [ *i* ] is true if the *i*-th variable
+may have changed.
+
+unchanged
+*********
+The input size of this vector does not matter.
+Upon return it has size *play* ``->num_var_op()`` and
+*unchanged* [ *i_op* ] is true if the results for the operator
+with index *i_op* do not change.
+The following operators are never marked as unchanged:
+comparisons (so that they are counted),
+print operators (so that they print),
+and atomic function calls (which may have state that is not
+in their arguments; their results are marked as changed).
+
+ok
+**
+If the return value *ok* is false, *unchanged* and *var_changed*
+are not specified and the zero order sweep must evaluate all the operators.
+This happens if the operation sequence has VecAD or
+conditional skip operators.
+
+{xrst_end sweep_unchanged_op}
+*/
+// BEGIN_UNCHANGED_OP
+template <class Base>
+bool unchanged_op(
+    const player<Base>*     play        ,
+    const pod_vector<bool>& par_changed ,
+    pod_vector<bool>&       var_changed ,
+    pod_vector<bool>&       unchanged   )
+// END_UNCHANGED_OP
+{   CPPAD_ASSERT_UNKNOWN( par_changed.size() == play->num_par_all() );
+    CPPAD_ASSERT_UNKNOWN( var_changed.size() == play->num_var() );
+    //
+    // num_par
+    size_t num_par = play->num_par_all();
+    //
+    // unchanged
+    unchanged.resize( play->num_var_op() );
+    //
+    // is_variable
+    pod_vector<bool> is_variable;
+    //
+    // itr, op, arg, i_var
+    play::const_sequential_iterator itr = play->begin();
+    op_code_var   op;
+    const addr_t* arg;
+    size_t        i_var;
+    itr.op_info(op, arg, i_var);
+    CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+    unchanged[ itr.op_index() ] = false;
+    //
+    bool more_operators = true;
+    while( more_operators )
+    {   (++itr).op_info(op, arg, i_var);
+        size_t i_op = itr.op_index();
+        //
+        // changed
+        bool changed;
+        switch(op)
+        {   //
+            // cases where the sweep must evaluate all the operators
+            case CSkipOp:
+            case LdpOp:
+            case LdvOp:
+            case StppOp:
+            case StpvOp:
+            case StvpOp:
+            case StvvOp:
+            return false;
+            //
+            // cases that are always evaluated and have no results
+            case EndOp:
+            case EqppOp:
+            case EqpvOp:
+            case EqvvOp:
+            case LeppOp:
+            case LepvOp:
+            case LevpOp:
+            case LevvOp:
+            case LtppOp:
+            case LtpvOp:
+            case LtvpOp:
+            case LtvvOp:
+            case NeppOp:
+            case NepvOp:
+            case NevvOp:
+            case PriOp:
+            case InvOp:
+            changed = false;
+            unchanged[i_op] = false;
+            break;
+            //
+            // atomic function calls are always evaluated
+            case AFunOp:
+            case FunapOp:
+            case FunavOp:
+            case FunrpOp:
+            case FunrvOp:
+            changed = op == FunrvOp;
+            unchanged[i_op] = false;
+            break;
+            //
+            // other operators: treat the arguments that are not variables
+            // as parameter indices (this may mark extra operators as changed)
+            default:
+            arg_is_variable(op, arg, is_variable);
+            changed = false;
+            for(size_t j = 0; j < is_variable.size(); ++j)
+            {   size_t index = size_t( arg[j] );
+                if( is_variable[j] )
+                    changed |= var_changed[index];
+                else if( index < num_par )
+                    changed |= par_changed[index];
+            }
+            unchanged[i_op] = ! changed;
+            break;
+        }
+        more_operators = op != EndOp;
+        if( changed )
+        {   size_t n_res = NumRes(op);
+            for(size_t k = 0; k < n_res; ++k)
+                var_changed[i_var - k] = true;
+        }
+        if( op == CSumOp )
+            itr.correct_before_increment();
+    }
+    return true;
+}
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
@@ -0,0 +1,222 @@
+# ifndef CPPAD_LOCAL_UTILITY_SPARSE_LU_HPP
+# define CPPAD_LOCAL_UTILITY_SPARSE_LU_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+# include <cstddef>
+# include <cppad/core/cppad_assert.hpp>
+# include <cppad/utility/vector.hpp>
+# include <cppad/utility/sparse_rc.hpp>
+
+// BEGIN_CPPAD_LOCAL_UTILITY_NAMESPACE
+namespace CppAD { namespace local { namespace utility {
+/*!
+\file sparse_lu.hpp
+*/
+/*!
+LU factorization of I + alpha * A where A is a sparse square matrix.
+
+The symbolic analysis, which determines the sparsity pattern of the factors
+(including the fill in), is done once by analyze.
+The numerical factorization, which is done by factor,
+can then be repeated for different values of alpha and A
+(with the same sparsity pattern) without any memory allocation.
+
+No pivoting is done. This is intended for matrices that are
+diagonally dominant; e.g., I - f_x * h / 2 in a Rosenbrock method where
+h is small, or f_x is diagonally dominant with a non-positive diagonal.
+The caller must check the return value of factor.
+
+\tparam Scalar
+is the type of the elements of the matrix.
+*/
+template <class Scalar>
+class sparse_lu {
+private:
+    /// number of rows (and columns) in the matrix
+    size_t                 n_;
+    /// entries in row i of the factors are
+    /// lu_row_begin_[i] , ... , lu_row_begin_[i+1] - 1
+    CppAD::vector<size_t>  lu_row_begin_;
+    /// column index for each entry of the factors (increasing in each row)
+    CppAD::vector<size_t>  lu_col_;
+    /// index in lu_col_ of the diagonal entry for each row
+    CppAD::vector<size_t>  lu_diag_;
+    /// index in lu_col_ corresponding to each entry in the pattern for A
+    CppAD::vector<size_t>  a2lu_;
+    /// values for the factors: L is unit lower triangular and its
+    /// strictly lower part is below the diagonal, U is the rest
+    CppAD::vector<Scalar>  lu_val_;
+    /// work space that maps a column index to an index in lu_col_
+    CppAD::vector<size_t>  position_;
+public:
+    /// default constructor
+    sparse_lu(void) : n_(0)
+    { }
+    /*!
+    Symbolic analysis of the sparsity pattern.
+
+    \param pattern
+    is the sparsity pattern for A. It must be square and each
+    entry must appear at most once.
+    */
+    template <class SizeVector>
+    void analyze(const sparse_rc<SizeVector>& pattern)
+    {   CPPAD_ASSERT_KNOWN( pattern.nr() == pattern.nc(),
+            "sparse_lu: pattern is not square"
+        );
+        size_t n   = pattern.nr();
+        size_t nnz = pattern.nnz();
+        n_         = n;
+        const SizeVector& row = pattern.row();
+        const SizeVector& col = pattern.col();
+        SizeVector row_major  = pattern.row_major();
+        //
+        // next: sorted linked list of the columns in the current row,
+        // next[n] is the first column and n is the end of the list
+        CppAD::vector<size_t> next(n + 1);
+        //
+        lu_row_begin_.resize(n + 1);
+        lu_diag_.resize(n);
+        lu_col_.resize(0);
+        lu_row_begin_[0] = 0;
+        size_t k = 0;
+        for(size_t i = 0; i < n; ++i)
+        {   // columns of A in row i, plus the diagonal
+            next[n]    = n;
+            size_t end = n;
+            bool   diag = false;
+            while( k < nnz && row[ row_major[k] ] == i )
+            {   size_t j = col[ row_major[k] ];
+                diag    |= j == i;
+                next[end] = j;
+                end       = j;
+                ++k;
+            }
+            next[end] = n;
+            if( ! diag )
+            {   // insert i in the list
+                size_t p = n;
+                while( next[p] < i )
+                    p = next[p];
+                next[i] = next[p];
+                next[p] = i;
+            }
+            //
+            // fill in from the rows of U that are before row i
+            for(size_t j = next[n]; j < i; j = next[j])
+            {   size_t p = j;
+                for(size_t q = lu_diag_[j] + 1; q < lu_row_begin_[j+1]; ++q)
+                {   size_t c = lu_col_[q];
+                    while( next[p] < c )
+                        p = next[p];
+                    if( next[p] != c )
+                    {   next[c] = next[p];
+                        next[p] = c;
+                    }
+                    p = c;
+                }
+            }
+            //
+            // entries for row i
+            for(size_t j = next[n]; j < n; j = next[j])
+            {   if( j == i )
+                    lu_diag_[i] = lu_col_.size();
+                lu_col_.push_back(j);
+            }
+            lu_row_begin_[i+1] = lu_col_.size();
+        }
+        CPPAD_ASSERT_UNKNOWN( k == nnz );
+        //
+        // a2lu_
+        a2lu_.resize(nnz);
+        for(k = 0; k < nnz; ++k)
+        {   size_t i = row[k];
+            size_t j = col[k];
+            size_t p = lu_row_begin_[i];
+            while( lu_col_[p] != j )
+                ++p;
+            a2lu_[k] = p;
+        }
+        //
+        lu_val_.resize( lu_col_.size() );
+        position_.resize(n);
+    }
+    /// number of entries in the factors (including the diagonal)
+    size_t nnz(void) const
+    {   return lu_col_.size(); }
+    /*!
+    Numerical factorization of I + alpha * A.
+
+    \param alpha
+    is the multiplier for A.
+
+    \param a_val
+    is the value of the entries of A in the same order as the pattern
+    passed to analyze.
+
+    \return
+    is false if one of the pivots is zero or nan; i.e.,
+    the factorization without pivoting failed.
+    In this case, the factors must not be used by solve.
+    */
+    template <class Vector>
+    bool factor(const Scalar& alpha, const Vector& a_val)
+    {   CPPAD_ASSERT_UNKNOWN( size_t( a_val.size() ) == a2lu_.size() );
+        Scalar zero(0);
+        for(size_t p = 0; p < lu_val_.size(); ++p)
+            lu_val_[p] = zero;
+        for(size_t k = 0; k < a2lu_.size(); ++k)
+            lu_val_[ a2lu_[k] ] += alpha * a_val[k];
+        for(size_t i = 0; i < n_; ++i)
+            lu_val_[ lu_diag_[i] ] += Scalar(1);
+        //
+        bool ok = true;
+        for(size_t i = 0; i < n_; ++i)
+        {   for(size_t p = lu_row_begin_[i]; p < lu_row_begin_[i+1]; ++p)
+                position_[ lu_col_[p] ] = p;
+            //
+            // eliminate the entries in row i that are below the diagonal
+            for(size_t p = lu_row_begin_[i]; p < lu_diag_[i]; ++p)
+            {   size_t j = lu_col_[p];
+                lu_val_[p] /= lu_val_[ lu_diag_[j] ];
+                const Scalar& l_ij = lu_val_[p];
+                for(size_t q = lu_diag_[j] + 1; q < lu_row_begin_[j+1]; ++q)
+                    lu_val_[ position_[ lu_col_[q] ] ] -= l_ij * lu_val_[q];
+            }
+            const Scalar& pivot = lu_val_[ lu_diag_[i] ];
+            ok &= pivot < zero || zero < pivot;
+            if( ! ok )
+                return ok;
+        }
+        return ok;
+    }
+    /*!
+    Solve the equation (I + alpha * A) * x = b.
+
+    \param b [in,out]
+    On input it is the right hand side b. Upon return it is the solution x.
+    */
+    template <class Vector>
+    void solve(Vector& b) const
+    {   CPPAD_ASSERT_UNKNOWN( size_t( b.size() ) == n_ );
+        // L * y = b
+        for(size_t i = 0; i < n_; ++i)
+        {   for(size_t p = lu_row_begin_[i]; p < lu_diag_[i]; ++p)
+                b[i] -= lu_val_[p] * b[ lu_col_[p] ];
+        }
+        // U * x = y
+        for(size_t i = n_; i > 0; --i)
+        {   size_t r = i - 1;
+            for(size_t p = lu_diag_[r] + 1; p < lu_row_begin_[i]; ++p)
+                b[r] -= lu_val_[p] * b[ lu_col_[p] ];
+            b[r] /= lu_val_[ lu_diag_[r] ];
+        }
+    }
+};
+
+} } } // END_CPPAD_LOCAL_UTILITY_NAMESPACE
+
+# endif
@@ -2,7 +2,7 @@
 # define  CPPAD_LOCAL_VAL_GRAPH_VAL2FUN_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // --------------------------------------------------------------------------
 /*
 {xrst_begin val2fun_graph dev}
@@ -989,6 +989,7 @@ void ADFun<Base, RecBase>::val2fun(
     // for_jac_sparse_pack_, for_jac_sparse_set_
     for_jac_sparse_pack_.resize(0, 0);
     for_jac_sparse_set_.resize(0,0);
+    sparsity_cache_.clear();
     //
     // resize subgraph_info_
     subgraph_info_.resize(
@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_VAR_OP_ATOMIC_OP_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 // BEGIN_CPPAD_LOCAL_VAR_OP_NAMESPACE
@@ -38,6 +38,38 @@ struct atomic_op_work {
     CppAD::vector<bool>           variable_x;
     CppAD::vector<bool>           variable_y;
     //
+    // batch_parameter_x, batch_type_x,
+    // batch_call_id, batch_select, batch_index,
+    // batch_taylor_x, batch_taylor_y, batch_partial_x, batch_partial_y
+    // (used by atomic_forward_batch and atomic_reverse_batch, not by resize)
+    CppAD::vector<Base>           batch_parameter_x;
+    CppAD::vector<ad_type_enum>   batch_type_x;
+    CppAD::vector<size_t>         batch_call_id;
+    CppAD::vector<bool>           batch_select;
+    CppAD::vector<size_t>         batch_index;
+    //
+    CppAD::vector<Base>           batch_taylor_x;
+    CppAD::vector<Base>           batch_taylor_y;
+    //
+    CppAD::vector<Base>           batch_partial_x;
+    CppAD::vector<Base>           batch_partial_y;
+    //
+    // forward_batch_off, reverse_batch_off
+    // atomic function indices for which a batch callback returned false
+    // during this sweep
+    CppAD::vector<size_t>         forward_batch_off;
+    CppAD::vector<size_t>         reverse_batch_off;
+    //
+    // batch_off
+    static bool batch_off(
+        const CppAD::vector<size_t>& off_list, size_t atom_index
+    )
+    {   for(size_t k = 0; k < off_list.size(); ++k)
+            if( off_list[k] == atom_index )
+                return true;
+        return false;
+    }
+    //
     // resize
     void resize(size_t m, size_t n, size_t n_order, sweep_type sweep)
     {   //
@@ -397,6 +429,274 @@ void atomic_forward_any(
 }
 /*
 -----------------------------------------------------------------------------
+{xrst_begin var_atomic_forward_batch dev}
+
+Batched Any Order Forward Atomic Function Calls
+###############################################
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_ATOMIC_FORWARD_BATCH
+    // END_ATOMIC_FORWARD_BATCH
+}
+
+Purpose
+*******
+If the atomic function call that starts at *itr* is the first
+in an :ref:`atomic_four_batch@Batch` ,
+the calls in the batch are evaluated using one
+:ref:`forward_batch<atomic_four_batch-name>` callback.
+Otherwise, or if the callback returns false, this routine is the same as
+:ref:`var_atomic_forward_any-name` for each call.
+
+itr
+***
+On input, this is at the first AFunOp for the first call in the batch.
+On output, it is at the second AFunOp for the last call in the batch.
+
+trace
+*****
+If this is true, the calls are not batched
+(so that the trace output is the same as for calls one at a time).
+
+cskip_op
+********
+is the vector of flags that identify which operators are skipped.
+A call that is skipped is not included in a batch.
+
+Other Arguments
+***************
+see :ref:`var_atomic_forward_any-name` .
+
+{xrst_end var_atomic_forward_batch}
+*/
+// BEGIN_ATOMIC_FORWARD_BATCH
+template <class Base, class RecBase>
+void atomic_forward_batch(
+    play::const_sequential_iterator& itr        ,
+    const player<Base>*              play       ,
+    const Base*                      parameter  ,
+    bool                             trace      ,
+    const bool*                      cskip_op   ,
+    atomic_op_work<Base>&            work       ,
+    size_t                           cap_order  ,
+    size_t                           order_low  ,
+    size_t                           order_up   ,
+    Base*                            taylor     )
+// END_ATOMIC_FORWARD_BATCH
+{  //
+    // vector
+    using CppAD::vector;
+    //
+    // op_code, i_var, arg
+    op_code_var   op_code;
+    size_t        i_var;
+    const addr_t* arg;
+    itr.op_info(op_code, arg, i_var);
+    CPPAD_ASSERT_UNKNOWN( op_code == AFunOp );
+    //
+    // atom_index, call_id, m, n
+    size_t atom_index, call_id, m, n;
+    play::atom_op_info<RecBase>(op_code, arg, atom_index, call_id, m, n);
+    //
+    // batch
+    // check if the next operator starts another call to this function
+    bool batch = ! trace;
+    batch &= ! work.batch_off(work.forward_batch_off, atom_index);
+    play::const_sequential_iterator peek;
+    if( batch )
+    {   peek = itr;
+        for(size_t k = 0; k < n + m + 2; ++k)
+            ++peek;
+        peek.op_info(op_code, arg, i_var);
+        batch = op_code == AFunOp && ! cskip_op[ peek.op_index() ];
+        if( batch )
+        {   size_t atom_next, call_next, m_next, n_next;
+            play::atom_op_info<RecBase>(
+                op_code, arg, atom_next, call_next, m_next, n_next
+            );
+            batch = atom_next == atom_index && m_next == m && n_next == n;
+        }
+    }
+    if( ! batch )
+    {   atomic_forward_any<Base, RecBase>(
+            itr, play, parameter, trace, work,
+            cap_order, order_low, order_up, taylor
+        );
+        return;
+    }
+    //
+    // par_is_dyn
+    const pod_vector<bool>& par_is_dyn( play->par_is_dyn() );
+    //
+    // n_order
+    size_t n_order = order_up + 1;
+    //
+    // parameter_x, type_x, call_id_vec, select_y, index_y, taylor_x, taylor_y
+    vector<Base>&         parameter_x( work.batch_parameter_x );
+    vector<ad_type_enum>& type_x( work.batch_type_x );
+    vector<size_t>&  call_id_vec( work.batch_call_id );
+    vector<bool>&    select_y( work.batch_select );
+    vector<size_t>&  index_y( work.batch_index );
+    vector<Base>&    taylor_x( work.batch_taylor_x );
+    vector<Base>&    taylor_y( work.batch_taylor_y );
+    //
+    // first_result, max_arg
+    // The calls in the batch are independent if every variable argument
+    // index is less than every variable result index.
+    size_t first_result = std::numeric_limits<size_t>::max();
+    size_t max_arg      = 0;
+    //
+    // n_call, last, peek
+    size_t n_call = 0;
+    play::const_sequential_iterator last;
+    peek = itr;
+    bool more = true;
+    while( more )
+    {   //
+        // call_id
+        peek.op_info(op_code, arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op_code == AFunOp );
+        play::atom_op_info<RecBase>(op_code, arg, atom_index, call_id, m, n);
+        //
+        // parameter_x, type_x, call_id_vec, select_y, index_y,
+        // taylor_x, taylor_y
+        parameter_x.resize( (n_call + 1) * n );
+        type_x.resize( (n_call + 1) * n );
+        call_id_vec.resize(n_call + 1);
+        select_y.resize( (n_call + 1) * m );
+        index_y.resize( (n_call + 1) * m );
+        taylor_x.resize( (n_call + 1) * n * n_order );
+        taylor_y.resize( (n_call + 1) * m * n_order );
+        call_id_vec[n_call] = call_id;
+        //
+        // max_arg_ell, first_result_ell
+        size_t max_arg_ell      = max_arg;
+        size_t first_result_ell = first_result;
+        //
+        // parameter_x, type_x, taylor_x
+        for(size_t j = 0; j < n; ++j)
+        {   (++peek).op_info(op_code, arg, i_var);
+            size_t index = (n_call * n + j) * n_order;
+            if( op_code == FunapOp )
+            {   CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < play->num_par_all() );
+                if( par_is_dyn[ arg[0] ] )
+                    type_x[n_call * n + j] = dynamic_enum;
+                else
+                    type_x[n_call * n + j] = constant_enum;
+                parameter_x[n_call * n + j] = parameter[ arg[0] ];
+                taylor_x[index + 0] = parameter[ arg[0] ];
+                for(size_t k = 1; k < n_order; ++k)
+                    taylor_x[index + k] = Base(0.0);
+            }
+            else
+            {   CPPAD_ASSERT_UNKNOWN( op_code == FunavOp );
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < play->num_var() );
+                type_x[n_call * n + j] = variable_enum;
+                parameter_x[n_call * n + j] =
+                    CppAD::numeric_limits<Base>::quiet_NaN();
+                for(size_t k = 0; k < n_order; ++k)
+                    taylor_x[index + k] =
+                        taylor[ size_t(arg[0]) * cap_order + k ];
+                max_arg_ell = std::max(max_arg_ell, size_t(arg[0]) );
+            }
+        }
+        //
+        // select_y, index_y, taylor_y
+        for(size_t i = 0; i < m; ++i)
+        {   (++peek).op_info(op_code, arg, i_var);
+            size_t index = (n_call * m + i) * n_order;
+            if( op_code == FunrpOp )
+            {   CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < play->num_par_all() );
+                select_y[n_call * m + i] = false;
+                index_y[n_call * m + i]  = std::numeric_limits<size_t>::max();
+                if( 0 < order_low )
+                    taylor_y[index + 0] = parameter[ arg[0] ];
+                for(size_t k = 1; k < order_low; ++k)
+                    taylor_y[index + k] = Base(0.0);
+            }
+            else
+            {   CPPAD_ASSERT_UNKNOWN( op_code == FunrvOp );
+                select_y[n_call * m + i] = true;
+                index_y[n_call * m + i]  = i_var;
+                for(size_t k = 0; k < order_low; ++k)
+                    taylor_y[index + k] = taylor[i_var * cap_order + k];
+                first_result_ell = std::min(first_result_ell, i_var);
+            }
+        }
+        //
+        // peek: second AFunOp for this call
+        (++peek).op_info(op_code, arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op_code == AFunOp );
+        //
+        // n_call, last, max_arg, first_result
+        more = max_arg_ell < first_result_ell;
+        if( more )
+        {   ++n_call;
+            last         = peek;
+            max_arg      = max_arg_ell;
+            first_result = first_result_ell;
+            //
+            // more: is next operator a call to the same function
+            (++peek).op_info(op_code, arg, i_var);
+            more = op_code == AFunOp && ! cskip_op[ peek.op_index() ];
+            if( more )
+            {   size_t atom_next, call_next, m_next, n_next;
+                play::atom_op_info<RecBase>(
+                    op_code, arg, atom_next, call_next, m_next, n_next
+                );
+                more = atom_next == atom_index && m_next == m && n_next == n;
+            }
+        }
+    }
+    CPPAD_ASSERT_UNKNOWN( 0 < n_call );
+    //
+    // parameter_x, type_x, call_id_vec, select_y, taylor_x, taylor_y
+    parameter_x.resize(n_call * n);
+    type_x.resize(n_call * n);
+    call_id_vec.resize(n_call);
+    select_y.resize(n_call * m);
+    taylor_x.resize(n_call * n * n_order);
+    taylor_y.resize(n_call * m * n_order);
+    //
+    // taylor_y
+    size_t need_y = size_t(variable_enum);
+    bool ok = 1 < n_call;
+    if( ok ) ok = sweep::call_atomic_forward_batch<Base, RecBase>(
+        parameter_x, type_x, need_y, select_y,
+        order_low, order_up, atom_index, call_id_vec, taylor_x, taylor_y
+    );
+    if( ! ok )
+    {   if( 1 < n_call )
+            work.forward_batch_off.push_back(atom_index);
+        for(size_t ell = 0; ell < n_call; ++ell)
+        {   if( 0 < ell )
+                ++itr;
+            atomic_forward_any<Base, RecBase>(
+                itr, play, parameter, trace, work,
+                cap_order, order_low, order_up, taylor
+            );
+        }
+        return;
+    }
+    //
+    // taylor
+    for(size_t ell = 0; ell < n_call; ++ell)
+    {   for(size_t i = 0; i < m; ++i) if( select_y[ell * m + i] )
+        {   size_t index = (ell * m + i) * n_order;
+            for(size_t k = order_low; k < n_order; ++k)
+                taylor[ index_y[ell * m + i] * cap_order + k ] =
+                    taylor_y[index + k];
+        }
+    }
+    //
+    // itr
+    itr = last;
+    return;
+}
+/*
+-----------------------------------------------------------------------------
 {xrst_begin var_atomic_forward_dir dev}
 
 Multiple Direction Forward Atomic Function Call
@@ -910,6 +1210,289 @@ void atomic_reverse(
 }
 /*
 -------------------------------------------------------------------------------
+{xrst_begin var_atomic_reverse_batch dev}
+
+Batched Reverse Atomic Function Calls
+#####################################
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_ATOMIC_REVERSE_BATCH
+    // END_ATOMIC_REVERSE_BATCH
+}
+
+Purpose
+*******
+If the atomic function call that ends at *itr* is the last
+in an :ref:`atomic_four_batch@Batch` ,
+the calls in the batch are evaluated using one
+:ref:`reverse_batch<atomic_four_batch-name>` callback.
+Otherwise, or if the callback returns false, this routine is the same as
+:ref:`var_atomic_reverse-name` for each call.
+
+itr
+***
+On input, this is at the second AFunOp for the last call in the batch.
+On output, it is at the first AFunOp for the first call in the batch.
+
+trace
+*****
+If this is true, the calls are not batched
+(so that the trace output is the same as for calls one at a time).
+
+cskip_op
+********
+is the vector of flags that identify which operators are skipped.
+A call that is skipped is not included in a batch.
+
+Other Arguments
+***************
+see :ref:`var_atomic_reverse-name` .
+
+{xrst_end var_atomic_reverse_batch}
+*/
+// BEGIN_ATOMIC_REVERSE_BATCH
+template <class Base, class RecBase, class Iterator>
+void atomic_reverse_batch(
+    Iterator&                        itr        ,
+    const player<Base>*              play       ,
+    const Base*                      parameter  ,
+    bool                             trace      ,
+    const bool*                      cskip_op   ,
+    atomic_op_work<Base>&            work       ,
+    size_t                           cap_order  ,
+    size_t                           n_order    ,
+    const Base*                      taylor     ,
+    Base*                            partial    )
+// END_ATOMIC_REVERSE_BATCH
+{  CPPAD_ASSERT_UNKNOWN( 0 < n_order );
+    //
+    // vector
+    using CppAD::vector;
+    //
+    // op_code, i_var, arg
+    op_code_var   op_code;
+    size_t        i_var;
+    const addr_t* arg;
+    itr.op_info(op_code, arg, i_var);
+    CPPAD_ASSERT_UNKNOWN( op_code == AFunOp );
+    //
+    // atom_index, call_id, m, n
+    size_t atom_index, call_id, m, n;
+    play::atom_op_info<RecBase>(op_code, arg, atom_index, call_id, m, n);
+    //
+    // batch
+    // check if the previous operator ends another call to this function
+    bool batch = ! trace;
+    batch &= ! work.batch_off(work.reverse_batch_off, atom_index);
+    Iterator peek;
+    if( batch )
+    {   peek = itr;
+        for(size_t k = 0; k < n + m + 2; ++k)
+            --peek;
+        peek.op_info(op_code, arg, i_var);
+        batch = op_code == AFunOp && ! cskip_op[ peek.op_index() ];
+        if( batch )
+        {   size_t atom_next, call_next, m_next, n_next;
+            play::atom_op_info<RecBase>(
+                op_code, arg, atom_next, call_next, m_next, n_next
+            );
+            batch = atom_next == atom_index && m_next == m && n_next == n;
+        }
+    }
+    if( ! batch )
+    {   atomic_reverse<Base, RecBase, Iterator>(
+            itr, play, parameter, trace, work,
+            cap_order, n_order, taylor, partial
+        );
+        return;
+    }
+    //
+    // par_is_dyn
+    const pod_vector<bool>& par_is_dyn( play->par_is_dyn() );
+    //
+    // order_up
+    size_t order_up = n_order - 1;
+    //
+    // parameter_x, type_x, call_id_vec, select_x, index_x
+    // taylor_x, taylor_y, partial_x, partial_y
+    vector<Base>&         parameter_x( work.batch_parameter_x );
+    vector<ad_type_enum>& type_x( work.batch_type_x );
+    vector<size_t>&  call_id_vec( work.batch_call_id );
+    vector<bool>&    select_x( work.batch_select );
+    vector<size_t>&  index_x( work.batch_index );
+    vector<Base>&    taylor_x( work.batch_taylor_x );
+    vector<Base>&    taylor_y( work.batch_taylor_y );
+    vector<Base>&    partial_x( work.batch_partial_x );
+    vector<Base>&    partial_y( work.batch_partial_y );
+    //
+    // first_result, max_arg
+    // The calls in the batch are independent if every variable argument
+    // index is less than every variable result index.
+    size_t first_result = std::numeric_limits<size_t>::max();
+    size_t max_arg      = 0;
+    //
+    // n_call, last, peek
+    // The calls are stored in the reverse of the order they are recorded.
+    size_t n_call = 0;
+    Iterator last;
+    peek = itr;
+    bool more = true;
+    while( more )
+    {   //
+        // call_id
+        peek.op_info(op_code, arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op_code == AFunOp );
+        play::atom_op_info<RecBase>(op_code, arg, atom_index, call_id, m, n);
+        //
+        // parameter_x, type_x, call_id_vec, select_x, index_x,
+        // taylor_x, taylor_y, partial_y
+        parameter_x.resize( (n_call + 1) * n );
+        type_x.resize( (n_call + 1) * n );
+        call_id_vec.resize(n_call + 1);
+        select_x.resize( (n_call + 1) * n );
+        index_x.resize( (n_call + 1) * n );
+        taylor_x.resize( (n_call + 1) * n * n_order );
+        taylor_y.resize( (n_call + 1) * m * n_order );
+        partial_y.resize( (n_call + 1) * m * n_order );
+        call_id_vec[n_call] = call_id;
+        //
+        // max_arg_ell, first_result_ell
+        size_t max_arg_ell      = max_arg;
+        size_t first_result_ell = first_result;
+        //
+        // taylor_y, partial_y
+        for(size_t ip1 = m; ip1 > 0; --ip1)
+        {   size_t i = ip1 - 1;
+            (--peek).op_info(op_code, arg, i_var);
+            size_t index = (n_call * m + i) * n_order;
+            if( op_code == FunrpOp )
+            {   CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < play->num_par_all() );
+                taylor_y[index + 0]  = parameter[ arg[0] ];
+                partial_y[index + 0] = Base(0.0);
+                for(size_t k = 1; k < n_order; ++k)
+                {   taylor_y[index + k]  = Base(0.0);
+                    partial_y[index + k] = Base(0.0);
+                }
+            }
+            else
+            {   CPPAD_ASSERT_UNKNOWN( op_code == FunrvOp );
+                for(size_t k = 0; k < n_order; ++k)
+                {   taylor_y[index + k]  = taylor[i_var * cap_order + k];
+                    partial_y[index + k] = partial[i_var * n_order + k];
+                }
+                first_result_ell = std::min(first_result_ell, i_var);
+            }
+        }
+        //
+        // parameter_x, type_x, select_x, index_x, taylor_x
+        for(size_t jp1 = n; jp1 > 0; --jp1)
+        {   size_t j = jp1 - 1;
+            (--peek).op_info(op_code, arg, i_var);
+            size_t index = (n_call * n + j) * n_order;
+            index_x[n_call * n + j] = size_t( arg[0] );
+            if( op_code == FunapOp )
+            {   CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < play->num_par_all() );
+                if( par_is_dyn[ arg[0] ] )
+                    type_x[n_call * n + j] = dynamic_enum;
+                else
+                    type_x[n_call * n + j] = constant_enum;
+                parameter_x[n_call * n + j] = parameter[ arg[0] ];
+                select_x[n_call * n + j] = false;
+                taylor_x[index + 0] = parameter[ arg[0] ];
+                for(size_t k = 1; k < n_order; ++k)
+                    taylor_x[index + k] = Base(0.0);
+            }
+            else
+            {   CPPAD_ASSERT_UNKNOWN( op_code == FunavOp );
+                CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < play->num_var() );
+                type_x[n_call * n + j] = variable_enum;
+                parameter_x[n_call * n + j] =
+                    CppAD::numeric_limits<Base>::quiet_NaN();
+                select_x[n_call * n + j] = true;
+                for(size_t k = 0; k < n_order; ++k)
+                    taylor_x[index + k] =
+                        taylor[ size_t(arg[0]) * cap_order + k ];
+                max_arg_ell = std::max(max_arg_ell, size_t(arg[0]) );
+            }
+        }
+        //
+        // peek: first AFunOp for this call
+        (--peek).op_info(op_code, arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op_code == AFunOp );
+        //
+        // n_call, last, max_arg, first_result
+        more = max_arg_ell < first_result_ell;
+        if( more )
+        {   ++n_call;
+            last         = peek;
+            max_arg      = max_arg_ell;
+            first_result = first_result_ell;
+            //
+            // more: is previous operator a call to the same function
+            (--peek).op_info(op_code, arg, i_var);
+            more = op_code == AFunOp && ! cskip_op[ peek.op_index() ];
+            if( more )
+            {   size_t atom_next, call_next, m_next, n_next;
+                play::atom_op_info<RecBase>(
+                    op_code, arg, atom_next, call_next, m_next, n_next
+                );
+                more = atom_next == atom_index && m_next == m && n_next == n;
+            }
+        }
+    }
+    CPPAD_ASSERT_UNKNOWN( 0 < n_call );
+    //
+    // parameter_x, type_x, call_id_vec, select_x,
+    // taylor_x, taylor_y, partial_y
+    parameter_x.resize(n_call * n);
+    type_x.resize(n_call * n);
+    call_id_vec.resize(n_call);
+    select_x.resize(n_call * n);
+    taylor_x.resize(n_call * n * n_order);
+    taylor_y.resize(n_call * m * n_order);
+    partial_y.resize(n_call * m * n_order);
+    //
+    // partial_x
+    partial_x.resize(n_call * n * n_order);
+    for(size_t k = 0; k < partial_x.size(); ++k)
+        partial_x[k] = Base(0.0);
+    bool ok = 1 < n_call;
+    if( ok ) ok = sweep::call_atomic_reverse_batch<Base, RecBase>(
+        parameter_x, type_x, select_x, order_up,
+        atom_index, call_id_vec, taylor_x, taylor_y, partial_x, partial_y
+    );
+    if( ! ok )
+    {   if( 1 < n_call )
+            work.reverse_batch_off.push_back(atom_index);
+        for(size_t ell = 0; ell < n_call; ++ell)
+        {   if( 0 < ell )
+                --itr;
+            atomic_reverse<Base, RecBase, Iterator>(
+                itr, play, parameter, trace, work,
+                cap_order, n_order, taylor, partial
+            );
+        }
+        return;
+    }
+    //
+    // partial
+    for(size_t ell = 0; ell < n_call; ++ell)
+    {   for(size_t j = 0; j < n; ++j) if( select_x[ell * n + j] )
+        {   size_t index = (ell * n + j) * n_order;
+            for(size_t k = 0; k < n_order; ++k)
+                partial[ index_x[ell * n + j] * n_order + k ] +=
+                    partial_x[index + k];
+        }
+    }
+    //
+    // itr
+    itr = last;
+    return;
+}
+/*
+-------------------------------------------------------------------------------
 {xrst_begin var_atomic_for_jac dev}
 
 Forward Jacobian Sparsity Atomic Function Call
@@ -2,9 +2,11 @@
 # define CPPAD_LOCAL_VAR_OP_CSKIP_OP_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
+# include <cppad/local/play/cskip_jump.hpp>
+
 namespace CppAD { namespace local { namespace var_op {
 /*!
 {xrst_begin_parent var_cskip_op dev}
@@ -107,6 +109,10 @@ Base
 is the type used for computations by this operator.
 This is either *RecBase* or AD< *RecBase* >.
 
+i_op
+****
+is the operator index for this conditional skip operator.
+
 i_z
 ***
 variable index corresponding to the result of the previous operation.
@@ -139,18 +145,27 @@ is vector specifying which operations are at this point are know to be
 unnecessary and can be skipped. This is both an input and an output; i.e.,
 the call may add more true values to *cskip_op* .
 
+cskip_jump
+**********
+If this call adds true values to *cskip_op* ,
+it also activates the jumps over the blocks of consecutive operators
+that have become true; see ``cskip_jump.set`` in the file
+``include/cppad/local/play/cskip_jump.hpp`` .
+
 {xrst_end var_cskip_forward_0}
 */
 // BEGIN_CSKIP_FORWARD_0
 template <class Base>
 inline void cskip_forward_0(
+    size_t               i_op           ,
     size_t               i_z            ,
     const addr_t*        arg            ,
     size_t               num_par        ,
     const Base*          parameter      ,
     size_t               cap_order      ,
     Base*                taylor         ,
-    bool*                cskip_op       )
+    bool*                cskip_op       ,
+    play::cskip_jump&    cskip_jump     )
 // END_CSKIP_FORWARD_0
 {   //
     //
@@ -222,6 +237,7 @@ inline void cskip_forward_0(
     {   for(addr_t i = 0; i < arg[5]; i++)
             cskip_op[ arg[6+arg[4]+i] ] = true;
     }
+    cskip_jump.set(i_op, true_case);
     return;
 }
 } } } // END namespace
@@ -2,7 +2,7 @@
 # define CPPAD_LOCAL_VAR_OP_CSUM_OP_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 namespace CppAD { namespace local { namespace var_op {
@@ -218,6 +218,87 @@ inline void csum_forward_any(
     }
 }
 /*
+{xrst_begin var_csum_forward_sum dev}
+
+Zero Order Forward Cumulative Summation Using a Wider Type
+##########################################################
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN_CSUM_FORWARD_SUM
+    // END_CSUM_FORWARD_SUM
+}
+
+Purpose
+*******
+This computes the same value as :ref:`var_csum_forward_any-name`
+with *order_low* and *order_up* equal to zero.
+The difference is that the summation is done using the type
+``csum_sum_type`` < *Base* >:: ``type`` and the result is converted
+to *Base* once at the end.
+This type is ``double`` when *Base* is ``float`` and *Base* otherwise.
+
+i_z, arg
+********
+see
+:ref:`var_csum_op@i_z` ,
+:ref:`var_csum_op@arg`
+
+num_par, parameter, cap_order, taylor
+*************************************
+see :ref:`var_csum_forward_any-name` .
+
+{xrst_end var_csum_forward_sum}
+*/
+/// type used for the summations in csum_forward_sum
+template <class Base> struct csum_sum_type
+{   typedef Base type; };
+template <> struct csum_sum_type<float>
+{   typedef double type; };
+//
+// BEGIN_CSUM_FORWARD_SUM
+template <class Base>
+inline void csum_forward_sum(
+    size_t        i_z         ,
+    const addr_t* arg         ,
+    size_t        num_par     ,
+    const Base*   parameter   ,
+    size_t        cap_order   ,
+    Base*         taylor      )
+// END_CSUM_FORWARD_SUM
+{   typedef typename csum_sum_type<Base>::type Sum;
+    //
+    // check assumptions
+    CPPAD_ASSERT_UNKNOWN( NumRes(CSumOp) == 1 );
+    CPPAD_ASSERT_UNKNOWN( 0 < cap_order );
+    CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+    CPPAD_ASSERT_UNKNOWN( arg[arg[4]] == arg[4] + 1 );
+    //
+    // sum
+    // constant parameter
+    Sum sum = Sum( parameter[ arg[0] ] );
+    // addition dynamic parameters
+    for(addr_t i = arg[2]; i < arg[3]; ++i)
+        sum += Sum( parameter[ arg[i] ] );
+    // subtraction dynamic parameters
+    for(addr_t i = arg[3]; i < arg[4]; ++i)
+        sum -= Sum( parameter[ arg[i] ] );
+    // addition variables
+    for(addr_t i = 5; i < arg[1]; ++i)
+    {   CPPAD_ASSERT_UNKNOWN( size_t(arg[i]) < i_z );
+        sum += Sum( taylor[ size_t(arg[i]) * cap_order ] );
+    }
+    // subtraction variables
+    for(addr_t i = arg[1]; i < arg[2]; ++i)
+    {   CPPAD_ASSERT_UNKNOWN( size_t(arg[i]) < i_z );
+        sum -= Sum( taylor[ size_t(arg[i]) * cap_order ] );
+    }
+    //
+    // z
+    taylor[ i_z * cap_order ] = Base( sum );
+}
+/*
 {xrst_begin var_csum_forward_dir dev}
 
 Multiple Direction Forward Mode Cumulative Summation Operation
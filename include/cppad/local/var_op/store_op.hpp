@@ -2,9 +2,11 @@
 # define CPPAD_LOCAL_VAR_OP_STORE_OP_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
+# include <cppad/local/play/vecad_state.hpp>
+
 namespace CppAD { namespace local { namespace var_op {
 /*
 {xrst_begin_parent var_store_op dev}
@@ -147,22 +149,31 @@ We use *i_vec* to denote the ``size_t`` value corresponding to
 :ref:`var_store_op@x` .
 If *x* is a parameter (variable) this is a parameter (variable) index.
 
-vec_ad2isvar
-************
-This vector has size :ref:`var_store_op@num_vecad_ind` .
-The input values of its elements does not matter.
+vecad
+*****
+This is the state of all the VecAD vectors for the current
+zero order forward sweep. Its vectors
+*vecad* . ``isvar()`` and *vecad* . ``index()`` have size
+:ref:`var_store_op@num_vecad_ind` .
+
+isvar
+=====
 If the value being stored is a parameter (variable),
-*vec_ad2isvar* [ *arg* [0] + *i_vec*  ] is set to false (true).
+*vecad* . ``isvar()`` [ *arg* [0] + *i_vec*  ] is set to false (true).
 
-vec_ad2index
-************
-This vector has size *num_vecad_ind* .
-The input value of its elements does not matter.
+index
+=====
 If the value being stored is a parameter (variable),
-*vec_ad2index* [ *arg* [0] + *i_vec*  ]
+*vecad* . ``index()`` [ *arg* [0] + *i_vec*  ]
 is set to the parameter (variable) index
 corresponding to the value being stored.
 
+changed
+=======
+The index *arg* [0] + *i_vec* is recorded as changed so that
+the next zero order forward sweep only needs to restore this element
+to its initial value.
+
 {xrst_end var_store_forward_0}
 */
 // BEGIN_STORE_FORWARD_0
@@ -175,14 +186,13 @@ inline void store_forward_0(
     const Base*          parameter      ,
     size_t               cap_order      ,
     const Base*          taylor         ,
-    pod_vector<bool>&    vec_ad2isvar   ,
-    pod_vector<size_t>&  vec_ad2index   )
+    play::vecad_state&   vecad          )
 // END_STORE_FORWARD_0
 {  //
     //
     CPPAD_ASSERT_NARG_NRES(op_code, 3, 0);
     CPPAD_ASSERT_UNKNOWN( 0 < arg[0] );
-    CPPAD_ASSERT_UNKNOWN( vec_ad2isvar.size() == vec_ad2index.size() )
+    CPPAD_ASSERT_UNKNOWN( vecad.isvar().size() == vecad.index().size() )
     //
     // i_y
     size_t i_y = size_t( arg[2] );
@@ -223,13 +233,12 @@ inline void store_forward_0(
     }
     //
     CPPAD_ASSERT_KNOWN(
-        size_t(i_vec) < vec_ad2index[ arg[0] - 1 ] ,
+        size_t(i_vec) < vecad.index()[ arg[0] - 1 ] ,
         "VecAD: zero order forward index out of range"
     );
     //
-    // vec_ad2isvar, vec_ad2index
-    vec_ad2isvar[ arg[0] + i_vec ]  = isvar;
-    vec_ad2index[ arg[0] + i_vec ]  = i_y;
+    // vecad
+    vecad.set( size_t(arg[0] + i_vec), isvar, i_y );
 }
 /*
 ------------------------------------------------------------------------------
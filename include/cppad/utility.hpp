@@ -2,7 +2,7 @@
 # define CPPAD_UTILITY_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 // BEGIN_SORT_THIS_LINE_PLUS_1
 # include <cppad/utility/check_numeric_type.hpp>
@@ -27,6 +27,7 @@
 # include <cppad/utility/romberg_mul.hpp>
 # include <cppad/utility/romberg_one.hpp>
 # include <cppad/utility/rosen_34.hpp>
+# include <cppad/utility/rosen_34_sparse.hpp>
 # include <cppad/utility/runge_45.hpp>
 # include <cppad/utility/set_union.hpp>
 # include <cppad/utility/sparse_rc.hpp>
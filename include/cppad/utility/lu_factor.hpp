@@ -2,7 +2,7 @@
 # define CPPAD_UTILITY_LU_FACTOR_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 /*
@@ -144,6 +144,18 @@ the determinant of the matrix *A* is equal to
 
     *sign* * *LU* [ *ip* [0], *jp* [0]] * ... * *LU* [ *ip* [ *n* ``-1`` ], *jp* [ *n* ``-1`` ]]
 
+Pivoting
+========
+If *Float* is ``float`` or ``double`` ,
+the factorization uses row pivoting and a blocked algorithm
+whose inner loops access contiguous memory.
+In this case, the output value of *jp* [ *j* ] is *j* for all *j* .
+For all other *Float* types, both the rows and columns are pivoted
+and each pivot is the element of maximum absolute value
+in the remaining sub-matrix.
+The program :ref:`lu_factor_speed.cpp-name` compares the speed of
+these two algorithms.
+
 SizeVector
 **********
 The type *SizeVector* must be a :ref:`SimpleVector-name` class with
@@ -208,6 +220,7 @@ of *x* is greater than or equal the
 sum of the square of the real and imaginary parts of *y* .
 {xrst_toc_hidden
     example/utility/lu_factor.cpp
+    speed/example/lu_factor_speed.cpp
     xrst/lu_factor_hpp.xrst
 }
 Example
@@ -229,6 +242,8 @@ current source code that implements these specifications.
 */
 // BEGIN C++
 
+# include <algorithm>
+# include <cmath>
 # include <complex>
 # include <vector>
 
@@ -266,9 +281,12 @@ inline bool AbsGeq(
     return xsq >= ysq;
 }
 
+namespace local { namespace utility { // BEGIN local::utility namespace
+
+// lu_factor_full: LuFactor with both row and column pivoting
 // Lines that are different from code in cppad/core/lu_ratio.hpp end with //
 template <class SizeVector, class FloatVector>                          //
-int LuFactor(SizeVector &ip, SizeVector &jp, FloatVector &LU)           //
+int lu_factor_full(SizeVector &ip, SizeVector &jp, FloatVector &LU)     //
 {
     // type of the elements of LU                                   //
     typedef typename FloatVector::value_type Float;                 //
@@ -383,6 +401,150 @@ int LuFactor(SizeVector &ip, SizeVector &jp, FloatVector &LU)           //
     }
     return sign;
 }
+
+// lu_factor_partial: LuFactor with row pivoting and jp equal to identity
+template <class SizeVector, class FloatVector>
+int lu_factor_partial(SizeVector &ip, SizeVector &jp, FloatVector &LU)
+{   typedef typename FloatVector::value_type Float;
+    CheckSimpleVector<Float, FloatVector>();
+    CheckSimpleVector<size_t, SizeVector>();
+    //
+    size_t n = ip.size();
+    CPPAD_ASSERT_KNOWN(
+        size_t(jp.size()) == n,
+        "Error in LuFactor: jp must have size equal to n"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t(LU.size()) == n * n,
+        "Error in LuFactor: LU must have size equal to n * m"
+    );
+    const Float zero(0);
+    const Float one(1);
+    //
+    // n_block: number of columns in each panel
+    // n_chunk: number of columns of the trailing matrix updated together
+    const size_t n_block = 64;
+    const size_t n_chunk = 256;
+    //
+    // a: row i of a is row ip[i] of the original matrix.
+    // The rows of a are swapped so that every inner loop is unit stride.
+    std::vector<Float> work(n * n);
+    Float* a = work.data();
+    for(size_t i = 0; i < n; ++i)
+    {   ip[i] = i;
+        jp[i] = i;
+        for(size_t j = 0; j < n; ++j)
+            a[i * n + j] = LU[i * n + j];
+    }
+    int sign = 1;
+    //
+    // Compute L * U = P where L is unit lower triangular
+    for(size_t k_start = 0; k_start < n; k_start += n_block)
+    {   size_t k_end = std::min(k_start + n_block, n);
+        //
+        // factor the panel with columns k_start, ... , k_end-1
+        for(size_t k = k_start; k < k_end; ++k)
+        {   // row with maximum absolute value in column k
+            size_t imax = n;
+            Float  emax = zero;
+            for(size_t i = k; i < n; ++i)
+            {   Float etmp = std::fabs( a[i * n + k] );
+                if( emax < etmp || (imax == n && emax <= etmp) )
+                {   imax = i;
+                    emax = etmp;
+                }
+            }
+            CPPAD_ASSERT_KNOWN(
+            imax < n ,
+            "LuFactor can't determine an element with "
+            "maximum absolute value.\n"
+            "Perhaps original matrix contains not a number or infinity.\n"
+            );
+            if( emax == zero )
+                return 0;
+            if( imax != k )
+            {   std::swap_ranges(a + k * n, a + (k + 1) * n, a + imax * n);
+                std::swap(ip[k], ip[imax]);
+                sign = - sign;
+            }
+            const Float* row_k = a + k * n;
+            const Float  scale = one / row_k[k];
+            for(size_t i = k + 1; i < n; ++i)
+            {   Float* row_i = a + i * n;
+                row_i[k]    *= scale;
+                Float l_ik   = row_i[k];
+                for(size_t j = k + 1; j < k_end; ++j)
+                    row_i[j] -= l_ik * row_k[j];
+            }
+        }
+        //
+        // rows of U for this panel: columns k_end, ... , n-1
+        for(size_t k = k_start; k < k_end; ++k)
+        {   const Float* row_k = a + k * n;
+            for(size_t i = k + 1; i < k_end; ++i)
+            {   Float* row_i = a + i * n;
+                Float  l_ik  = row_i[k];
+                for(size_t j = k_end; j < n; ++j)
+                    row_i[j] -= l_ik * row_k[j];
+            }
+        }
+        //
+        // update the trailing matrix, n_chunk columns at a time so that
+        // the corresponding rows of U stay in cache
+        for(size_t j_start = k_end; j_start < n; j_start += n_chunk)
+        {   size_t j_end = std::min(j_start + n_chunk, n);
+            for(size_t i = k_end; i < n; ++i)
+            {   Float* row_i = a + i * n;
+                for(size_t k = k_start; k < k_end; ++k)
+                {   const Float* row_k = a + k * n;
+                    Float        l_ik  = row_i[k];
+                    for(size_t j = j_start; j < j_end; ++j)
+                        row_i[j] -= l_ik * row_k[j];
+                }
+            }
+        }
+    }
+    //
+    // Move the diagonal from U to L (so U is unit upper triangular)
+    // and store the result in LU.
+    for(size_t i = 0; i < n; ++i)
+    {   Float* row_i = a + i * n;
+        for(size_t j = 0; j < i; ++j)
+            row_i[j] *= a[j * n + j];
+        const Float scale = one / row_i[i];
+        for(size_t j = i + 1; j < n; ++j)
+            row_i[j] *= scale;
+        for(size_t j = 0; j < n; ++j)
+            LU[ ip[i] * n + j ] = row_i[j];
+    }
+    return sign;
+}
+
+// lu_factor_choose<Float>::factor: chooses the LuFactor algorithm for Float
+template <class Float> struct lu_factor_choose {
+    template <class SizeVector, class FloatVector>
+    static int factor(SizeVector &ip, SizeVector &jp, FloatVector &LU)
+    {   return lu_factor_full(ip, jp, LU); }
+};
+template <> struct lu_factor_choose<float> {
+    template <class SizeVector, class FloatVector>
+    static int factor(SizeVector &ip, SizeVector &jp, FloatVector &LU)
+    {   return lu_factor_partial(ip, jp, LU); }
+};
+template <> struct lu_factor_choose<double> {
+    template <class SizeVector, class FloatVector>
+    static int factor(SizeVector &ip, SizeVector &jp, FloatVector &LU)
+    {   return lu_factor_partial(ip, jp, LU); }
+};
+
+} } // END local::utility namespace
+
+// LuFactor
+template <class SizeVector, class FloatVector>
+int LuFactor(SizeVector &ip, SizeVector &jp, FloatVector &LU)
+{   typedef typename FloatVector::value_type Float;
+    return local::utility::lu_factor_choose<Float>::factor(ip, jp, LU);
+}
 } // END CppAD namespace
 // END C++
 # endif
@@ -0,0 +1,413 @@
+# ifndef CPPAD_UTILITY_ROSEN_34_SPARSE_HPP
+# define CPPAD_UTILITY_ROSEN_34_SPARSE_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+{xrst_begin Rosen34Sparse}
+{xrst_spell
+    dep
+    nnz
+    rcv
+    rosenbrock
+    tf
+    xf
+}
+
+A Rosenbrock ODE Solver With a Sparse Jacobian
+##############################################
+
+Syntax
+******
+| # ``include <cppad/utility/rosen_34_sparse.hpp>``
+| *xf* = ``Rosen34Sparse`` ( *F* , *M* , *ti* , *tf* , *xi* , *pattern* )
+| *xf* = ``Rosen34Sparse`` ( *F* , *M* , *ti* , *tf* , *xi* , *pattern* , *e* )
+
+Description
+***********
+This is the same embedded 3rd and 4th order Rosenbrock ODE solver as
+:ref:`Rosen34-name` .
+The difference is that the Jacobian :math:`\partial_x F(t, x)`
+is a sparse matrix with a known sparsity pattern.
+The Jacobian is returned by *F* in a :ref:`sparse_rcv-name` object
+and the linear equations are solved using a sparse LU factorization.
+The analysis of the sparsity pattern for the factorization
+(including the fill in) is only done once for each call to
+``Rosen34Sparse`` ; i.e., it is reused for all the steps.
+The work and memory for each step is proportional to the number of
+non-zeros in the factors instead of :math:`n^3` and :math:`n^2`
+respectively.
+
+Pivoting
+========
+The matrix that is factored is
+:math:`E = I - \partial_x F(t, x) h / 2`
+where :math:`h` is the step size.
+No pivoting is done during the sparse factorization
+(so that the same factor sparsity pattern can be used for every step).
+Factorization without pivoting is stable when :math:`E` is
+diagonally dominant.
+This is true when :math:`h \| \partial_x F(t, x) \|_\infty / 2 < 1`.
+It is also true, for any :math:`h > 0` , when each diagonal element of
+:math:`\partial_x F(t, x)` is non-positive and its absolute value
+is greater than or equal the sum of the absolute values of the other
+elements in its row; e.g., a discretized diffusion operator.
+This is a common case for stiff problems.
+Otherwise, a pivot may be small or zero; see
+:ref:`Rosen34Sparse@Fun@Nan` .
+
+Include
+*******
+The file ``cppad/utility/rosen_34_sparse.hpp``
+is included by ``cppad/cppad.hpp``
+but it can also be included separately with out the rest of
+the ``CppAD`` routines.
+
+xf
+**
+The return value *xf* has the prototype
+
+    *Vector* *xf*
+
+and the size of *xf* is equal to *n* .
+It has the same specifications as for :ref:`Rosen34<Rosen34@xf>` .
+
+Fun
+***
+The class *Fun*
+and the object *F* satisfy the prototype
+
+    *Fun* & *F*
+
+This must support the following set of calls
+
+| |tab| *F* . ``Ode`` ( *t* , *x* , *f* )
+| |tab| *F* . ``Ode_ind`` ( *t* , *x* , *f_t* )
+| |tab| *F* . ``Ode_dep`` ( *t* , *x* , *f_x* )
+
+The arguments *t* , *x* , *f* , and *f_t* have the same specifications
+as for :ref:`Rosen34<Rosen34@Fun>` .
+
+f_x
+===
+The argument *f_x* to *F* . ``Ode_dep`` has prototype
+
+    ``sparse_rcv`` < *SizeVector* , *Vector* >& *f_x*
+
+Its sparsity pattern is equal to *pattern* and can not be changed.
+The input values of its elements do not matter.
+On output, for *k* = 0 , ..., *pattern* . ``nnz`` () ``-1`` ,
+*f_x* . ``val`` ()[ *k* ] is set equal to
+:math:`\partial_{x(j)} F_i (t, x)` where
+*i* = *pattern* . ``row`` ()[ *k* ] and
+*j* = *pattern* . ``col`` ()[ *k* ] ; e.g., using :ref:`sparse_jac_for-name`
+with the same *work* object for all the calls.
+
+Nan
+===
+If any of the elements of *f* , *f_t* , or *f_x* . ``val`` ()
+have the value not a number ``nan`` ,
+the routine ``Rosen34Sparse`` returns with all the
+elements of *xf* and *e* equal to ``nan`` .
+This is also done if a pivot in the factorization of
+:math:`I - \partial_x F(t, x) h / 2` is zero or ``nan`` .
+The caller can reduce the step size :math:`h` (increase *M* )
+and try again.
+
+M
+*
+The number of steps *M* has the same specifications as for
+:ref:`Rosen34<Rosen34@M>` .
+
+ti
+**
+The initial time *ti* has the same specifications as for
+:ref:`Rosen34<Rosen34@ti>` .
+
+tf
+**
+The final time *tf* has the same specifications as for
+:ref:`Rosen34<Rosen34@tf>` .
+
+xi
+**
+The initial value *xi* has the same specifications as for
+:ref:`Rosen34<Rosen34@xi>` .
+
+pattern
+*******
+The argument *pattern* has prototype
+
+    ``const sparse_rc`` < *SizeVector* >& *pattern*
+
+It is a sparsity pattern for the Jacobian :math:`\partial_x F(t, x)`
+that is valid for all the values of *t* and *x* ; e.g.,
+it can be computed using :ref:`for_jac_sparsity-name` .
+The number of rows and columns in *pattern* is equal to *n* .
+
+e
+*
+The error estimate *e* has the same specifications as for
+:ref:`Rosen34<Rosen34@e>` .
+
+Scalar
+******
+The type *Scalar* has the same specifications as for
+:ref:`Rosen34<Rosen34@Scalar>` .
+
+Vector
+******
+The type *Vector* has the same specifications as for
+:ref:`Rosen34<Rosen34@Vector>` .
+
+SizeVector
+**********
+The type *SizeVector* is a :ref:`SimpleVector-name` class with
+:ref:`elements of type<SimpleVector@Elements of Specified Type>`
+``size_t`` .
+
+Parallel Mode
+*************
+For each set of types
+:ref:`Rosen34Sparse@Scalar` ,
+:ref:`Rosen34Sparse@Vector` , and
+:ref:`Rosen34Sparse@Fun` ,
+the first call to ``Rosen34Sparse``
+must not be :ref:`parallel<ta_in_parallel-name>` execution mode.
+
+Example
+*******
+{xrst_toc_hidden
+    example/utility/rosen_34_sparse.cpp
+}
+The file
+:ref:`rosen_34_sparse.cpp-name`
+contains an example and test of using this routine.
+
+Source Code
+***********
+The source code for this routine is in the file
+``cppad/utility/rosen_34_sparse.hpp`` .
+
+{xrst_end Rosen34Sparse}
+--------------------------------------------------------------------------
+*/
+
+# include <cstddef>
+# include <cppad/core/cppad_assert.hpp>
+# include <cppad/utility/check_simple_vector.hpp>
+# include <cppad/utility/check_numeric_type.hpp>
+# include <cppad/utility/nan.hpp>
+# include <cppad/utility/vector.hpp>
+# include <cppad/utility/sparse_rc.hpp>
+# include <cppad/utility/sparse_rcv.hpp>
+# include <cppad/local/utility/sparse_lu.hpp>
+
+// needed before one can use CPPAD_ASSERT_FIRST_CALL_NOT_PARALLEL
+# include <cppad/utility/thread_alloc.hpp>
+
+namespace CppAD { // BEGIN CppAD namespace
+
+template <class Scalar, class Vector, class Fun, class SizeVector>
+Vector Rosen34Sparse(
+    Fun                           &F       ,
+    size_t                         M       ,
+    const Scalar                  &ti      ,
+    const Scalar                  &tf      ,
+    const Vector                  &xi      ,
+    const sparse_rc<SizeVector>   &pattern )
+{   Vector e( xi.size() );
+    return Rosen34Sparse(F, M, ti, tf, xi, pattern, e);
+}
+
+template <class Scalar, class Vector, class Fun, class SizeVector>
+Vector Rosen34Sparse(
+    Fun                           &F       ,
+    size_t                         M       ,
+    const Scalar                  &ti      ,
+    const Scalar                  &tf      ,
+    const Vector                  &xi      ,
+    const sparse_rc<SizeVector>   &pattern ,
+    Vector                        &e       )
+{
+    CPPAD_ASSERT_FIRST_CALL_NOT_PARALLEL;
+
+    // check numeric type specifications
+    CheckNumericType<Scalar>();
+
+    // check simple vector class specifications
+    CheckSimpleVector<Scalar, Vector>();
+    CheckSimpleVector<size_t, SizeVector>();
+
+    // Parameters for Shampine's Rosenbrock method
+    // are static to avoid recalculation on each call and
+    // do not use Vector to avoid possible memory leak
+    static Scalar a[3] = {
+        Scalar(0),
+        Scalar(1),
+        Scalar(3)   / Scalar(5)
+    };
+    static Scalar b[2 * 2] = {
+        Scalar(1),
+        Scalar(0),
+        Scalar(24)  / Scalar(25),
+        Scalar(3)   / Scalar(25)
+    };
+    static Scalar ct[4] = {
+        Scalar(1)   / Scalar(2),
+        - Scalar(3) / Scalar(2),
+        Scalar(121) / Scalar(50),
+        Scalar(29)  / Scalar(250)
+    };
+    static Scalar cg[3 * 3] = {
+        - Scalar(4),
+        Scalar(0),
+        Scalar(0),
+        Scalar(186) / Scalar(25),
+        Scalar(6)   / Scalar(5),
+        Scalar(0),
+        - Scalar(56) / Scalar(125),
+        - Scalar(27) / Scalar(125),
+        - Scalar(1)  / Scalar(5)
+    };
+    static Scalar d3[3] = {
+        Scalar(97) / Scalar(108),
+        Scalar(11) / Scalar(72),
+        Scalar(25) / Scalar(216)
+    };
+    static Scalar d4[4] = {
+        Scalar(19)  / Scalar(18),
+        Scalar(1)   / Scalar(4),
+        Scalar(25)  / Scalar(216),
+        Scalar(125) / Scalar(216)
+    };
+    CPPAD_ASSERT_KNOWN(
+        M >= 1,
+        "Error in Rosen34Sparse: the number of steps is less than one"
+    );
+    CPPAD_ASSERT_KNOWN(
+        e.size() == xi.size(),
+        "Error in Rosen34Sparse: size of e not equal to size of xi"
+    );
+    CPPAD_ASSERT_KNOWN(
+        pattern.nr() == xi.size() && pattern.nc() == xi.size(),
+        "Error in Rosen34Sparse: pattern is not an n by n matrix"
+    );
+    size_t i, k, l, m;                // indices
+
+    size_t  n    = xi.size();         // number of components in X(t)
+    Scalar  ns   = Scalar(double(M)); // number of steps as Scalar object
+    Scalar  h    = (tf - ti) / ns;    // step size
+    Scalar  zero = Scalar(0);         // some constants
+    Scalar  two  = Scalar(2);
+
+    // sparse LU factorization of E = I - f_x * h / 2
+    // (the analysis of the sparsity pattern is reused for every step)
+    local::utility::sparse_lu<Scalar> E;
+    E.analyze(pattern);
+
+    // vectors used to store values returned by F
+    sparse_rcv<SizeVector, Vector> f_x(pattern);
+    Vector Eg(n), f_t(n);
+    Vector g(n * 3), x3(n), x4(n), xf(n), ftmp(n), xtmp(n), nan_vec(n);
+
+    // initialize e = 0, nan_vec = nan
+    for(i = 0; i < n; i++)
+    {   e[i]       = zero;
+        nan_vec[i] = nan(zero);
+    }
+
+    xf = xi;           // initialize solution
+    for(m = 0; m < M; m++)
+    {   // time at beginning of this interval
+        Scalar t = ti * (Scalar(int(M - m)) / ns)
+                      + tf * (Scalar(int(m)) / ns);
+
+        // value of x at beginning of this interval
+        x3 = x4 = xf;
+
+        // evaluate partial derivatives at beginning of this interval
+        F.Ode_ind(t, xf, f_t);
+        F.Ode_dep(t, xf, f_x);
+        if( hasnan(f_t) || hasnan( f_x.val() ) )
+        {   e = nan_vec;
+            return nan_vec;
+        }
+
+        // LU factor the matrix E = I - f_x * h / 2
+        if( ! E.factor(- h / two, f_x.val() ) )
+        {   e = nan_vec;
+            return nan_vec;
+        }
+
+        // loop over integration steps
+        for(k = 0; k < 3; k++)
+        {   // set location for next function evaluation
+            xtmp = xf;
+            for(l = 0; l < k; l++)
+            {   // loop over previous function evaluations
+                Scalar bkl = b[(k-1)*2 + l];
+                for(i = 0; i < n; i++)
+                {   // loop over elements of x
+                    xtmp[i] += bkl * g[i*3 + l] * h;
+                }
+            }
+            // ftmp = F(t + a[k] * h, xtmp)
+            F.Ode(t + a[k] * h, xtmp, ftmp);
+            if( hasnan(ftmp) )
+            {   e = nan_vec;
+                return nan_vec;
+            }
+
+            // Form Eg for this integration step
+            for(i = 0; i < n; i++)
+                Eg[i] = ftmp[i] + ct[k] * f_t[i] * h;
+            for(l = 0; l < k; l++)
+            {   for(i = 0; i < n; i++)
+                    Eg[i] += cg[(k-1)*3 + l] * g[i*3 + l];
+            }
+
+            // Solve the equation E * g = Eg
+            E.solve(Eg);
+
+            // save solution and advance x3, x4
+            for(i = 0; i < n; i++)
+            {   g[i*3 + k]  = Eg[i];
+                x3[i]      += h * d3[k] * Eg[i];
+                x4[i]      += h * d4[k] * Eg[i];
+            }
+        }
+        // Form Eg for last update to x4 only
+        for(i = 0; i < n; i++)
+            Eg[i] = ftmp[i] + ct[3] * f_t[i] * h;
+        for(l = 0; l < 3; l++)
+        {   for(i = 0; i < n; i++)
+                Eg[i] += cg[2*3 + l] * g[i*3 + l];
+        }
+
+        // Solve the equation E * g = Eg
+        E.solve(Eg);
+
+        // advance x4 and accumulate error bound
+        for(i = 0; i < n; i++)
+        {   x4[i] += h * d4[3] * Eg[i];
+
+            // cant use abs because cppad.hpp may not be included
+            Scalar diff = x4[i] - x3[i];
+            if( diff < zero )
+                e[i] -= diff;
+            else
+                e[i] += diff;
+        }
+
+        // advance xf for this step using x4
+        xf = x4;
+    }
+    return xf;
+}
+
+} // End CppAD namespace
+
+# endif
@@ -2,13 +2,20 @@
 # define CPPAD_UTILITY_THREAD_ALLOC_HPP
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <sstream>
 # include <limits>
 # include <memory>
 # include <cstdint>
+# include <new>
+# include <atomic>
+# include <algorithm>
+# include <cppad/configure.hpp>
+# if CPPAD_HAS_MMAP
+# include <sys/mman.h>
+# endif
 
 
 # ifdef _MSC_VER
@@ -27,12 +34,28 @@ namespace CppAD { // BEGIN_CPPAD_NAMESPACE
 File used to define the CppAD multi-threading allocator class
 */
 
+/*!
+\def CPPAD_FINE_CAPACITY_BYTES
+If this is zero, each capacity is 3/2 times the previous capacity.
+Otherwise, the capacities that would be greater than or equal this number
+of bytes are 9/8 times the previous capacity.
+The user may define this symbol before including any of the CppAD files.
+*/
+# ifndef CPPAD_FINE_CAPACITY_BYTES
+# define CPPAD_FINE_CAPACITY_BYTES 0
+# endif
+
 /*!
 \def CPPAD_MAX_NUM_CAPACITY
 Maximum number of different capacities the allocator will attempt.
-This must be larger than the log base two of numeric_limit<size_t>::max().
+This must be larger than the log base two of numeric_limit<size_t>::max()
+divided by the log base two of the smallest capacity growth factor.
 */
+# if CPPAD_FINE_CAPACITY_BYTES == 0
 # define CPPAD_MAX_NUM_CAPACITY 100
+# else
+# define CPPAD_MAX_NUM_CAPACITY 400
+# endif
 
 /*!
 \def CPPAD_MIN_DOUBLE_CAPACITY
@@ -95,7 +118,13 @@ private:
             {   CPPAD_ASSERT_UNKNOWN( number < CPPAD_MAX_NUM_CAPACITY );
                 value[number++] = capacity;
                 // next capactiy is 3/2 times the current one
-                capacity        = 3 * ( (capacity + 1) / 2 );
+                size_t next     = 3 * ( (capacity + 1) / 2 );
+                if( CPPAD_FINE_CAPACITY_BYTES != 0 &&
+                    next >= size_t(CPPAD_FINE_CAPACITY_BYTES) )
+                {   // next capacity is 9/8 times the current one
+                    next = 9 * ( (capacity + 7) / 8 );
+                }
+                capacity        = next;
             }
             CPPAD_ASSERT_UNKNOWN( number > 0 );
         }
@@ -106,6 +135,7 @@ private:
         /// extra information (currently used by create and delete array)
         size_t             extra_;
         /// an index that uniquely identifies both thread and capacity
+        /// (the mmap_bit is also set if this block was allocated using mmap)
         size_t             tc_index_;
         /// pointer to the next memory allocation with the same tc_index_
         void*              next_;
@@ -142,6 +172,18 @@ private:
         this structure from the structure for the next thread.
         */
         block_t root_inuse_[CPPAD_MAX_NUM_CAPACITY];
+        /// number of blocks in use for this thread and each capacity
+        size_t  num_inuse_[CPPAD_MAX_NUM_CAPACITY];
+        /// number of blocks available for this thread and each capacity
+        size_t  num_available_[CPPAD_MAX_NUM_CAPACITY];
+        /*!
+        List of blocks, allocated by this thread, that were returned by
+        other threads during parallel mode. These blocks are still in use
+        until this thread moves them to its available list; see drain_remote.
+        The list is linked through the first pointer in the memory
+        that follows each block_t.
+        */
+        std::atomic<void*> remote_free_;
     };
     // ---------------------------------------------------------------------
     /*!
@@ -165,6 +207,111 @@ private:
     }
     // ---------------------------------------------------------------------
     /*!
+    Set and Get the minimum capacity that is allocated using mmap.
+
+    \param set [in]
+    if true, the value returned by this return is changed.
+
+    \param new_value [in]
+    if set is true, this is the new value returned by this routine.
+    Otherwise, new_value is ignored.
+
+    \return
+    the current setting for this routine (which is initially zero).
+    The value zero means that mmap is not used.
+    */
+    static size_t set_get_mmap_bytes(bool set, size_t new_value = 0)
+    {   static size_t value = 0;
+        if( set )
+            value = new_value;
+        return value;
+    }
+    // ---------------------------------------------------------------------
+    /*!
+    Is memory with a specified capacity allocated using mmap.
+
+    \param capacity [in]
+    is the capacity for the memory block (not including block_t).
+    */
+    static bool use_mmap(size_t capacity)
+    {   size_t mmap_bytes = set_get_mmap_bytes(false);
+        return CPPAD_HAS_MMAP && mmap_bytes != 0 && mmap_bytes <= capacity;
+    }
+    // ---------------------------------------------------------------------
+    /*!
+    Bit in block_t::tc_index_ that is set when the block was allocated
+    using mmap. It records how to return the block to the system,
+    even if mmap_bytes has changed since the block was allocated.
+    */
+    static size_t mmap_bit(void)
+    {   return size_t(1) << (std::numeric_limits<size_t>::digits - 1); }
+    // ---------------------------------------------------------------------
+    /*!
+    Get memory for a block from the system.
+
+    \param capacity [in]
+    is the capacity for the memory block (not including block_t).
+
+    \param tc_index [in]
+    is the thread and capacity index for this block.
+
+    \return
+    is a pointer to sizeof(block_t) + capacity bytes of memory.
+    The tc_index_ field of the block_t at the beginning of this memory is
+    tc_index plus the mmap_bit if the memory was allocated using mmap.
+    */
+    static void* system_new(size_t capacity, size_t tc_index)
+    {   CPPAD_ASSERT_UNKNOWN( (tc_index & mmap_bit()) == 0 );
+        size_t n_bytes = sizeof(block_t) + capacity;
+# if CPPAD_HAS_MMAP
+        if( use_mmap(capacity) )
+        {   void* v_node = ::mmap(
+                nullptr,
+                n_bytes,
+                PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS,
+                -1,
+                0
+            );
+            if( v_node == MAP_FAILED )
+                throw std::bad_alloc();
+# ifdef MADV_HUGEPAGE
+            // ask for transparent huge pages (ignore failure)
+            ::madvise(v_node, n_bytes, MADV_HUGEPAGE);
+# endif
+            reinterpret_cast<block_t*>(v_node)->tc_index_ =
+                tc_index | mmap_bit();
+            return v_node;
+        }
+# endif
+        void* v_node = ::operator new(n_bytes);
+        reinterpret_cast<block_t*>(v_node)->tc_index_ = tc_index;
+        return v_node;
+    }
+    // ---------------------------------------------------------------------
+    /*!
+    Return memory for a block to the system.
+
+    \param v_node [in]
+    is a pointer returned by system_new(capacity, tc_index).
+
+    \param capacity [in]
+    is the capacity for the memory block (not including block_t).
+    */
+    static void system_delete(void* v_node, size_t capacity)
+    {
+# if CPPAD_HAS_MMAP
+        size_t tc_index = reinterpret_cast<block_t*>(v_node)->tc_index_;
+        if( tc_index & mmap_bit() )
+        {   size_t n_bytes = sizeof(block_t) + capacity;
+            ::munmap(v_node, n_bytes);
+            return;
+        }
+# endif
+        ::operator delete(v_node);
+    }
+    // ---------------------------------------------------------------------
+    /*!
     Get pointer to the information for this thread.
 
     \param thread [in]
@@ -185,8 +332,11 @@ private:
     <code>info->count_available == 0</code>.
     In addition,
     for <code>c = 0 , ... , CPPAD_MAX_NUM_CAPACITY-1</code>
-    <code>info->root_inuse_[c].next_ == nullptr</code> and
-    <code>info->root_available_[c].next_ == nullptr</code>.
+    <code>info->root_inuse_[c].next_ == nullptr</code>,
+    <code>info->root_available_[c].next_ == nullptr</code>,
+    <code>info->num_inuse_[c] == 0</code>, and
+    <code>info->num_available_[c] == 0</code>.
+    The remote free list <code>info->remote_free_</code> is empty.
     */
     static thread_alloc_info* thread_info(
         size_t             thread          ,
@@ -205,7 +355,8 @@ private:
 # ifndef NDEBUG
                 CPPAD_ASSERT_UNKNOWN(
                     info->count_inuse_     == 0 &&
-                    info->count_available_ == 0
+                    info->count_available_ == 0 &&
+                    info->remote_free_.load() == nullptr
                 );
                 for(size_t c = 0; c < CPPAD_MAX_NUM_CAPACITY; c++)
                 {   CPPAD_ASSERT_UNKNOWN(
@@ -226,7 +377,7 @@ private:
             else
             {   size_t size = sizeof(thread_alloc_info);
                 void* v_ptr = ::operator new(size);
-                info        = reinterpret_cast<thread_alloc_info*>(v_ptr);
+                info        = new(v_ptr) thread_alloc_info;
             }
             all_info[thread] = info;
 
@@ -234,9 +385,12 @@ private:
             for(size_t c = 0; c < CPPAD_MAX_NUM_CAPACITY; c++)
             {   info->root_inuse_[c].next_       = nullptr;
                 info->root_available_[c].next_   = nullptr;
+                info->num_inuse_[c]              = 0;
+                info->num_available_[c]          = 0;
             }
             info->count_inuse_     = 0;
             info->count_available_ = 0;
+            info->remote_free_.store(nullptr);
         }
         return info;
     }
@@ -334,6 +488,106 @@ private:
         CPPAD_ASSERT_UNKNOWN( info->count_available_ >= dec );
         info->count_available_ =  info->count_available_ - dec;
     }
+    // -----------------------------------------------------------------------
+    /*!
+    Move a block that is in use to the available list for its thread
+    (or return it to the system if hold_memory is false).
+
+    \param node [in]
+    is the block_t at the beginning of the memory that is in use.
+    The thread that allocated this memory must be the thread that is
+    currently executing, or we must be in sequential execution mode.
+    */
+    static void return_node(block_t* node)
+    {   size_t num_cap   = capacity_info()->number;
+        size_t tc_index  = node->tc_index_ & ~ mmap_bit();
+        size_t thread    = tc_index / num_cap;
+        size_t c_index   = tc_index % num_cap;
+        size_t capacity  = capacity_info()->value[c_index];
+
+        CPPAD_ASSERT_UNKNOWN( thread < CPPAD_MAX_NUM_THREADS );
+        CPPAD_ASSERT_UNKNOWN( thread == thread_num() || (! in_parallel()) );
+
+        thread_alloc_info* info = thread_info(thread);
+# ifndef NDEBUG
+        void*  v_ptr     = reinterpret_cast<void*>(node + 1);
+# if ! CPPAD_DEBUG_AND_RELEASE
+        // remove node from inuse list
+        void* v_node         = reinterpret_cast<void*>(node);
+        block_t* inuse_root  = info->root_inuse_ + c_index;
+        block_t* previous    = inuse_root;
+        while( (previous->next_ != nullptr) && (previous->next_ != v_node) )
+            previous = reinterpret_cast<block_t*>(previous->next_);
+
+        // check that v_ptr is valid
+        if( previous->next_ != v_node )
+        {   using std::endl;
+            std::ostringstream oss;
+            oss << "return_memory: attempt to return memory not in use";
+            oss << endl;
+            oss << "v_ptr    = " << v_ptr    << endl;
+            oss << "thread   = " << thread   << endl;
+            oss << "capacity = " << capacity << endl;
+            oss << "See CPPAD_TRACE_THREAD & CPPAD_TRACE_CAPACITY in";
+            oss << endl << "# include <cppad/utility/thread_alloc.hpp>" << endl;
+            // oss.str() returns a string object with a copy of the current
+            // contents in the stream buffer.
+            std::string msg_str       = oss.str();
+            // msg_str.c_str() returns a pointer to the c-string
+            // representation of the string object's value.
+            const char* msg_char_star = msg_str.c_str();
+            CPPAD_ASSERT_KNOWN(false, msg_char_star );
+        }
+        // remove v_ptr from inuse list
+        previous->next_  = node->next_;
+# endif
+        // trace option
+        if( capacity==CPPAD_TRACE_CAPACITY && thread==CPPAD_TRACE_THREAD )
+        {   std::cout << "return_memory: v_ptr = " << v_ptr << std::endl; }
+
+# endif
+        // capacity bytes are removed from the inuse pool
+        dec_inuse(capacity, thread);
+        CPPAD_ASSERT_UNKNOWN( info->num_inuse_[c_index] > 0 );
+        --info->num_inuse_[c_index];
+
+        // check for case where we just return the memory to the system
+        if( ! set_get_hold_memory(false) )
+        {   system_delete( reinterpret_cast<void*>(node), capacity );
+            return;
+        }
+
+        // add this node to available list for this thread and capacity
+        block_t* available_root = info->root_available_ + c_index;
+        node->next_             = available_root->next_;
+        available_root->next_   = reinterpret_cast<void*>(node);
+
+        // capacity bytes are added to the available pool
+        inc_available(capacity, thread);
+        ++info->num_available_[c_index];
+    }
+    // -----------------------------------------------------------------------
+    /*!
+    Return the blocks that other threads have returned for this thread.
+
+    \param info [in]
+    is the information record for this thread.
+    This thread must be the thread that is currently executing,
+    or we must be in sequential execution mode.
+    */
+    static void drain_remote(thread_alloc_info* info)
+    {   // check without a read-modify-write for the usual case
+        if( info->remote_free_.load(std::memory_order_relaxed) == nullptr )
+            return;
+        void* v_node = info->remote_free_.exchange(
+            nullptr, std::memory_order_acquire
+        );
+        while( v_node != nullptr )
+        {   block_t* node = reinterpret_cast<block_t*>(v_node);
+            v_node        = *reinterpret_cast<void**>(node + 1);
+            return_node(node);
+        }
+    }
 
     // ----------------------------------------------------------------------
     /*!
@@ -765,12 +1019,11 @@ Example
         using std::endl;
 
         // determine the capacity for this request
-        size_t c_index   = 0;
         const size_t* capacity_vec = capacity_info()->value;
-        while( capacity_vec[c_index] < min_bytes )
-        {   ++c_index;
-            CPPAD_ASSERT_UNKNOWN(c_index < num_cap );
-        }
+        size_t c_index = size_t( std::lower_bound(
+            capacity_vec, capacity_vec + num_cap, min_bytes
+        ) - capacity_vec );
+        CPPAD_ASSERT_UNKNOWN(c_index < num_cap );
         cap_bytes = capacity_vec[c_index];
 
         // determine the thread, capacity, and info for this thread
@@ -778,6 +1031,9 @@ Example
         size_t tc_index          = thread * num_cap + c_index;
         thread_alloc_info* info  = thread_info(thread);
 
+        // memory returned by other threads can be used now
+        drain_remote(info);
+
 # ifndef NDEBUG
         // trace allocation
         static bool first_trace = true;
@@ -802,7 +1058,9 @@ Example
         void* v_node              = available_root->next_;
         block_t* node             = reinterpret_cast<block_t*>(v_node);
         if( node != nullptr )
-        {   CPPAD_ASSERT_UNKNOWN( node->tc_index_ == tc_index );
+        {   CPPAD_ASSERT_UNKNOWN(
+                (node->tc_index_ & ~ mmap_bit()) == tc_index
+            );
 
             // remove node from available list
             available_root->next_ = node->next_;
@@ -825,6 +1083,8 @@ Example
             // adjust counts
             inc_inuse(cap_bytes, thread);
             dec_available(cap_bytes, thread);
+            ++info->num_inuse_[c_index];
+            --info->num_available_[c_index];
 
 # ifndef NDEBUG
             // check that pointers and doubles are aligned
@@ -839,10 +1099,9 @@ Example
         // Create a new node with thread_alloc information at front.
         // This uses the system allocator, which is thread safe, but slower,
         // because the thread might wait for a lock on the allocator.
-        v_node          = ::operator new(sizeof(block_t) + cap_bytes);
+        v_node          = system_new(cap_bytes, tc_index);
         CPPAD_ASSERT_UNKNOWN( v_node != nullptr );
         node            = reinterpret_cast<block_t*>(v_node);
-        node->tc_index_ = tc_index;
         void* v_ptr     = reinterpret_cast<void*>(node + 1);
 
 # ifndef NDEBUG
@@ -860,6 +1119,7 @@ Example
 
         // adjust counts
         inc_inuse(cap_bytes, thread);
+        ++info->num_inuse_[c_index];
 
         return v_ptr;
     }
@@ -894,16 +1154,32 @@ obtained by a previous call to
 
 Thread
 ******
-Either the :ref:`current thread<ta_thread_num-name>` must be the same as during
+If the :ref:`current thread<ta_thread_num-name>` is the same as during
 the corresponding call to :ref:`get_memory<ta_get_memory-name>` ,
-or the current execution mode must be sequential
-(not :ref:`parallel<ta_in_parallel-name>` ).
+or the current execution mode is sequential
+(not :ref:`parallel<ta_in_parallel-name>` ),
+the memory is returned immediately.
+
+Other Thread
+============
+If the execution mode is parallel and the current thread is not the
+thread that allocated the memory, the memory is put in a lock free list
+for the thread that allocated it.
+It remains :ref:`inuse<ta_inuse-name>` for that thread until that
+thread calls ``get_memory`` , ``inuse`` , ``available`` , or
+``free_available`` (or one of these is called in sequential mode).
+This supports the case where memory is allocated by one thread and
+freed by another; e.g., a tape recorded by one thread and the corresponding
+``ADFun`` object destroyed by another.
 
 NDEBUG
 ******
 If ``NDEBUG`` is defined, *v_ptr* is not checked (this is faster).
 Otherwise, a list of in use pointers is searched to make sure
 that *v_ptr* is in the list.
+If *v_ptr* is returned by a different thread during parallel mode,
+this check is done when the thread that allocated it
+processes its list of returned memory.
 
 Example
 *******
@@ -923,79 +1199,33 @@ Example
     After this call, this pointer will available (and not in use).
 
     \par
-    We must either be in sequential (not parallel) execution mode,
-    or the current thread must be the same as for the corresponding call
-    to get_memory.
+    If we are in parallel execution mode and the current thread is not the
+    same as for the corresponding call to get_memory, the memory is put in
+    the remote free list for the thread that allocated it.
     */
     static void return_memory(void* v_ptr)
     {   size_t num_cap   = capacity_info()->number;
 
         block_t* node    = reinterpret_cast<block_t*>(v_ptr) - 1;
-        size_t tc_index  = node->tc_index_;
+        size_t tc_index  = node->tc_index_ & ~ mmap_bit();
         size_t thread    = tc_index / num_cap;
-        size_t c_index   = tc_index % num_cap;
-        size_t capacity  = capacity_info()->value[c_index];
 
         CPPAD_ASSERT_UNKNOWN( thread < CPPAD_MAX_NUM_THREADS );
-        CPPAD_ASSERT_KNOWN(
-            thread == thread_num() || (! in_parallel()),
-            "Attempt to return memory for a different thread "
-            "while in parallel mode"
-        );
-
-        thread_alloc_info* info = thread_info(thread);
-# ifndef NDEBUG
-# if ! CPPAD_DEBUG_AND_RELEASE
-        // remove node from inuse list
-        void* v_node         = reinterpret_cast<void*>(node);
-        block_t* inuse_root  = info->root_inuse_ + c_index;
-        block_t* previous    = inuse_root;
-        while( (previous->next_ != nullptr) && (previous->next_ != v_node) )
-            previous = reinterpret_cast<block_t*>(previous->next_);
-
-        // check that v_ptr is valid
-        if( previous->next_ != v_node )
-        {   using std::endl;
-            std::ostringstream oss;
-            oss << "return_memory: attempt to return memory not in use";
-            oss << endl;
-            oss << "v_ptr    = " << v_ptr    << endl;
-            oss << "thread   = " << thread   << endl;
-            oss << "capacity = " << capacity << endl;
-            oss << "See CPPAD_TRACE_THREAD & CPPAD_TRACE_CAPACITY in";
-            oss << endl << "# include <cppad/utility/thread_alloc.hpp>" << endl;
-            // oss.str() returns a string object with a copy of the current
-            // contents in the stream buffer.
-            std::string msg_str       = oss.str();
-            // msg_str.c_str() returns a pointer to the c-string
-            // representation of the string object's value.
-            const char* msg_char_star = msg_str.c_str();
-            CPPAD_ASSERT_KNOWN(false, msg_char_star );
-        }
-        // remove v_ptr from inuse list
-        previous->next_  = node->next_;
-# endif
-        // trace option
-        if( capacity==CPPAD_TRACE_CAPACITY && thread==CPPAD_TRACE_THREAD )
-        {   std::cout << "return_memory: v_ptr = " << v_ptr << std::endl; }
-
-# endif
-        // capacity bytes are removed from the inuse pool
-        dec_inuse(capacity, thread);
-
-        // check for case where we just return the memory to the system
-        if( ! set_get_hold_memory(false) )
-        {   ::operator delete( reinterpret_cast<void*>(node) );
+        if( in_parallel() && thread != thread_num() )
+        {   // Push this block onto the remote free list for the thread
+            // that allocated it. That thread will make it available.
+            thread_alloc_info* info = thread_info(thread);
+            void*  v_node = reinterpret_cast<void*>(node);
+            void** link   = reinterpret_cast<void**>(v_ptr);
+            *link         = info->remote_free_.load(std::memory_order_relaxed);
+            while( ! info->remote_free_.compare_exchange_weak(
+                *link, v_node,
+                std::memory_order_release, std::memory_order_relaxed
+            ) )
+            { }
             return;
         }
-
-        // add this node to available list for this thread and capacity
-        block_t* available_root = info->root_available_ + c_index;
-        node->next_             = available_root->next_;
-        available_root->next_   = reinterpret_cast<void*>(node);
-
-        // capacity bytes are added to the available pool
-        inc_available(capacity, thread);
+        return_node(node);
     }
 /* -----------------------------------------------------------------------
 {xrst_begin ta_free_available}
@@ -1066,6 +1296,7 @@ Example
         const size_t*     capacity_vec  = capacity_info()->value;
         size_t c_index;
         thread_alloc_info* info = thread_info(thread);
+        drain_remote(info);
         for(c_index = 0; c_index < num_cap; c_index++)
         {   size_t capacity = capacity_vec[c_index];
             block_t* available_root = info->root_available_ + c_index;
@@ -1073,12 +1304,13 @@ Example
             while( v_ptr != nullptr )
             {   block_t* node = reinterpret_cast<block_t*>(v_ptr);
                 void* next    = node->next_;
-                ::operator delete(v_ptr);
+                system_delete(v_ptr, capacity);
                 v_ptr         = next;
 
                 dec_available(capacity, thread);
             }
-            available_root->next_ = nullptr;
+            available_root->next_         = nullptr;
+            info->num_available_[c_index] = 0;
         }
         CPPAD_ASSERT_UNKNOWN( available(thread) == 0 );
         if( inuse(thread) == 0 )
@@ -1131,6 +1363,94 @@ to the system using :ref:`free_available<ta_free_available-name>` .
     {   bool set = true;
         set_get_hold_memory(set, value);
     }
+/* -----------------------------------------------------------------------
+{xrst_begin ta_mmap_bytes}
+{xrst_spell
+    madvise
+    mmap
+}
+
+Allocate Large Blocks of Memory Directly From The Operating System
+##################################################################
+
+Syntax
+******
+``thread_alloc::mmap_bytes`` ( *min_bytes* )
+
+Purpose
+*******
+Large arrays, for example the Taylor coefficients for a function
+with a large number of variables, can cause a large number of
+translation look aside buffer misses and page faults.
+Calling ``mmap_bytes`` with *min_bytes* not equal to zero
+instructs ``thread_alloc`` to obtain blocks with capacity
+greater than or equal *min_bytes* directly from the operating system
+using an anonymous ``mmap`` .
+In addition, if the system supports transparent huge pages,
+``madvise`` is used to request huge pages for these blocks.
+The memory for these blocks is returned to the operating system using
+``munmap`` ; e.g., by :ref:`free_available<ta_free_available-name>`
+or by :ref:`return_memory<ta_return_memory-name>` when
+:ref:`hold_memory<ta_hold_memory-name>` is false.
+
+min_bytes
+*********
+This argument has prototype
+
+    ``size_t`` *min_bytes*
+
+If it is zero, ``mmap`` is not used (this is the default).
+Otherwise, it is the minimum capacity, in bytes,
+for a block that is allocated using ``mmap`` .
+A value of two or more megabytes is suggested
+because that is a common size for a huge page.
+
+CPPAD_HAS_MMAP
+**************
+If ``mmap`` is not supported on this system
+(as determined by the :ref:`cmake-name` command),
+this routine has no effect.
+
+Restrictions
+************
+This routine cannot be called while in
+:ref:`parallel<ta_in_parallel-name>` execution mode.
+
+Changing min_bytes
+******************
+Each block records if it was allocated using ``mmap`` .
+Blocks that are in use, or available, when *min_bytes* changes
+are returned to the operating system using the method that allocated them.
+Available blocks are reused for the same capacity
+(without checking if they would use ``mmap`` with the new setting).
+
+{xrst_toc_hidden
+    speed/example/mmap_speed.cpp
+}
+Example
+*******
+The speed test ``mmap`` :ref:`option<speed_main@Global Options@mmap>`
+uses this routine.
+The program :ref:`mmap_speed.cpp-name` compares the speed of
+a tape that is larger than the last level cache
+with and without this option.
+
+{xrst_end ta_mmap_bytes}
+*/
+    /*!
+    Change the minimum capacity that is allocated using mmap.
+
+    \param min_bytes [in]
+    New value for the minimum capacity (zero means mmap is not used).
+    */
+    static void mmap_bytes(size_t min_bytes)
+    {   CPPAD_ASSERT_KNOWN(
+            ! in_parallel(),
+            "mmap_bytes cannot be used while in parallel execution"
+        );
+        bool set = true;
+        set_get_mmap_bytes(set, min_bytes);
+    }
 
 /* -----------------------------------------------------------------------
 {xrst_begin ta_inuse}
@@ -1192,6 +1512,7 @@ Example
             thread == thread_num() || (! in_parallel())
         );
         thread_alloc_info* info = thread_info(thread);
+        drain_remote(info);
         return info->count_inuse_;
     }
 /* -----------------------------------------------------------------------
@@ -1247,9 +1568,169 @@ Example
             thread == thread_num() || (! in_parallel())
         );
         thread_alloc_info* info = thread_info(thread);
+        drain_remote(info);
         return info->count_available_;
     }
 /* -----------------------------------------------------------------------
+{xrst_begin ta_block_count}
+{xrst_spell
+    inuse
+}
+
+Number of Memory Blocks for Each Capacity
+#########################################
+
+Syntax
+******
+| ``thread_alloc::block_count`` (
+| |tab| *thread* , *capacity* , *num_inuse* , *num_available*
+| )
+
+Purpose
+*******
+Memory being managed by :ref:`thread_alloc-name` is allocated in blocks
+that have one of a fixed set of capacities.
+This function reports, for each capacity, the number of blocks
+that are in use and available for the specified thread.
+This can be used to see how much memory is wasted by rounding
+requests up to the next capacity.
+
+SizeVector
+**********
+The type *SizeVector* must be a :ref:`SimpleVector-name` with elements
+of type ``size_t`` .
+
+thread
+******
+This argument has prototype
+
+    ``size_t`` *thread*
+
+Either :ref:`thread_num<ta_thread_num-name>` must be the same as *thread* ,
+or the current execution mode must be sequential
+(not :ref:`parallel<ta_in_parallel-name>` ).
+
+capacity
+********
+This argument has prototype
+
+    *SizeVector* & *capacity*
+
+Its input size and elements do not matter.
+Upon return, its elements are the capacities, in bytes and increasing order,
+that have a block in use or available for the specified thread.
+We use *n* for the size of *capacity* upon return.
+
+num_inuse
+*********
+This argument has prototype
+
+    *SizeVector* & *num_inuse*
+
+Its input size and elements do not matter.
+Upon return, its size is *n* and
+*num_inuse* [ *k* ] is the number of blocks with capacity
+*capacity* [ *k* ] that are currently :ref:`inuse<ta_inuse-name>`
+by the specified thread.
+
+num_available
+*************
+This argument has prototype
+
+    *SizeVector* & *num_available*
+
+Its input size and elements do not matter.
+Upon return, its size is *n* and
+*num_available* [ *k* ] is the number of blocks with capacity
+*capacity* [ *k* ] that are currently
+:ref:`available<ta_available-name>` for the specified thread.
+
+Sum
+***
+The sum with respect to *k* of
+*capacity* [ *k* ] * *num_inuse* [ *k* ] is equal to
+``thread_alloc::inuse`` ( *thread* ) .
+The sum with respect to *k* of
+*capacity* [ *k* ] * *num_available* [ *k* ] is equal to
+``thread_alloc::available`` ( *thread* ) .
+
+CPPAD_FINE_CAPACITY_BYTES
+*************************
+If this preprocessor symbol is zero (its default value),
+each capacity is about 3/2 times the previous capacity.
+Otherwise, starting with the capacity that would be greater than or equal
+``CPPAD_FINE_CAPACITY_BYTES`` ,
+each capacity is about 9/8 times the previous capacity.
+This reduces the memory wasted for large blocks,
+at the expense of less reuse of available blocks.
+The user may define this symbol before including any of the CppAD files.
+It must have the same value in all the files that are linked together.
+
+Example
+*******
+:ref:`thread_alloc.cpp-name`
+
+{xrst_end ta_block_count}
+*/
+    /*!
+    Determine the number of blocks in use and available for each capacity.
+
+    \tparam SizeVector
+    is a simple vector with elements of type size_t.
+
+    \param thread [in]
+    Thread for which we are determining the number of blocks.
+    During parallel execution, this must be the thread
+    that is currently executing.
+
+    \param capacity [out]
+    the capacities that have a non-zero number of blocks.
+
+    \param num_inuse [out]
+    the number of blocks in use for each capacity.
+
+    \param num_available [out]
+    the number of blocks available for each capacity.
+    */
+    template <class SizeVector>
+    static void block_count(
+        size_t      thread        ,
+        SizeVector& capacity      ,
+        SizeVector& num_inuse     ,
+        SizeVector& num_available )
+    {
+        CPPAD_ASSERT_UNKNOWN( thread < CPPAD_MAX_NUM_THREADS);
+        CPPAD_ASSERT_UNKNOWN(
+            thread == thread_num() || (! in_parallel())
+        );
+        size_t num_cap             = capacity_info()->number;
+        const size_t* capacity_vec = capacity_info()->value;
+        thread_alloc_info* info    = thread_info(thread);
+        drain_remote(info);
+        //
+        size_t n = 0;
+        for(size_t c_index = 0; c_index < num_cap; ++c_index)
+        {   size_t count = info->num_inuse_[c_index];
+            count       += info->num_available_[c_index];
+            if( count != 0 )
+                ++n;
+        }
+        capacity.resize(n);
+        num_inuse.resize(n);
+        num_available.resize(n);
+        size_t k = 0;
+        for(size_t c_index = 0; c_index < num_cap; ++c_index)
+        {   size_t count = info->num_inuse_[c_index];
+            count       += info->num_available_[c_index];
+            if( count != 0 )
+            {   capacity[k]      = capacity_vec[c_index];
+                num_inuse[k]     = info->num_inuse_[c_index];
+                num_available[k] = info->num_available_[c_index];
+                ++k;
+            }
+        }
+    }
+/* -----------------------------------------------------------------------
 {xrst_begin ta_create_array}
 
 Allocate An Array and Call Default Constructor for its Elements
@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin adolc_stencil.cpp}
+
+Adolc Speed: Sparse Jacobian of a Two Dimensional Stencil Residual
+##################################################################
+
+Specifications
+**************
+:ref:`link_stencil-name`
+
+Implementation
+**************
+// a adolc version of this test is not yet implemented
+{xrst_spell_off}
+{xrst_code cpp} */
+# include <map>
+# include <cppad/utility/vector.hpp>
+
+// list of possible options
+extern std::map<std::string, bool> global_option;
+
+bool link_stencil(
+    const std::string&         job      ,
+    size_t                     size     ,
+    size_t                     repeat   ,
+    CppAD::vector<double>     &x        ,
+    CppAD::vector<double>     &jacobian )
+{  return false; }
+/* {xrst_code}
+{xrst_spell_on}
+
+{xrst_end adolc_stencil.cpp}
+*/
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-23 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin cppad_det_minor.cpp}
@@ -25,6 +25,8 @@ Implementation
 extern std::map<std::string, bool> global_option;
 // see comments in main program for this external
 extern size_t global_cppad_thread_alloc_inuse;
+extern size_t global_cppad_tape_size;
+extern double global_cppad_optimize_seconds;
 
 namespace {
     // typedefs
@@ -71,7 +73,11 @@ namespace {
         if( global_option["val_graph"] )
             optimize_options += " val_graph";
         if( global_option["optimize"] )
+        {  double start = CppAD::elapsed_seconds();
             f.optimize(optimize_options);
+            global_cppad_optimize_seconds = CppAD::elapsed_seconds() - start;
+        }
+        global_cppad_tape_size = f.size_var();
     }
 
 }
@@ -86,7 +92,9 @@ bool link_det_minor(
 
     // --------------------------------------------------------------------
     // check global options
-    const char* valid[] = { "memory", "onetape", "optimize", "val_graph"};
+    const char* valid[] = {
+        "memory", "mmap", "onetape", "optimize", "val_graph"
+    };
     size_t n_valid = sizeof(valid) / sizeof(valid[0]);
     typedef std::map<std::string, bool>::iterator iterator;
     //
@@ -118,7 +126,11 @@ bool link_det_minor(
     bool onetape = global_option["onetape"];
     // -----------------------------------------------------------------------
     if( job == "setup" )
-    {  if( onetape )
+    {  // values for the tape used by onetape (set by run otherwise)
+        global_cppad_tape_size        = 0;
+        global_cppad_optimize_seconds = 0.0;
+        //
+        if( onetape )
         {  setup(size, static_f);
             static_size = size;
         }
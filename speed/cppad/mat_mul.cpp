@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-23 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin cppad_mat_mul.cpp}
@@ -27,6 +27,8 @@ Implementation
 extern std::map<std::string, bool> global_option;
 // see comments in main program for this external
 extern size_t global_cppad_thread_alloc_inuse;
+extern size_t global_cppad_tape_size;
+extern double global_cppad_optimize_seconds;
 
 bool link_mat_mul(
     size_t                           size     ,
@@ -36,11 +38,13 @@ bool link_mat_mul(
     CppAD::vector<double>&           dz
 )
 {  global_cppad_thread_alloc_inuse = 0;
+    global_cppad_tape_size          = 0;
+    global_cppad_optimize_seconds   = 0.0;
 
     // --------------------------------------------------------------------
     // check global options
     const char* valid[] = {
-        "memory", "onetape", "optimize", "atomic", "val_graph"
+        "memory", "mmap", "onetape", "optimize", "atomic", "val_graph"
     };
     size_t n_valid = sizeof(valid) / sizeof(valid[0]);
     typedef std::map<std::string, bool>::iterator iterator;
@@ -114,7 +118,11 @@ bool link_mat_mul(
         f.Dependent(X, Z);
 
         if( global_option["optimize"] )
+        {  double start = CppAD::elapsed_seconds();
             f.optimize(optimize_options);
+            global_cppad_optimize_seconds = CppAD::elapsed_seconds() - start;
+        }
+        global_cppad_tape_size = f.size_var();
 
         // skip comparison operators
         f.compare_change_count(0);
@@ -151,7 +159,11 @@ bool link_mat_mul(
         f.Dependent(X, Z);
 
         if( global_option["optimize"] )
+        {  double start = CppAD::elapsed_seconds();
             f.optimize(optimize_options);
+            global_cppad_optimize_seconds = CppAD::elapsed_seconds() - start;
+        }
+        global_cppad_tape_size = f.size_var();
 
         // skip comparison operators
         f.compare_change_count(0);
@@ -0,0 +1,172 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin cppad_mlp.cpp}
+{xrst_spell
+    perceptron
+}
+Cppad Speed: Gradient of a Multilayer Perceptron Loss
+#####################################################
+
+Specifications
+**************
+See :ref:`link_mlp-name` .
+
+Implementation
+**************
+{xrst_spell_off}
+{xrst_code cpp} */
+# include <cppad/cppad.hpp>
+# include <cppad/speed/uniform_01.hpp>
+# include "mlp_loss.hpp"
+
+// Note that CppAD uses global_option["memory"] at the main program level
+# include <map>
+extern std::map<std::string, bool> global_option;
+// see comments in main program for this external
+extern size_t global_cppad_thread_alloc_inuse;
+extern size_t global_cppad_tape_size;
+extern double global_cppad_optimize_seconds;
+
+namespace {
+    // typedefs
+    typedef CppAD::AD<double>       a_double;
+    typedef CppAD::vector<a_double> a_vector;
+    //
+    // setup
+    void setup(
+        // inputs
+        size_t size             ,
+        // outputs
+        CppAD::ADFun<double>& f )
+    {
+        // number of independent variables
+        size_t nx = mlp_n_weight(size);
+        //
+        // choose an argument value
+        CppAD::vector<double> x(nx);
+        CppAD::uniform_01(nx, x);
+        //
+        // copy to independent variables
+        a_vector   ax(nx);
+        for(size_t j = 0; j < nx; ++j)
+            ax[j] = x[j];
+        //
+        // declare independent variables for function computation
+        bool record_compare   = false;
+        size_t abort_op_index = 0;
+        CppAD::Independent(ax, abort_op_index, record_compare);
+        //
+        // AD computation of the function value
+        a_vector ay(1);
+        mlp_loss<a_double>(size, ax, ay);
+        //
+        // f : x -> y
+        f.Dependent(ax, ay);
+        //
+        // optimize
+        std::string optimize_options =
+        "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+        if( global_option["val_graph"] )
+            optimize_options += " val_graph";
+        if( global_option["optimize"] )
+        {  double start = CppAD::elapsed_seconds();
+            f.optimize(optimize_options);
+            global_cppad_optimize_seconds = CppAD::elapsed_seconds() - start;
+        }
+        global_cppad_tape_size = f.size_var();
+    }
+
+}
+
+bool link_mlp(
+    const std::string&         job      ,
+    size_t                     size     ,
+    size_t                     repeat   ,
+    CppAD::vector<double>     &x        ,
+    CppAD::vector<double>     &gradient )
+{  global_cppad_thread_alloc_inuse = 0;
+
+    // --------------------------------------------------------------------
+    // check global options
+    const char* valid[] = {
+        "memory", "mmap", "onetape", "optimize", "val_graph"
+    };
+    size_t n_valid = sizeof(valid) / sizeof(valid[0]);
+    typedef std::map<std::string, bool>::iterator iterator;
+    //
+    for(iterator itr=global_option.begin(); itr!=global_option.end(); ++itr)
+    {  if( itr->second )
+        {  bool ok = false;
+            for(size_t i = 0; i < n_valid; i++)
+                ok |= itr->first == valid[i];
+            if( ! ok )
+                return false;
+        }
+    }
+    // ---------------------------------------------------------------------
+    //
+    // AD function mapping x to mlp_loss value
+    static CppAD::ADFun<double> static_f;
+    //
+    // size corresponding to static_f
+    static size_t static_size = 0;
+    //
+    // number of independent variables
+    size_t nx = mlp_n_weight(size);
+    //
+    // vectors of reverse mode weights
+    CppAD::vector<double> w(1);
+    w[0] = 1.;
+    //
+    // onetape
+    bool onetape = global_option["onetape"];
+    // -----------------------------------------------------------------------
+    if( job == "setup" )
+    {  // values for the tape used by onetape (set by run otherwise)
+        global_cppad_tape_size        = 0;
+        global_cppad_optimize_seconds = 0.0;
+        //
+        if( onetape )
+        {  setup(size, static_f);
+            static_size = size;
+        }
+        else
+        {  static_size = 0;
+        }
+        return true;
+    }
+    if( job ==  "teardown" )
+    {  static_f = CppAD::ADFun<double>();
+        return true;
+    }
+    // -----------------------------------------------------------------------
+    CPPAD_ASSERT_UNKNOWN( job == "run" );
+    while(repeat--)
+    {  if( onetape )
+        {  // use if before assert to avoid warning
+            if( size != static_size )
+            {  CPPAD_ASSERT_UNKNOWN( size == static_size );
+            }
+        }
+        else
+        {  setup(size, static_f);
+        }
+        // get next argument value
+        CppAD::uniform_01(nx, x);
+
+        // evaluate the gradient
+        static_f.Forward(0, x);
+        gradient = static_f.Reverse(1, w);
+    }
+    size_t thread                   = CppAD::thread_alloc::thread_num();
+    global_cppad_thread_alloc_inuse = CppAD::thread_alloc::inuse(thread);
+    return true;
+}
+/* {xrst_code}
+{xrst_spell_on}
+
+{xrst_end cppad_mlp.cpp}
+*/
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-23 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin cppad_ode.cpp}
@@ -27,6 +27,8 @@ Implementation
 extern std::map<std::string, bool> global_option;
 // see comments in main program for this external
 extern size_t global_cppad_thread_alloc_inuse;
+extern size_t global_cppad_tape_size;
+extern double global_cppad_optimize_seconds;
 
 bool link_ode(
     size_t                     size       ,
@@ -35,10 +37,14 @@ bool link_ode(
     CppAD::vector<double>      &jacobian
 )
 {  global_cppad_thread_alloc_inuse = 0;
+    global_cppad_tape_size          = 0;
+    global_cppad_optimize_seconds   = 0.0;
 
     // --------------------------------------------------------------------
     // check global options
-    const char* valid[] = { "memory", "onetape", "optimize", "val_graph"};
+    const char* valid[] = {
+        "memory", "mmap", "onetape", "optimize", "val_graph"
+    };
     size_t n_valid = sizeof(valid) / sizeof(valid[0]);
     typedef std::map<std::string, bool>::iterator iterator;
     //
@@ -93,7 +99,11 @@ bool link_ode(
         f.Dependent(X, Y);
 
         if( global_option["optimize"] )
+        {  double start = CppAD::elapsed_seconds();
             f.optimize(optimize_options);
+            global_cppad_optimize_seconds = CppAD::elapsed_seconds() - start;
+        }
+        global_cppad_tape_size = f.size_var();
 
         // skip comparison operators
         f.compare_change_count(0);
@@ -116,7 +126,11 @@ bool link_ode(
         f.Dependent(X, Y);
 
         if( global_option["optimize"] )
+        {  double start = CppAD::elapsed_seconds();
             f.optimize(optimize_options);
+            global_cppad_optimize_seconds = CppAD::elapsed_seconds() - start;
+        }
+        global_cppad_tape_size = f.size_var();
 
         // skip comparison operators
         f.compare_change_count(0);
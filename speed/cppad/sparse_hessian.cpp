@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-23 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin cppad_sparse_hessian.cpp}
@@ -26,6 +26,8 @@ Implementation
 extern std::map<std::string, bool> global_option;
 // see comments in main program for this external
 extern size_t global_cppad_thread_alloc_inuse;
+extern size_t global_cppad_tape_size;
+extern double global_cppad_optimize_seconds;
 
 namespace {
     // typedefs
@@ -78,7 +80,12 @@ namespace {
             fun.Dependent(a1x, a1y);
             //
             if( global_option["optimize"] )
+            {  double start = CppAD::elapsed_seconds();
                 fun.optimize(optimize_options);
+                global_cppad_optimize_seconds =
+                    CppAD::elapsed_seconds() - start;
+            }
+            global_cppad_tape_size = fun.size_var();
             //
             // skip comparison operators
             fun.compare_change_count(0);
@@ -113,7 +120,11 @@ namespace {
         fun.Dependent(a1x, a1z);
         //
         if( global_option["optimize"] )
+        {  double start = CppAD::elapsed_seconds();
             fun.optimize(optimize_options);
+            global_cppad_optimize_seconds = CppAD::elapsed_seconds() - start;
+        }
+        global_cppad_tape_size = fun.size_var();
         //
         // skip comparison operators
         fun.compare_change_count(0);
@@ -274,11 +285,13 @@ bool link_sparse_hessian(
     CppAD::vector<double>&           hessian  ,
     size_t&                          n_color  )
 {  global_cppad_thread_alloc_inuse = 0;
+    global_cppad_tape_size          = 0;
+    global_cppad_optimize_seconds   = 0.0;
 
     // --------------------------------------------------------------------
     // check global options
     const char* valid[] = {
-        "memory", "onetape", "optimize", "hes2jac", "subgraph",
+        "memory", "mmap", "onetape", "optimize", "hes2jac", "subgraph",
         "boolsparsity", "revsparsity", "symmetric", "val_graph"
 # if CPPAD_HAS_COLPACK
         , "colpack"
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-23 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 {xrst_begin cppad_sparse_jacobian.cpp}
@@ -26,6 +26,8 @@ Implementation
 extern std::map<std::string, bool> global_option;
 // see comments in main program for this external
 extern size_t global_cppad_thread_alloc_inuse;
+extern size_t global_cppad_tape_size;
+extern double global_cppad_optimize_seconds;
 
 namespace {
     using CppAD::vector;
@@ -127,7 +129,11 @@ namespace {
         f.Dependent(a_x, a_y);
         //
         if( global_option["optimize"] )
+        {  double start = CppAD::elapsed_seconds();
             f.optimize(optimize_options);
+            global_cppad_optimize_seconds = CppAD::elapsed_seconds() - start;
+        }
+        global_cppad_tape_size = f.size_var();
         //
         // coloring method
         std::string coloring = "cppad";
@@ -187,7 +193,7 @@ bool link_sparse_jacobian(
     // --------------------------------------------------------------------
     // check global options
     const char* valid[] = {
-        "memory", "onetape", "optimize", "subgraph",
+        "memory", "mmap", "onetape", "optimize", "subgraph",
         "boolsparsity", "revsparsity", "subsparsity", "val_graph"
 # if CPPAD_HAS_COLPACK
         , "colpack"
@@ -234,7 +240,11 @@ bool link_sparse_jacobian(
     bool onetape = global_option["onetape"];
     //
     if( job == "setup" )
-    {  if( onetape )
+    {  // values for the tape used by onetape (set by run otherwise)
+        global_cppad_tape_size        = 0;
+        global_cppad_optimize_seconds = 0.0;
+        //
+        if( onetape )
         {  setup(size, m, row, col,
                 n_color, static_f, static_subset, static_work
             );
@@ -0,0 +1,223 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin cppad_stencil.cpp}
+
+Cppad Speed: Sparse Jacobian of a Two Dimensional Stencil Residual
+##################################################################
+
+Specifications
+**************
+See :ref:`link_stencil-name` .
+
+Implementation
+**************
+{xrst_spell_off}
+{xrst_code cpp} */
+# include <cppad/cppad.hpp>
+# include <cppad/speed/uniform_01.hpp>
+# include "stencil_residual.hpp"
+
+// Note that CppAD uses global_option["memory"] at the main program level
+# include <map>
+extern std::map<std::string, bool> global_option;
+// see comments in main program for this external
+extern size_t global_cppad_thread_alloc_inuse;
+extern size_t global_cppad_tape_size;
+extern double global_cppad_optimize_seconds;
+
+namespace {
+    using CppAD::vector;
+    typedef CppAD::AD<double>                     a_double;
+    typedef vector<size_t>                        s_vector;
+    typedef vector<double>                        d_vector;
+    typedef vector<a_double>                      a_vector;
+    typedef CppAD::sparse_rc<s_vector>            sparsity;
+    typedef CppAD::sparse_rcv<s_vector, d_vector> sparse_matrix;
+    //
+    // setup
+    void setup(
+        // inputs
+        size_t                  size    ,
+        // outputs
+        CppAD::ADFun<double>&   f       ,
+        sparse_matrix&          subset  ,
+        CppAD::sparse_jac_work& work    )
+    {
+        // number of independent variables
+        size_t n = size * size;
+        //
+        // choose an argument value
+        d_vector x(n);
+        CppAD::uniform_01(n, x);
+        //
+        // copy to independent variables
+        a_vector   ax(n);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = x[j];
+        //
+        // declare independent variables for function computation
+        bool record_compare   = false;
+        size_t abort_op_index = 0;
+        CppAD::Independent(ax, abort_op_index, record_compare);
+        //
+        // AD computation of the residual
+        a_vector ar(n);
+        stencil_residual<a_double>(size, ax, ar);
+        //
+        // f : x -> r
+        f.Dependent(ax, ar);
+        //
+        // optimize
+        std::string optimize_options =
+        "no_conditional_skip no_compare_op no_print_for_op no_cumulative_sum_op";
+        if( global_option["val_graph"] )
+            optimize_options += " val_graph";
+        if( global_option["optimize"] )
+        {  double start = CppAD::elapsed_seconds();
+            f.optimize(optimize_options);
+            global_cppad_optimize_seconds = CppAD::elapsed_seconds() - start;
+        }
+        global_cppad_tape_size = f.size_var();
+        //
+        // sparsity pattern for the Jacobian
+        // (computed using CppAD, we pretend it is not known in advance)
+        sparsity pattern;
+        size_t   n_point = stencil_n_point();
+        {  sparsity pattern_in(n, n, n);
+            for(size_t k = 0; k < n; ++k)
+                pattern_in.set(k, k, k);
+            bool transpose     = false;
+            bool dependency    = false;
+            bool internal_bool = false;
+            if( global_option["revsparsity"] )
+                f.rev_jac_sparsity(
+                    pattern_in, transpose, dependency, internal_bool, pattern
+                );
+            else
+                f.for_jac_sparsity(
+                    pattern_in, transpose, dependency, internal_bool, pattern
+                );
+        }
+        //
+        // subset of the Jacobian in the order specified by link_stencil
+        sparsity subset_pattern(n, n, n_point * n);
+        for(size_t k = 0; k < n; ++k)
+        {  for(size_t ell = 0; ell < n_point; ++ell)
+            {  size_t j = stencil_neighbor(size, k, ell);
+                subset_pattern.set(n_point * k + ell, k, j);
+            }
+        }
+        subset = sparse_matrix( subset_pattern );
+        //
+        // Use forward mode to compute the Jacobian
+        // (this caches the coloring information in work)
+        size_t group_max = 25;
+        work.clear();
+        f.sparse_jac_for(group_max, x, subset, pattern, "cppad", work);
+    }
+}
+
+bool link_stencil(
+    const std::string&         job      ,
+    size_t                     size     ,
+    size_t                     repeat   ,
+    CppAD::vector<double>     &x        ,
+    CppAD::vector<double>     &jacobian )
+{  global_cppad_thread_alloc_inuse = 0;
+
+    // --------------------------------------------------------------------
+    // check global options
+    const char* valid[] = {
+        "memory", "mmap", "onetape", "optimize", "revsparsity", "val_graph"
+    };
+    size_t n_valid = sizeof(valid) / sizeof(valid[0]);
+    typedef std::map<std::string, bool>::iterator iterator;
+    //
+    for(iterator itr=global_option.begin(); itr!=global_option.end(); ++itr)
+    {  if( itr->second )
+        {  bool ok = false;
+            for(size_t i = 0; i < n_valid; i++)
+                ok |= itr->first == valid[i];
+            if( ! ok )
+                return false;
+        }
+    }
+    // -----------------------------------------------------
+    // size corresponding to static_f
+    static size_t static_size = 0;
+    //
+    // function object corresponding to f(x)
+    static CppAD::ADFun<double> static_f;
+    //
+    // subset of Jacobian that we are using
+    static sparse_matrix static_subset;
+    //
+    // information used by sparse_jac_for
+    static CppAD::sparse_jac_work static_work;
+    //
+    // sparsity pattern not used because work is non-empty
+    sparsity empty_pattern;
+    // -----------------------------------------------------------------------
+    //
+    bool onetape = global_option["onetape"];
+    //
+    if( job == "setup" )
+    {  // values for the tape used by onetape (set by run otherwise)
+        global_cppad_tape_size        = 0;
+        global_cppad_optimize_seconds = 0.0;
+        //
+        if( onetape )
+        {  setup(size, static_f, static_subset, static_work);
+            static_size = size;
+        }
+        else
+        {  static_size = 0;
+        }
+        return true;
+    }
+    if( job == "teardown" )
+    {  static_f      = CppAD::ADFun<double>();
+        sparse_matrix empty_matrix;
+        static_subset.swap( empty_matrix );
+        static_work.clear();
+        static_size = 0;
+        return true;
+    }
+    // ------------------------------------------------------------------------
+    CPPAD_ASSERT_UNKNOWN( job == "run" );
+    //
+    // number of independent variables
+    size_t n = size * size;
+    //
+    // maximum number of colors at once
+    size_t group_max = 25;
+    // ------------------------------------------------------
+    while(repeat--)
+    {  if( onetape )
+        {  if( size != static_size )
+                CPPAD_ASSERT_UNKNOWN( size == static_size );
+        }
+        else
+        {  setup(size, static_f, static_subset, static_work);
+        }
+        // choose a value for x
+        CppAD::uniform_01(n, x);
+        //
+        // Use forward mode to compute the Jacobian
+        static_f.sparse_jac_for(group_max, x,
+            static_subset, empty_pattern, "cppad", static_work
+        );
+        jacobian = static_subset.val();
+    }
+    size_t thread                   = CppAD::thread_alloc::thread_num();
+    global_cppad_thread_alloc_inuse = CppAD::thread_alloc::inuse(thread);
+    return true;
+}
+/* {xrst_code}
+{xrst_spell_on}
+
+{xrst_end cppad_stencil.cpp}
+*/
@@ -0,0 +1,299 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin cppad_jit_stencil.cpp}
+
+cppad_jit Speed: Sparse Jacobian of a Two Dimensional Stencil Residual
+######################################################################
+
+Specifications
+**************
+See :ref:`link_stencil-name` .
+
+Implementation
+**************
+{xrst_spell_off}
+{xrst_code cpp} */
+# include <map>
+# include <cppad/cppad.hpp>
+# include <cppad/speed/uniform_01.hpp>
+# include "stencil_residual.hpp"
+extern std::map<std::string, bool> global_option;
+
+# ifdef _WIN32
+# define DLL_EXT ".dll"
+# else
+# define DLL_EXT ".so"
+# endif
+
+# if ! (CPPAD_C_COMPILER_GNU_FLAGS || CPPAD_C_COMPILER_MSVC_FLAGS )
+bool link_stencil(
+    const std::string&         job      ,
+    size_t                     size     ,
+    size_t                     repeat   ,
+    CppAD::vector<double>     &x        ,
+    CppAD::vector<double>     &jacobian )
+{  return false; }
+# else
+namespace {
+    //
+    // using
+    using std::string;
+    //
+    // typedefs
+    typedef CppAD::AD<double>                       a_double;
+    typedef CppAD::vector<double>                   d_vector;
+    typedef CppAD::vector<a_double>                 ad_vector;
+    typedef CppAD::vector<size_t>                   s_vector;
+    typedef CppAD::sparse_rc<s_vector>              s_vector_rc;
+    typedef CppAD::sparse_rcv<s_vector, ad_vector>  ad_vector_rcv;
+    //
+    // get_function_ptr
+    CppAD::jit_double get_function_ptr(
+        CppAD::link_dll_lib* dll_linker )
+    {  std::string function_name = "cppad_jit_jacobian_stencil";
+        string err_msg;
+        void* void_ptr = (*dll_linker)(function_name, err_msg);
+        if( err_msg != "" )
+        {  std::cerr << "link_stencil: err_msg = " << err_msg << "\n";
+            return nullptr;
+        }
+        CppAD::jit_double function_ptr =
+                reinterpret_cast<CppAD::jit_double>(void_ptr);
+        return function_ptr;
+    }
+    //
+    // setup
+    CppAD::link_dll_lib* setup(size_t size)
+    {  // optimization options
+        string optimize_options =
+            "no_conditional_skip no_compare_op no_print_for_op";
+        //
+        // n
+        // number of independent variables
+        size_t n = size * size;
+        //
+        // x
+        CppAD::vector<double> x(n);
+        CppAD::uniform_01(n, x);
+        //
+        // ax
+        ad_vector   ax(n);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = x[j];
+        //
+        // Independent
+        // declare independent variables for function computation
+        bool record_compare   = false;
+        size_t abort_op_index = 0;
+        CppAD::Independent(ax, abort_op_index, record_compare);
+        //
+        // ar
+        // AD computation of the residual
+        ad_vector ar(n);
+        stencil_residual<a_double>(size, ax, ar);
+        //
+        // f
+        // f(x) = stencil_residual(x)
+        CppAD::ADFun<double>  f;
+        f.Dependent(ax, ar);
+        if( global_option["optimize"] )
+            f.optimize(optimize_options);
+        //
+        // pattern
+        // sparsity pattern for the Jacobian of f
+        s_vector_rc pattern;
+        {  s_vector_rc pattern_in(n, n, n);
+            for(size_t k = 0; k < n; ++k)
+                pattern_in.set(k, k, k);
+            bool transpose     = false;
+            bool dependency    = false;
+            bool internal_bool = false;
+            f.for_jac_sparsity(
+                pattern_in, transpose, dependency, internal_bool, pattern
+            );
+        }
+        //
+        // asubset
+        // subset of the Jacobian in the order specified by link_stencil
+        size_t n_point = stencil_n_point();
+        s_vector_rc subset_pattern(n, n, n_point * n);
+        for(size_t k = 0; k < n; ++k)
+        {  for(size_t ell = 0; ell < n_point; ++ell)
+            {  size_t j = stencil_neighbor(size, k, ell);
+                subset_pattern.set(n_point * k + ell, k, j);
+            }
+        }
+        ad_vector_rcv asubset( subset_pattern );
+        //
+        // af
+        CppAD::ADFun<a_double, double> af;
+        af = f.base2ad();
+        //
+        // Independent
+        // declare independent variables for Jacobian computation
+        CppAD::Independent(ax, abort_op_index, record_compare);
+        //
+        // asubset
+        size_t                 group_max = 25;
+        CppAD::sparse_jac_work work;
+        af.sparse_jac_for(group_max, ax, asubset, pattern, "cppad", work);
+        //
+        // g
+        // function objects for g : x -> sparse Jacobian values
+        CppAD::ADFun<double> g;
+        g.Dependent(ax, asubset.val());
+        if( global_option["optimize"] )
+            g.optimize(optimize_options);
+        g.function_name_set("jacobian_stencil");
+        //
+        // csrc_file
+        string type      = "double";
+        string csrc_file = "jacobian_stencil.c";
+        std::ofstream ofs;
+        ofs.open(csrc_file, std::ofstream::out);
+        g.to_csrc(ofs, type);
+        ofs.close();
+        //
+        // dll_file
+        string dll_file = "jacobian_stencil" DLL_EXT;
+        CppAD::vector< string > csrc_files(1);
+        csrc_files[0] = csrc_file;
+        std::map< string, string > dll_options;
+# if CPPAD_C_COMPILER_MSVC_FLAGS
+        dll_options["compile"] = CPPAD_C_COMPILER_CMD " /EHs /EHc /c /TC /O2";
+# endif
+# if CPPAD_C_COMPILER_GNU_FLAGS
+        dll_options["compile"] = "gcc -c -fPIC -O2";
+# endif
+        string err_msg =
+            CppAD::create_dll_lib(dll_file, csrc_files, dll_options);
+        if( err_msg != "" )
+        {  std::cerr << "link_stencil: err_msg = " << err_msg << "\n";
+            return nullptr;
+        }
+        //
+        // dll_linker_ptr
+        CppAD::link_dll_lib* dll_linker_ptr =
+            new CppAD::link_dll_lib(dll_file, err_msg);
+        if( err_msg != "" )
+        {  std::cerr << "link_stencil: err_msg = " << err_msg << "\n";
+            delete dll_linker_ptr;
+            return nullptr;
+        }
+        return dll_linker_ptr;
+    }
+}
+
+bool link_stencil(
+    const std::string&         job      ,
+    size_t                     size     ,
+    size_t                     repeat   ,
+    CppAD::vector<double>     &x        ,
+    CppAD::vector<double>     &jacobian )
+{  CPPAD_ASSERT_UNKNOWN( x.size() == size * size );
+    CPPAD_ASSERT_UNKNOWN( jacobian.size() == stencil_n_point() * size * size );
+    // --------------------------------------------------------------------
+    // check global options
+    const char* valid[] = { "onetape", "optimize"};
+    size_t n_valid = sizeof(valid) / sizeof(valid[0]);
+    typedef std::map<string, bool>::iterator iterator;
+    //
+    for(iterator itr=global_option.begin(); itr!=global_option.end(); ++itr)
+    {  if( itr->second )
+        {  bool ok = false;
+            for(size_t i = 0; i < n_valid; i++)
+                ok |= itr->first == valid[i];
+            if( ! ok )
+                return false;
+        }
+    }
+    // --------------------------------------------------------------------
+    // pointer to dll linker
+    static CppAD::link_dll_lib* static_dll_linker = nullptr;
+    //
+    // pointer to jacobian_stencil function
+    static CppAD::jit_double static_jacobian_stencil;
+    //
+    // size corresponding static_fun
+    static size_t static_size = 0;
+    //
+    // number of independent variables
+    size_t nx = size * size;
+    //
+    // number of dependent variables
+    size_t ny = stencil_n_point() * size * size;
+    //
+    // onetape
+    bool onetape = global_option["onetape"];
+    // ----------------------------------------------------------------------
+    if( job == "setup" )
+    {  if( onetape )
+        {  if( static_dll_linker != nullptr )
+                delete static_dll_linker;
+            static_dll_linker = setup(size);
+            //
+            static_jacobian_stencil = get_function_ptr(static_dll_linker);
+            static_size         = size;
+            if( static_jacobian_stencil == nullptr )
+                return false;
+        }
+        else
+        {  static_jacobian_stencil = nullptr;
+            static_size         = 0;
+        }
+        return true;
+    }
+    if( job ==  "teardown" )
+    {  if( static_dll_linker != nullptr )
+        {  delete static_dll_linker;
+            static_dll_linker = nullptr;
+        }
+        return true;
+    }
+    // -----------------------------------------------------------------------
+    CPPAD_ASSERT_UNKNOWN( job == "run" );
+    if( onetape ) while(repeat--)
+    {  // use if before assert to avoid warning that static_size is not used
+        if( size != static_size )
+        {  CPPAD_ASSERT_UNKNOWN( size == static_size );
+        }
+
+        // get next argument value
+        CppAD::uniform_01(nx, x);
+
+        // evaluate the sparse Jacobian
+        size_t compare_change = 0;
+        static_jacobian_stencil(
+            nx, x.data(), ny, jacobian.data(), &compare_change
+        );
+    }
+    else while(repeat--)
+    {  if( static_dll_linker != nullptr )
+            delete static_dll_linker;
+        static_dll_linker = setup(size);
+        //
+        static_jacobian_stencil = get_function_ptr(static_dll_linker);
+        static_size         = size;
+        if( static_jacobian_stencil == nullptr )
+            return false;
+        //
+        // get next argument value
+        CppAD::uniform_01(nx, x);
+
+        // evaluate the sparse Jacobian
+        size_t compare_change = 0;
+        static_jacobian_stencil(
+            nx, x.data(), ny, jacobian.data(), &compare_change
+        );
+    }
+    return true;
+}
+# endif // CPPAD_C_COMPILER_GNU_FLAGS || CPPAD_C_COMPILER_MSVC_FLAGS
+/* {xrst_code}
+{xrst_spell_on}
+
+{xrst_end cppad_jit_stencil.cpp}
+*/
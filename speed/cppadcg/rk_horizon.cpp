@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin cppadcg_rk_horizon.cpp}
+{xrst_spell
+    kutta
+}
+
+cppadcg Speed: Gradient of a Long Horizon Runge-Kutta Solution
+##############################################################
+
+Specifications
+**************
+:ref:`link_rk_horizon-name`
+
+Implementation
+**************
+// a cppadcg version of this test is not yet implemented
+{xrst_spell_off}
+{xrst_code cpp} */
+# include <map>
+# include <cppad/utility/vector.hpp>
+
+// list of possible options
+extern std::map<std::string, bool> global_option;
+
+bool link_rk_horizon(
+    const std::string&         job      ,
+    size_t                     size     ,
+    size_t                     repeat   ,
+    CppAD::vector<double>     &x        ,
+    CppAD::vector<double>     &gradient )
+{  return false; }
+/* {xrst_code}
+{xrst_spell_on}
+
+{xrst_end cppadcg_rk_horizon.cpp}
+*/
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin double_rk_horizon.cpp}
+{xrst_spell
+    kutta
+}
+Double Speed: Long Horizon Runge-Kutta Solution
+###############################################
+
+Specifications
+**************
+See :ref:`link_rk_horizon-name` .
+
+Implementation
+**************
+
+{xrst_spell_off}
+{xrst_code cpp} */
+# include <cppad/utility/vector.hpp>
+# include <cppad/speed/uniform_01.hpp>
+# include "rk_horizon.hpp"
+
+// Note that CppAD uses global_option["memory"] at the main program level
+# include <map>
+extern std::map<std::string, bool> global_option;
+
+bool link_rk_horizon(
+    const std::string&         job      ,
+    size_t                     size     ,
+    size_t                     repeat   ,
+    CppAD::vector<double>     &x        ,
+    CppAD::vector<double>     &y        )
+{  // --------------------------------------------------------------------------
+    // ignore global_option
+    // --------------------------------------------------------------------------
+    if( job == "setup" || job == "teardown" )
+        return true;
+    CPPAD_ASSERT_UNKNOWN( job == "run" );
+    //
+    // number of independent variables
+    size_t n = rk_horizon_n_x();
+    // -------------------------------------------------------------------------
+    while(repeat--)
+    {  // get the next argument value
+        CppAD::uniform_01(n, x);
+
+        // computation of the function value
+        rk_horizon<double>(size, x, y);
+    }
+    return true;
+}
+/* {xrst_code}
+{xrst_spell_on}
+
+{xrst_end double_rk_horizon.cpp}
+*/
@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin double_stencil.cpp}
+Double Speed: Two Dimensional Stencil Residual
+##############################################
+
+Specifications
+**************
+See :ref:`link_stencil-name` .
+
+Implementation
+**************
+
+{xrst_spell_off}
+{xrst_code cpp} */
+# include <cppad/utility/vector.hpp>
+# include <cppad/speed/uniform_01.hpp>
+# include "stencil_residual.hpp"
+
+// Note that CppAD uses global_option["memory"] at the main program level
+# include <map>
+extern std::map<std::string, bool> global_option;
+
+bool link_stencil(
+    const std::string&         job      ,
+    size_t                     size     ,
+    size_t                     repeat   ,
+    CppAD::vector<double>     &x        ,
+    CppAD::vector<double>     &residual )
+{  // --------------------------------------------------------------------------
+    // ignore global_option
+    // --------------------------------------------------------------------------
+    if( job == "setup" || job == "teardown" )
+        return true;
+    CPPAD_ASSERT_UNKNOWN( job == "run" );
+    //
+    // number of independent variables
+    size_t n = size * size;
+    // -------------------------------------------------------------------------
+    while(repeat--)
+    {  // get the next argument value
+        CppAD::uniform_01(n, x);
+
+        // computation of the function value
+        stencil_residual<double>(size, x, residual);
+    }
+    return true;
+}
+/* {xrst_code}
+{xrst_spell_on}
+
+{xrst_end double_stencil.cpp}
+*/
@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin from_graph_speed.cpp}
+
+Speed of Creating a Function From a C++ AD Graph
+################################################
+
+Syntax
+******
+``speed/example/speed_from_graph`` [ *n_max* ]
+
+Purpose
+*******
+This program uses :ref:`to_graph-name` to create a C++ AD graph
+for functions with :math:`n` operations.
+It then times the call to :ref:`from_graph-name` that creates
+an ``ADFun`` object from the graph.
+The program can be run using different versions of CppAD
+to compare their speed.
+
+n_max
+*****
+The sizes :math:`n = 10^4, 10^5, 10^6`
+that are less than or equal *n_max* are tested.
+The default value for *n_max* is :math:`10^6`.
+
+Output
+******
+For each size, the number of graph operators,
+and the time in seconds for one call to ``from_graph`` are printed.
+The program returns zero if the functions created using ``from_graph``
+have the same values as the original functions
+and non-zero otherwise.
+
+Program
+*******
+{xrst_spell_off}
+{xrst_code cpp} */
+# include <cstdlib>
+# include <cstdio>
+# include <cppad/cppad.hpp>
+
+namespace {
+    typedef CppAD::vector<double>               d_vector;
+    typedef CppAD::vector< CppAD::AD<double> >  ad_vector;
+    //
+    // graph that is converted by from_graph
+    CppAD::cpp_graph graph_obj_;
+    //
+    // function created by from_graph
+    CppAD::ADFun<double> g_;
+    //
+    // record a function with n operations and set graph_obj_ to its graph
+    void create_graph(size_t n, CppAD::ADFun<double>& f)
+    {   size_t nx = 10;
+        ad_vector ax(nx), ay(1);
+        for(size_t j = 0; j < nx; ++j)
+            ax[j] = 0.0;
+        CppAD::Independent(ax);
+        ay[0] = 0.0;
+        for(size_t i = 0; i < n / 4; ++i)
+        {   double c = double(i + 1) / double(n);
+            ay[0] += c * sin( ax[i % nx] + double(i) );
+        }
+        f.Dependent(ax, ay);
+        f.to_graph(graph_obj_);
+    }
+    // create g_ from graph_obj_
+    void from_graph(size_t n, size_t repeat)
+    {   while( repeat-- )
+            g_.from_graph(graph_obj_);
+    }
+}
+
+int main(int argc, char* argv[])
+{   bool ok = true;
+    //
+    size_t n_max = 1000000;
+    if( argc > 1 )
+        n_max = size_t( std::atoi( argv[1] ) );
+    //
+    double time_min = 0.5;
+    size_t size_list[] = {10000, 100000, 1000000};
+    size_t n_size      = sizeof(size_list) / sizeof(size_list[0]);
+    //
+    std::printf("%8s %12s %12s\n", "n", "n_operator", "seconds");
+    for(size_t k = 0; k < n_size; ++k)
+    {   size_t n = size_list[k];
+        if( n <= n_max )
+        {   CppAD::ADFun<double> f;
+            create_graph(n, f);
+            double time = CppAD::time_test(from_graph, time_min, n);
+            std::printf("%8d %12d %12.3e\n",
+                int(n), int( graph_obj_.operator_vec_size() ), time
+            );
+            //
+            // check that the functions are the same
+            d_vector x( f.Domain() );
+            for(size_t j = 0; j < x.size(); ++j)
+                x[j] = double(j) / double( x.size() );
+            d_vector y = f.Forward(0, x);
+            d_vector z = g_.Forward(0, x);
+            ok &= CppAD::NearEqual(y[0], z[0], 1e-12, 1e-12);
+        }
+    }
+    //
+    if( ok )
+        return 0;
+    return 1;
+}
+/* {xrst_code}
+{xrst_spell_on}
+
+{xrst_end from_graph_speed.cpp}
+*/
@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin from_json_speed.cpp}
+{xrst_spell
+    ifstream
+}
+
+Speed of Reading a Json AD Graph From a String and From a Stream
+################################################################
+
+Syntax
+******
+``speed/example/speed_from_json`` [ *n_max* ]
+
+Purpose
+*******
+This program writes the :ref:`to_json-name` output for
+functions with :math:`n` operations to a temporary file.
+It then times two ways of creating an ``ADFun`` object from this file:
+
+string
+======
+Read the entire file into a ``std::string`` *json* and then call
+*fun* . ``from_json`` ( *json* ) .
+The file and the graph are both in memory at the same time.
+
+stream
+======
+Open the file as an ``std::ifstream`` *is* and call
+*fun* . ``from_json`` ( *is* ) .
+Only a small chunk of the file is in memory at any one time.
+
+n_max
+*****
+The sizes :math:`n = 10^4, 10^5, 10^6`
+that are less than or equal *n_max* are tested.
+The default value for *n_max* is :math:`10^6`.
+
+Output
+******
+For each size, the size of the Json graph in mega bytes,
+the time in seconds using a string,
+the time in seconds using a stream,
+and the ratio of these times are printed.
+The program returns zero if the functions created using the two methods
+have the same number of variables and values
+and non-zero otherwise.
+
+Program
+*******
+{xrst_spell_off}
+{xrst_code cpp} */
+# include <cstdlib>
+# include <cstdio>
+# include <fstream>
+# include <sstream>
+# include <cppad/cppad.hpp>
+# include <cppad/local/temp_file.hpp>
+
+namespace {
+    typedef CppAD::vector<double>               d_vector;
+    typedef CppAD::vector< CppAD::AD<double> >  ad_vector;
+    //
+    // temporary file that contains the Json graph
+    std::string file_name_;
+    //
+    // functions created by each method
+    CppAD::ADFun<double> f_string_, f_stream_;
+    //
+    // record a function with n operations and write its Json to file_name_
+    size_t write_json(size_t n)
+    {   size_t nx = 10;
+        ad_vector ax(nx), ay(1);
+        for(size_t j = 0; j < nx; ++j)
+            ax[j] = 0.0;
+        CppAD::Independent(ax);
+        ay[0] = 0.0;
+        for(size_t i = 0; i < n / 4; ++i)
+        {   double c = double(i + 1) / double(n);
+            ay[0] += c * sin( ax[i % nx] + double(i) );
+        }
+        CppAD::ADFun<double> f(ax, ay);
+        std::string json = f.to_json();
+        std::ofstream os( file_name_.c_str() );
+        os << json;
+        return json.size();
+    }
+    // read the entire file into a string and then convert it
+    void from_string(size_t n, size_t repeat)
+    {   while( repeat-- )
+        {   std::ifstream is( file_name_.c_str() );
+            std::ostringstream buffer;
+            buffer << is.rdbuf();
+            std::string json = buffer.str();
+            f_string_.from_json(json);
+        }
+    }
+    // convert the file while it is being read
+    void from_stream(size_t n, size_t repeat)
+    {   while( repeat-- )
+        {   std::ifstream is( file_name_.c_str() );
+            f_stream_.from_json(is);
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{   bool ok = true;
+    //
+    size_t n_max = 1000000;
+    if( argc > 1 )
+        n_max = size_t( std::atoi( argv[1] ) );
+    //
+    file_name_ = CppAD::local::temp_file();
+    if( file_name_ == "" )
+    {   std::printf("from_json_speed: cannot create a temporary file\n");
+        return 1;
+    }
+    //
+    double time_min = 0.5;
+    size_t size_list[] = {10000, 100000, 1000000};
+    size_t n_size      = sizeof(size_list) / sizeof(size_list[0]);
+    //
+    std::printf("%8s %8s %12s %12s %8s\n",
+        "n", "MB", "string", "stream", "ratio"
+    );
+    for(size_t k = 0; k < n_size; ++k)
+    {   size_t n = size_list[k];
+        if( n <= n_max )
+        {   double mega_bytes  = double( write_json(n) ) / 1e6;
+            double time_string = CppAD::time_test(from_string, time_min, n);
+            double time_stream = CppAD::time_test(from_stream, time_min, n);
+            std::printf("%8d %8.1f %12.3e %12.3e %8.2f\n",
+                int(n), mega_bytes, time_string, time_stream,
+                time_string / time_stream
+            );
+            //
+            // check that the functions are the same
+            ok &= f_string_.size_var() == f_stream_.size_var();
+            d_vector x( f_string_.Domain() );
+            for(size_t j = 0; j < x.size(); ++j)
+                x[j] = double(j) / double( x.size() );
+            d_vector y_string = f_string_.Forward(0, x);
+            d_vector y_stream = f_stream_.Forward(0, x);
+            ok &= y_string[0] == y_stream[0];
+        }
+    }
+    std::remove( file_name_.c_str() );
+    //
+    if( ok )
+        return 0;
+    return 1;
+}
+/* {xrst_code}
+{xrst_spell_on}
+
+{xrst_end from_json_speed.cpp}
+*/
@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin lu_factor_speed.cpp}
+{xrst_spell
+    jp
+}
+
+Speed of LuFactor With Row and With Full Pivoting
+#################################################
+
+Syntax
+******
+``speed/example/speed_lu_factor`` [ *n_max* ]
+
+Purpose
+*******
+For *Float* equal to ``double`` , :ref:`LuFactor-name` uses
+:ref:`row pivoting<LuFactor@Pivoting>` and a blocked algorithm.
+This program compares its speed with the
+full pivoting algorithm that is used for other *Float* types.
+It also checks that both algorithms compute the same determinant.
+
+n_max
+*****
+The sizes :math:`n = 50, 100, 200, 500, 1000, 2000`
+that are less than or equal *n_max* are tested.
+The default value for *n_max* is 2000.
+
+Output
+******
+For each size, the time in seconds for one factorization
+with full pivoting, the time with row pivoting,
+and the ratio of these times are printed.
+The program returns zero if the determinants agree
+and non-zero otherwise.
+
+Program
+*******
+{xrst_spell_off}
+{xrst_code cpp} */
+# include <cstdlib>
+# include <cstdio>
+# include <cppad/utility/lu_factor.hpp>
+# include <cppad/utility/time_test.hpp>
+# include <cppad/utility/vector.hpp>
+
+namespace {
+    // matrix that is factored by each test
+    CppAD::vector<double> matrix_;
+
+    // factor using full pivoting
+    void full(size_t n, size_t repeat)
+    {   CppAD::vector<size_t> ip(n), jp(n);
+        CppAD::vector<double> LU(n * n);
+        while( repeat-- )
+        {   LU = matrix_;
+            CppAD::local::utility::lu_factor_full(ip, jp, LU);
+        }
+    }
+    // factor using row pivoting
+    void partial(size_t n, size_t repeat)
+    {   CppAD::vector<size_t> ip(n), jp(n);
+        CppAD::vector<double> LU(n * n);
+        while( repeat-- )
+        {   LU = matrix_;
+            CppAD::local::utility::lu_factor_partial(ip, jp, LU);
+        }
+    }
+    // log of the absolute value of the determinant of matrix_
+    template <class Factor>
+    double log_det(size_t n, Factor factor)
+    {   CppAD::vector<size_t> ip(n), jp(n);
+        CppAD::vector<double> LU(matrix_);
+        factor(ip, jp, LU);
+        double sum = 0.0;
+        for(size_t i = 0; i < n; ++i)
+            sum += std::log( std::fabs( LU[ ip[i] * n + jp[i] ] ) );
+        return sum;
+    }
+    int factor_full(
+        CppAD::vector<size_t>& ip ,
+        CppAD::vector<size_t>& jp ,
+        CppAD::vector<double>& LU )
+    {   return CppAD::local::utility::lu_factor_full(ip, jp, LU); }
+    int factor_partial(
+        CppAD::vector<size_t>& ip ,
+        CppAD::vector<size_t>& jp ,
+        CppAD::vector<double>& LU )
+    {   return CppAD::local::utility::lu_factor_partial(ip, jp, LU); }
+}
+
+int main(int argc, char* argv[])
+{   bool ok = true;
+    //
+    size_t n_max = 2000;
+    if( argc > 1 )
+        n_max = size_t( std::atoi( argv[1] ) );
+    //
+    double time_min = 0.5;
+    size_t size_list[] = {50, 100, 200, 500, 1000, 2000};
+    size_t n_size      = sizeof(size_list) / sizeof(size_list[0]);
+    //
+    std::printf("%6s %12s %12s %8s\n", "n", "full", "row", "ratio");
+    for(size_t k = 0; k < n_size; ++k)
+    {   size_t n = size_list[k];
+        if( n <= n_max )
+        {   matrix_.resize(n * n);
+            for(size_t i = 0; i < n * n; ++i)
+                matrix_[i] = double( std::rand() ) / double(RAND_MAX) - 0.5;
+            //
+            double time_full    = CppAD::time_test(full, time_min, n);
+            double time_partial = CppAD::time_test(partial, time_min, n);
+            std::printf("%6d %12.3e %12.3e %8.1f\n",
+                int(n), time_full, time_partial, time_full / time_partial
+            );
+            //
+            double log_full    = log_det(n, factor_full);
+            double log_partial = log_det(n, factor_partial);
+            ok &= std::fabs(log_full - log_partial) <= 1e-8 * double(n);
+        }
+    }
+    if( ok )
+        return 0;
+    return 1;
+}
+/* {xrst_code}
+{xrst_spell_on}
+
+{xrst_end lu_factor_speed.cpp}
+*/
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin mmap_speed.cpp}
+{xrst_spell
+    mmap
+}
+
+Speed of Large Tapes With and Without mmap
+##########################################
+
+Syntax
+******
+``speed/example/speed_mmap`` [ *n_step* ]
+
+Purpose
+*******
+This program compares the speed of zero order forward and
+first order reverse mode for a tape that is larger than the
+last level cache, with and without the :ref:`ta_mmap_bytes-name` option.
+It also checks that both cases compute the same derivative values.
+
+n_step
+******
+The function has *n_step* steps and each step creates two variables.
+The default value for *n_step* is ten million which
+uses more than 500 megabytes for the tape and the Taylor coefficients.
+The size of the last level cache can be found using
+the ``lscpu`` command on Linux systems.
+
+Output
+******
+The number of variables, the bytes of memory used by the operation sequence,
+the time in seconds for one zero order forward and one
+first order reverse calculation without mmap (``mmap_bytes(0)`` ),
+the time with mmap (``mmap_bytes(2MB)`` ),
+and the ratio of these times are printed.
+The program returns zero if the derivatives agree
+and non-zero otherwise.
+
+Program
+*******
+{xrst_spell_off}
+{xrst_code cpp} */
+# include <cstdlib>
+# include <cstdio>
+# include <cppad/cppad.hpp>
+
+namespace {
+    // function and argument that are used by the test
+    CppAD::ADFun<double>* f_ = nullptr;
+    CppAD::vector<double> x_;
+    CppAD::vector<double> dw_;
+
+    // record the function
+    void record(size_t n_step)
+    {   using CppAD::AD;
+        size_t n = x_.size();
+        CppAD::vector< AD<double> > ax(n), ay(1);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = x_[j];
+        CppAD::Independent(ax);
+        CppAD::vector< AD<double> > az(ax);
+        for(size_t k = 0; k < n_step; ++k)
+        {   size_t j = k % n;
+            az[j] = sin( az[j] ) * az[ (j + 1) % n ];
+        }
+        ay[0] = 0.0;
+        for(size_t j = 0; j < n; ++j)
+            ay[0] += az[j];
+        f_ = new CppAD::ADFun<double>(ax, ay);
+    }
+    // zero order forward and first order reverse
+    void sweep(size_t n_step, size_t repeat)
+    {   CppAD::vector<double> w(1);
+        w[0] = 1.0;
+        while( repeat-- )
+        {   f_->Forward(0, x_);
+            dw_ = f_->Reverse(1, w);
+        }
+    }
+    // time sweep for one setting of mmap_bytes
+    double time_sweep(
+        size_t n_step, size_t mmap_bytes, CppAD::vector<double>& dw)
+    {   using CppAD::thread_alloc;
+        thread_alloc::mmap_bytes(mmap_bytes);
+        record(n_step);
+        double time_min = 1.0;
+        double time     = CppAD::time_test(sweep, time_min, n_step);
+        dw              = dw_;
+        delete f_;
+        f_ = nullptr;
+        thread_alloc::free_available( thread_alloc::thread_num() );
+        return time;
+    }
+}
+
+int main(int argc, char* argv[])
+{   bool ok = true;
+    using CppAD::thread_alloc;
+    //
+    size_t n_step = 10000000;
+    if( argc > 1 )
+        n_step = size_t( std::atoi( argv[1] ) );
+    //
+    // x_
+    size_t n = 1000;
+    x_.resize(n);
+    for(size_t j = 0; j < n; ++j)
+        x_[j] = 1.0 + double(j) / double(n);
+    //
+    // n_var, n_byte
+    record(n_step);
+    size_t n_var  = f_->size_var();
+    size_t n_byte = f_->size_op_seq();
+    delete f_;
+    f_ = nullptr;
+    thread_alloc::free_available( thread_alloc::thread_num() );
+    //
+    CppAD::vector<double> dw_no, dw_yes;
+    double time_no  = time_sweep(n_step, 0, dw_no);
+    double time_yes = time_sweep(n_step, size_t(1) << 21, dw_yes);
+    //
+    std::printf("%12s %12s %12s %12s %8s\n",
+        "n_var", "tape_bytes", "no_mmap", "mmap", "ratio"
+    );
+    std::printf("%12d %12d %12.3e %12.3e %8.2f\n",
+        int(n_var), int(n_byte), time_no, time_yes, time_no / time_yes
+    );
+    for(size_t j = 0; j < n; ++j)
+        ok &= dw_no[j] == dw_yes[j];
+    //
+    // return to the default setting
+    thread_alloc::mmap_bytes(0);
+    //
+    if( ok )
+        return 0;
+    return 1;
+}
+/* {xrst_code}
+{xrst_spell_on}
+
+{xrst_end mmap_speed.cpp}
+*/
@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+{xrst_begin tensor_dir_speed.cpp}
+
+Speed of TensorDir Versus Nested base2ad Recordings
+###################################################
+
+Syntax
+******
+``speed/example/speed_tensor_dir`` [ *n_max* ]
+
+Purpose
+*******
+This program computes all the partials of order :math:`d = 3, 4` for
+
+.. math::
+
+    f(x) = \sum_{i=0}^{n-1} \sin \left( \sum_{j=0}^{n-1} a_{i,j} x_j \right)
+
+using :ref:`TensorDir-name` and using nested recordings; i.e.,
+:ref:`base2ad-name` is used to record the :ref:`Hessian-name` ,
+then for :math:`d = 4` it is used to record the :ref:`Jacobian-name`
+of the Hessian, and finally the Jacobian of the last recording is computed.
+It also checks that both methods compute the same partials.
+
+n_max
+*****
+The sizes :math:`n = 5, 10, 20`
+that are less than or equal *n_max* are tested.
+The default value for *n_max* is 20.
+
+Output
+******
+For each order and size, the number of distinct partials,
+the time in seconds for ``TensorDir`` ,
+the time for the nested recording method,
+and the ratio of these times are printed.
+The program returns zero if the partials agree
+and non-zero otherwise.
+
+Program
+*******
+{xrst_spell_off}
+{xrst_code cpp} */
+# include <cstdlib>
+# include <cstdio>
+# include <cppad/cppad.hpp>
+
+namespace {
+    typedef CppAD::vector<double>               d_vector;
+    typedef CppAD::vector< CppAD::AD<double> >  ad_vector;
+    //
+    // function that is recorded
+    CppAD::ADFun<double> f_;
+    //
+    // point at which the partials are evaluated
+    d_vector x_;
+    //
+    // order of the partials
+    size_t d_;
+    //
+    // partials computed by each method
+    d_vector ten_, jac_;
+    //
+    // record f_ for size n
+    void record(size_t n)
+    {   ad_vector ax(n), ay(1);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = 0.0;
+        CppAD::Independent(ax);
+        ay[0] = 0.0;
+        for(size_t i = 0; i < n; ++i)
+        {   CppAD::AD<double> sum = 0.0;
+            for(size_t j = 0; j < n; ++j)
+                sum += double(i + j + 1) / double(n * n) * ax[j];
+            ay[0] += sin(sum);
+        }
+        f_.Dependent(ax, ay);
+        x_.resize(n);
+        for(size_t j = 0; j < n; ++j)
+            x_[j] = double(j) / double(n);
+    }
+    // partials of order d_ using TensorDir
+    void tensor_dir(size_t n, size_t repeat)
+    {   size_t r = 16;
+        while( repeat-- )
+            ten_ = f_.TensorDir(x_, d_, r);
+    }
+    // partials of order d_ using nested recordings
+    void nested(size_t n, size_t repeat)
+    {   while( repeat-- )
+        {   // h(x) = Hessian of f
+            CppAD::ADFun< CppAD::AD<double>, double > af = f_.base2ad();
+            ad_vector ax(n), aw(1), ay;
+            for(size_t j = 0; j < n; ++j)
+                ax[j] = x_[j];
+            aw[0] = 1.0;
+            CppAD::Independent(ax);
+            ay = af.Hessian(ax, aw);
+            CppAD::ADFun<double> h(ax, ay);
+            //
+            // h(x) = Jacobian of h(x)
+            for(size_t k = 3; k < d_; ++k)
+            {   CppAD::ADFun< CppAD::AD<double>, double > ah = h.base2ad();
+                CppAD::Independent(ax);
+                ay = ah.Jacobian(ax);
+                h.Dependent(ax, ay);
+            }
+            jac_ = h.Jacobian(x_);
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{   bool ok = true;
+    //
+    size_t n_max = 20;
+    if( argc > 1 )
+        n_max = size_t( std::atoi( argv[1] ) );
+    //
+    double time_min = 0.5;
+    size_t size_list[] = {5, 10, 20};
+    size_t n_size      = sizeof(size_list) / sizeof(size_list[0]);
+    //
+    std::printf("%3s %6s %8s %12s %12s %8s\n",
+        "d", "n", "N", "tensor_dir", "nested", "ratio"
+    );
+    for(d_ = 3; d_ <= 4; ++d_)
+    for(size_t k = 0; k < n_size; ++k)
+    {   size_t n = size_list[k];
+        if( n <= n_max )
+        {   record(n);
+            //
+            double time_tensor = CppAD::time_test(tensor_dir, time_min, n);
+            double time_nested = CppAD::time_test(nested, time_min, n);
+            size_t N           = ten_.size();
+            std::printf("%3d %6d %8d %12.3e %12.3e %8.1f\n",
+                int(d_), int(n), int(N), time_tensor, time_nested,
+                time_nested / time_tensor
+            );
+            //
+            // check the partials in lexicographic order j_1 <= ... <= j_d
+            CppAD::vector<size_t> j(d_);
+            for(size_t q = 0; q < d_; ++q)
+                j[q] = 0;
+            size_t a = 0;
+            bool more = true;
+            while( more )
+            {   size_t index = 0;
+                for(size_t q = 0; q < d_; ++q)
+                    index = index * n + j[q];
+                ok &= CppAD::NearEqual(ten_[a], jac_[index], 1e-8, 1e-8);
+                ++a;
+                //
+                // next non-decreasing sequence
+                size_t q = d_;
+                while( q > 0 && j[q-1] == n - 1 )
+                    --q;
+                more = q > 0;
+                if( more )
+                {   size_t value = j[q-1] + 1;
+                    for(size_t u = q - 1; u < d_; ++u)
+                        j[u] = value;
+                }
+            }
+            ok &= a == N;
+        }
+    }
+    if( ok )
+        return 0;
+    return 1;
+}
+/* {xrst_code}
+{xrst_spell_on}
+
+{xrst_end tensor_dir_speed.cpp}
+*/
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <cstring>
@@ -50,6 +50,8 @@
 {xrst_begin speed_main}
 {xrst_spell
     boolsparsity
+    csv
+    inuse
     onetape
     optionlist
     retaped
@@ -57,6 +59,7 @@
     subgraphs
     subsparsity
     underbar
+    welch
 }
 
 Running the Speed Test Program
@@ -65,6 +68,7 @@ Running the Speed Test Program
 Syntax
 ******
 | ``speed/`` *package* / ``speed_`` *package* *test* *seed* *option_list*
+| ``speed/`` *package* / ``speed_`` *package* *test* *seed* *option_list* ``csv``
 
 Purpose
 *******
@@ -113,10 +117,13 @@ and has the following possible values:
 :ref:`det_minor<link_det_minor-name>` ,
 :ref:`det_lu<link_det_lu-name>` ,
 :ref:`mat_mul<link_mat_mul-name>` ,
+:ref:`mlp<link_mlp-name>` ,
 :ref:`ode<link_ode-name>` ,
 :ref:`poly<link_poly-name>` ,
+:ref:`rk_horizon<link_rk_horizon-name>` ,
 :ref:`sparse_hessian<link_sparse_hessian-name>` ,
-:ref:`sparse_jacobian<link_sparse_jacobian-name>` .
+:ref:`sparse_jacobian<link_sparse_jacobian-name>` ,
+:ref:`stencil<link_stencil-name>` .
 You can experiment with changing the implementation of a
 particular test for a particular package.
 
@@ -196,6 +203,20 @@ If it is not present, CppAD will used standard memory allocation.
 Another package might use this option for a different
 memory allocation method.
 
+mmap
+====
+This option is also special because individual CppAD speed tests need not
+do anything different if this option is true or false.
+If the ``mmap`` option is present, the CppAD
+:ref:`mmap_bytes<ta_mmap_bytes-name>` routine will be called by
+the speed test main program, before any of the tests are executed,
+so that blocks of two megabytes or more are obtained directly from the
+operating system (using huge pages when possible).
+This should make zero order forward mode faster for operation sequences
+with a large number of variables; e.g., the
+:ref:`rk_horizon<link_rk_horizon-name>` test with a large *size* .
+It is most effective when combined with the ``memory`` option.
+
 optimize
 ========
 If this option is present,
@@ -330,6 +351,63 @@ colors used for each sparse Jacobian (Hessian) calculation; see
 *n_color* for
 :ref:`sparse_jac<sparse_jac@n_color>` and *n_sweep* for
 :ref:`sparse_hessian<sparse_hessian@n_sweep>` .
+
+CSV Results
+***********
+If ``csv`` is present in the command line (after *seed* ),
+it is not included in *option_list* and the speed results are
+output in comma separated value form instead of the form above.
+In this case, standard output only contains the comma separated values
+and all of the other output (e.g., the correctness results) is written
+to standard error.
+The first line of this output is
+
+| |tab| ``package,test,option_list,size,sample,rate,inuse,tape_size,optimize_seconds``
+
+and it is followed by one line for each speed test, size, and sample.
+Each size is timed *n_sample* = 3 times so that one can judge
+the variation in the rates.
+The fields in these lines are
+
+.. csv-table::
+    :widths: auto
+    :header-rows: 1
+
+    Field,Meaning
+    package,the value of *package*
+    test,the speed test; e.g. ``det_lu``
+    option_list,the options separated by ``_`` (empty if there are none)
+    size,the size argument for this test
+    sample,the index of this sample for this test and size
+    rate,the number of times per second that this test executed
+    inuse,:ref:`thread_alloc inuse<ta_inuse-name>` at the end of this test
+    tape_size,the number of variables in the tape; see :ref:`fun_property@size_var`
+    optimize_seconds,the time it took to optimize the tape
+
+The ``inuse`` , ``tape_size`` , and ``optimize_seconds`` fields are only
+computed by the :ref:`speed_cppad-name` tests (they are zero otherwise).
+The ``optimize_seconds`` field is zero when the ``optimize`` option
+is not present.
+
+Comparing Results
+=================
+The program ``bin/speed_compare.py`` compares two CSV result files;
+e.g., for two versions of CppAD.
+Its syntax is
+
+| |tab| ``bin/speed_compare.py`` *one* *two* [ *relative* ]
+
+where *one* and *two* are the result files.
+Results from more than one run can be combined into one file
+(by concatenating the files) to increase the number of samples.
+For each package, test, option list, and size,
+the mean rate in *two* is compared with the mean rate in *one* .
+If the relative difference is larger than *relative*
+(default value 0.05) and the difference is statistically significant
+(using a Welch t-test at the 5% level), the difference is flagged as a
+``regression`` or ``improvement`` .
+Differences in ``inuse`` and ``tape_size`` are also reported.
+The program exits with a non-zero status if there is a regression.
 {xrst_toc_hidden
     speed/src/link.xrst
 }
@@ -346,10 +424,13 @@ Each of these routines links this main program to the corresponding test:
     link_det_lu,:ref:`link_det_lu-title`
     link_det_minor,:ref:`link_det_minor-title`
     link_mat_mul,:ref:`link_mat_mul-title`
+    link_mlp,:ref:`link_mlp-title`
     link_ode,:ref:`link_ode-title`
     link_poly,:ref:`link_poly-title`
+    link_rk_horizon,:ref:`link_rk_horizon-title`
     link_sparse_hessian,:ref:`link_sparse_hessian-title`
     link_sparse_jacobian,:ref:`link_sparse_jacobian-title`
+    link_stencil,:ref:`link_stencil-title`
 
 {xrst_end speed_main}
 -----------------------------------------------------------------------------
@@ -364,10 +445,13 @@ Each of these routines links this main program to the corresponding test:
 CPPAD_DECLARE_TIME(det_lu);
 CPPAD_DECLARE_TIME(det_minor);
 CPPAD_DECLARE_TIME(mat_mul);
+CPPAD_DECLARE_TIME(mlp);
 CPPAD_DECLARE_TIME(ode);
 CPPAD_DECLARE_TIME(poly);
+CPPAD_DECLARE_TIME(rk_horizon);
 CPPAD_DECLARE_TIME(sparse_hessian);
 CPPAD_DECLARE_TIME(sparse_jacobian);
+CPPAD_DECLARE_TIME(stencil);
 //
 // some routines defined in src subdirectory
 extern void info_sparse_jacobian(
@@ -384,6 +468,12 @@ std::map<std::string, bool> global_option;
 // current thread at end of the test.
 size_t global_cppad_thread_alloc_inuse = 0;
 //
+// If the previous CppAD speed test did not record a tape, these are zero.
+// Otherwise they are the number of variables in the last tape recorded and
+// the number of seconds it took to optimize that tape.
+size_t global_cppad_tape_size        = 0;
+double global_cppad_optimize_seconds = 0.0;
+//
 // This is the value of seed in the main program command line.
 // It can be used by the sparse matrix routines to reset the random generator
 // so same sparsity pattern is obtained during source generation and usage.
@@ -396,6 +486,7 @@ namespace {
     using std::endl;
     const char* option_list[] = {
         "memory",
+        "mmap",
         "onetape",
         "optimize",
         "atomic",
@@ -409,6 +500,15 @@ namespace {
         "val_graph"
     };
     size_t num_option = sizeof(option_list) / sizeof( option_list[0] );
+    //
+    // is csv present on the command line
+    bool csv_output = false;
+    //
+    // stream used for the csv output (only used when csv_output is true)
+    std::ostream* csv_out = nullptr;
+    //
+    // number of times each size is timed when csv_output is true
+    const size_t n_sample = 3;
     // ----------------------------------------------------------------
     // not available test message
     void not_available_message(const char* test_name)
@@ -482,12 +582,49 @@ namespace {
         return ok;
     }
     // ----------------------------------------------------------------
+    // function that runs one speed case with csv output
+    void run_speed_csv(
+        double time_case(double time_min,  size_t size)  ,
+        const CppAD::vector<size_t>&        size_vec     ,
+        const std::string&                  case_name    )
+    {   double time_min = 1.;
+        std::string options = "";
+        for(size_t i = 0; i < num_option; i++)
+        {   std::string option = option_list[i];
+            if( global_option[option] )
+            {   if( options != "" )
+                    options += "_";
+                options += option;
+            }
+        }
+        for(size_t i = 0; i < size_vec.size(); i++)
+        {   for(size_t sample = 0; sample < n_sample; ++sample)
+            {   size_t size = size_vec[i];
+                double time = time_case(time_min, size);
+                double rate = 1. / time;
+                std::ostream& out = *csv_out;
+                out << AD_PACKAGE << "," << case_name << "," << options;
+                out << "," << size << "," << sample;
+                out << "," << std::setprecision(6) << rate;
+                out << "," << global_cppad_thread_alloc_inuse;
+                out << "," << global_cppad_tape_size;
+                out << "," << global_cppad_optimize_seconds;
+                out << endl;
+            }
+        }
+        return;
+    }
+    // ----------------------------------------------------------------
     // function that runs one speed case
     void run_speed(
         double time_case(double time_min,  size_t size)  ,
         const CppAD::vector<size_t>&        size_vec     ,
         const std::string&                  case_name    )
-    {   double time_min = 1.;
+    {   if( csv_output )
+        {   run_speed_csv(time_case, size_vec, case_name);
+            return;
+        }
+        double time_min = 1.;
         cout << case_name << "_size = ";
         output(size_vec);
         cout << endl;
@@ -524,10 +661,13 @@ int main(int argc, char *argv[])
         test_det_lu,
         test_det_minor,
         test_mat_mul,
+        test_mlp,
         test_ode,
         test_poly,
+        test_rk_horizon,
         test_sparse_hessian,
         test_sparse_jacobian,
+        test_stencil,
         test_error
     };
     struct test_struct {
@@ -540,10 +680,13 @@ int main(int argc, char *argv[])
         { "det_lu",             test_det_lu          },
         { "det_minor",          test_det_minor       },
         { "mat_mul",            test_mat_mul         },
+        { "mlp",                test_mlp             },
         { "ode",                test_ode             },
         { "poly",               test_poly            },
+        { "rk_horizon",         test_rk_horizon      },
         { "sparse_hessian",     test_sparse_hessian  },
-        { "sparse_jacobian",    test_sparse_jacobian }
+        { "sparse_jacobian",    test_sparse_jacobian },
+        { "stencil",            test_stencil         }
     };
     const size_t n_test  = sizeof(test_list) / sizeof(test_list[0]);
     //
@@ -564,7 +707,8 @@ int main(int argc, char *argv[])
         for(size_t i = 0; i < num_option; i++)
             global_option[ option_list[i] ] = false;
         for(size_t i = 3; i < size_t(argc); i++)
-        {   bool found = false;
+        {   bool found = strcmp(argv[i], "csv") == 0;
+            csv_output |= found;
             for(size_t j = 0; j < num_option; j++)
             {   if( strcmp(argv[i], option_list[j]) == 0 )
                 {   global_option[ option_list[j] ] = true;
@@ -576,7 +720,7 @@ int main(int argc, char *argv[])
     }
     if( error )
     {   cout << "usage: ./speed_"
-                 << AD_PACKAGE << " test seed option_list" << endl;
+                 << AD_PACKAGE << " test seed option_list [csv]" << endl;
         cout << "test choices:";
         for(size_t i = 0; i < n_test; i++)
         {   if( i % 5 == 0 )
@@ -599,21 +743,41 @@ int main(int argc, char *argv[])
     }
     if( global_option["memory"] )
         CppAD::thread_alloc::hold_memory(true);
+    if( global_option["mmap"] )
+        CppAD::thread_alloc::mmap_bytes( size_t(1) << 21 );
 
     // initialize the random number simulator
     // (may be re-initialized by sparse jacobain test)
     global_seed = size_t(iseed);
     CppAD::uniform_01(global_seed);
 
+    // csv_out
+    // If csv_output is true, standard output is only used for the csv
+    // results and all the other output is redirected to standard error.
+    std::ostream csv_stream( cout.rdbuf() );
+    if( csv_output )
+    {   csv_out = &csv_stream;
+        cout.rdbuf( std::cerr.rdbuf() );
+    }
+
+    // header for csv output
+    if( csv_output )
+    {   csv_stream << "package,test,option_list,size,sample,rate,";
+        csv_stream << "inuse,tape_size,optimize_seconds" << endl;
+    }
+
     // arguments needed for speed tests
     size_t n_size   = 5;
     CppAD::vector<size_t> size_det_lu(n_size);
     CppAD::vector<size_t> size_det_minor(n_size);
     CppAD::vector<size_t> size_mat_mul(n_size);
+    CppAD::vector<size_t> size_mlp(n_size);
     CppAD::vector<size_t> size_ode(n_size);
     CppAD::vector<size_t> size_poly(n_size);
+    CppAD::vector<size_t> size_rk_horizon(n_size);
     CppAD::vector<size_t> size_sparse_hessian(n_size);
     CppAD::vector<size_t> size_sparse_jacobian(n_size);
+    CppAD::vector<size_t> size_stencil(n_size);
     for(size_t i = 0; i < n_size; i++)
     {   size_det_minor[i]   =  i + 4;
         size_det_lu[i]      = 20 * i + 1;
@@ -622,6 +786,11 @@ int main(int argc, char *argv[])
         size_poly[i]        = 20 * i + 1;
         size_sparse_hessian[i]  = 250 * (i + 1) * (i + 1);
         size_sparse_jacobian[i] = 250 * (i + 1) * (i + 1);
+        //
+        // large scale tests: about 10^7 operations for the largest size
+        size_mlp[i]         = 100 * (i + 1);
+        size_rk_horizon[i]  = 20000 * (i + 1);
+        size_stencil[i]     = 200 * (i + 1);
     }
     switch(match)
     {
@@ -650,6 +819,15 @@ int main(int argc, char *argv[])
             correct_sparse_jacobian,
             "sparse_jacobian"
         );
+        ok &= run_correct(
+            available_mlp, correct_mlp, "mlp"
+        );
+        ok &= run_correct(
+            available_rk_horizon, correct_rk_horizon, "rk_horizon"
+        );
+        ok &= run_correct(
+            available_stencil, correct_stencil, "stencil"
+        );
         // summarize results
         assert( ok || (Run_error_count > 0) );
         if( ok )
@@ -685,6 +863,15 @@ int main(int argc, char *argv[])
         if( available_sparse_jacobian() ) run_speed(
         time_sparse_jacobian, size_sparse_jacobian, "sparse_jacobian"
         );
+        if( available_mlp() ) run_speed(
+            time_mlp,             size_mlp,             "mlp"
+        );
+        if( available_rk_horizon() ) run_speed(
+            time_rk_horizon,      size_rk_horizon,      "rk_horizon"
+        );
+        if( available_stencil() ) run_speed(
+            time_stencil,         size_stencil,         "stencil"
+        );
         ok = true;
         break;
         // ---------------------------------------------------------
@@ -807,6 +994,42 @@ int main(int argc, char *argv[])
         break;
         // ---------------------------------------------------------
 
+        case test_mlp:
+        if( ! available_mlp() )
+        {   not_available_message( argv[1] );
+            exit(1);
+        }
+        ok &= run_correct(
+            available_mlp, correct_mlp, "mlp"
+        );
+        run_speed(time_mlp, size_mlp, "mlp");
+        break;
+        // ---------------------------------------------------------
+
+        case test_rk_horizon:
+        if( ! available_rk_horizon() )
+        {   not_available_message( argv[1] );
+            exit(1);
+        }
+        ok &= run_correct(
+            available_rk_horizon, correct_rk_horizon, "rk_horizon"
+        );
+        run_speed(time_rk_horizon, size_rk_horizon, "rk_horizon");
+        break;
+        // ---------------------------------------------------------
+
+        case test_stencil:
+        if( ! available_stencil() )
+        {   not_available_message( argv[1] );
+            exit(1);
+        }
+        ok &= run_correct(
+            available_stencil, correct_stencil, "stencil"
+        );
+        run_speed(time_stencil, size_stencil, "stencil");
+        break;
+        // ---------------------------------------------------------
+
         default:
         assert(0);
     }
@@ -819,6 +1042,9 @@ int main(int argc, char *argv[])
     size_poly.clear();
     size_sparse_hessian.clear();
     size_sparse_jacobian.clear();
+    size_mlp.clear();
+    size_rk_horizon.clear();
+    size_stencil.clear();
     // check for memory leak
     if( CppAD::thread_alloc::free_all() )
     {   Run_ok_count++;
@@ -839,5 +1065,8 @@ int main(int argc, char *argv[])
         exit(1);
     }
     std::cout << "speed main: OK\n";
+    //
+    // restore standard output
+    cout.rdbuf( csv_stream.rdbuf() );
     return 0;
 }
@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+# include <cppad/utility/vector.hpp>
+# include <cppad/utility/near_equal.hpp>
+# include <cppad/utility/time_test.hpp>
+# include "mlp_loss.hpp"
+// BEGIN PROTOTYPE
+extern bool link_mlp(
+    const std::string&         job       ,
+    size_t                     size      ,
+    size_t                     repeat    ,
+    CppAD::vector<double>&     x         ,
+    CppAD::vector<double>&     gradient
+);
+// END PROTOTYPE
+/*
+-------------------------------------------------------------------------------
+{xrst_begin link_mlp}
+{xrst_spell
+    perceptron
+    tanh
+}
+
+Speed Testing Gradient of a Multilayer Perceptron Loss
+######################################################
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN PROTOTYPE
+    // END PROTOTYPE
+}
+
+Purpose
+*******
+This is a large scale test that is representative of training a
+dense neural network; i.e., the gradient of a loss function
+with respect to all of the weights and biases.
+
+Method
+******
+The same template function ``mlp_loss`` in the file
+``speed/src/mlp_loss.hpp`` is used by the different AD packages.
+
+f
+*
+We use :math:`w` for the value of *size* ,
+:math:`K = 10` for the number of data points, and
+:math:`n = 2 w^2 + 3 w` for the number of weights and biases.
+The argument :math:`x \in \B{R}^n` is partitioned as
+
+.. math::
+
+    x = ( W^1 , b^1 , W^2 , b^2 , v )
+
+where :math:`W^1 , W^2 \in \B{R}^{w \times w}` (in row major order)
+and :math:`b^1 , b^2 , v \in \B{R}^w` .
+For :math:`k = 0 , \ldots , K-1` , the input data
+:math:`a^k \in \B{R}^w` and target :math:`t_k \in \B{R}` are
+:math:`a_j^k = \cos ( k w + j )` and :math:`t_k = \sin(k)` .
+The loss function :math:`f : \B{R}^n \rightarrow \B{R}` is
+
+.. math::
+
+    f(x) = \frac{1}{K} \sum_{k=0}^{K-1}
+        \left[ v^\R{T} \tanh \left( W^2 \tanh( W^1 a^k + b^1 ) + b^2 \right)
+        - t_k \right]^2
+
+where :math:`\tanh` acts element-wise on a vector.
+The number of operations in the evaluation of :math:`f(x)`
+is about :math:`4 K w^2` .
+
+job
+***
+See the standard link specifications for :ref:`link_routines@job` .
+
+size
+****
+See the standard link specifications for :ref:`link_routines@size`
+In addition, *size* is the width :math:`w` of the hidden layers.
+
+repeat
+******
+See the standard link specifications for :ref:`link_routines@repeat` .
+
+x
+*
+The argument *x* is a vector with :math:`n` elements.
+The input value of its elements does not matter.
+The output value of its elements is the last argument that the
+gradient (or function) is computed for.
+
+gradient
+********
+The argument *gradient* is a vector with :math:`n` elements.
+The input value of its elements does not matter.
+The output value of its elements is the gradient of :math:`f(x)`
+at the output value of *x* .
+
+double
+======
+In the case where *package* is ``double`` ,
+only the first element of *gradient* is used and it is actually
+the function value :math:`f(x)` (the gradient value is not computed).
+
+{xrst_end link_mlp}
+-----------------------------------------------------------------------------
+*/
+// ---------------------------------------------------------------------------
+// The routines below are documented in dev_link.omh
+// ---------------------------------------------------------------------------
+namespace {
+    void time_mlp_callback(size_t size, size_t repeat)
+    {   std::string           job("run");
+        size_t                n = mlp_n_weight(size);
+        CppAD::vector<double> x(n);
+        CppAD::vector<double> gradient(n);
+        //
+        link_mlp(job, size, repeat, x, gradient);
+        return;
+    }
+}
+// ---------------------------------------------------------------------------
+bool available_mlp(void)
+{
+    size_t size   = 2;
+    size_t repeat = 0;
+    size_t n      = mlp_n_weight(size);
+    CppAD::vector<double> x(n);
+    CppAD::vector<double> gradient(n);
+    //
+    std::string job = "setup";
+    bool result = link_mlp(job, size, repeat, x, gradient);
+    //
+    job = "teardown";
+    link_mlp(job, size, repeat, x, gradient);
+    //
+    return result;
+}
+// ---------------------------------------------------------------------------
+bool correct_mlp(bool is_package_double)
+{   bool ok       = true;
+    size_t size   = 2;
+    size_t repeat = 1;
+    size_t n      = mlp_n_weight(size);
+    CppAD::vector<double> x(n);
+    CppAD::vector<double> gradient(n);
+    //
+    std::string job = "setup";
+    link_mlp(job, size, repeat, x, gradient);
+    //
+    job = "run";
+    link_mlp(job, size, repeat, x, gradient);
+    //
+    CppAD::vector<double> loss(1);
+    if( is_package_double )
+    {   mlp_loss<double>(size, x, loss);
+        ok &= CppAD::NearEqual(loss[0], gradient[0], 1e-10, 1e-10);
+    }
+    else
+    {   // check using central differences
+        double step = 1e-5;
+        CppAD::vector<double> x_step(x);
+        for(size_t j = 0; j < n; ++j)
+        {   x_step[j] = x[j] + step;
+            mlp_loss<double>(size, x_step, loss);
+            double check = loss[0];
+            x_step[j] = x[j] - step;
+            mlp_loss<double>(size, x_step, loss);
+            check     = (check - loss[0]) / (2.0 * step);
+            x_step[j] = x[j];
+            ok &= CppAD::NearEqual(check, gradient[j], 1e-6, 1e-6);
+        }
+    }
+    //
+    job = "teardown";
+    link_mlp(job, size, repeat, x, gradient);
+    //
+    return ok;
+}
+double time_mlp(double time_min, size_t size)
+{   CPPAD_ASSERT_UNKNOWN( size != 0 );
+    //
+    size_t                n = mlp_n_weight(size);
+    CppAD::vector<double> x(n);
+    CppAD::vector<double> gradient(n);
+    //
+    std::string job    = "setup";
+    size_t      repeat = 0;
+    link_mlp(job, size, repeat, x, gradient);
+    //
+    // job is run in time_mlp_callback
+    double time = CppAD::time_test(time_mlp_callback, time_min, size);
+    //
+    job = "teardown";
+    link_mlp(job, size, repeat, x, gradient);
+    //
+    return time;
+}
+// ---------------------------------------------------------------------------
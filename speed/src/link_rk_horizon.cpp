@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+# include <cppad/utility/vector.hpp>
+# include <cppad/utility/near_equal.hpp>
+# include <cppad/utility/time_test.hpp>
+# include "rk_horizon.hpp"
+// BEGIN PROTOTYPE
+extern bool link_rk_horizon(
+    const std::string&         job       ,
+    size_t                     size      ,
+    size_t                     repeat    ,
+    CppAD::vector<double>&     x         ,
+    CppAD::vector<double>&     gradient
+);
+// END PROTOTYPE
+/*
+-------------------------------------------------------------------------------
+{xrst_begin link_rk_horizon}
+{xrst_spell
+    kutta
+    lotka
+    volterra
+}
+
+Speed Testing Gradient of a Long Horizon Runge-Kutta Solution
+#############################################################
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN PROTOTYPE
+    // END PROTOTYPE
+}
+
+Purpose
+*******
+This is a large scale test where the operation sequence is very long
+and the number of independent variables is small; i.e.,
+the case where reverse mode has the most advantage and
+the tape memory is the largest relative to the input.
+
+Method
+******
+The same template function ``rk_horizon`` in the file
+``speed/src/rk_horizon.hpp`` is used by the different AD packages.
+
+f
+*
+The argument :math:`x \in \B{R}^4` defines the Lotka-Volterra equations
+
+.. math::
+
+    z(0) = \left( \begin{array}{c} x_0 \\ x_1 \end{array} \right)
+    \W{,}
+    z^{(1)} (t) = \left( \begin{array}{c}
+        x_2 z_0 (t) - z_0 (t) z_1 (t) \\
+        z_0 (t) z_1 (t) - x_3 z_1 (t)
+    \end{array} \right)
+
+We use :math:`N` for the value of *size* .
+The function :math:`f : \B{R}^4 \rightarrow \B{R}` is
+:math:`f(x) = z_0 (T) + z_1 (T)` where :math:`T = 10`
+and :math:`z(T)` is approximated using :math:`N` steps of the
+classical fourth order Runge-Kutta method.
+The number of operations in the evaluation of :math:`f(x)`
+is about :math:`50 N` .
+
+job
+***
+See the standard link specifications for :ref:`link_routines@job` .
+
+size
+****
+See the standard link specifications for :ref:`link_routines@size`
+In addition, *size* is the number of Runge-Kutta steps :math:`N` .
+
+repeat
+******
+See the standard link specifications for :ref:`link_routines@repeat` .
+
+x
+*
+The argument *x* is a vector with four elements.
+The input value of its elements does not matter.
+The output value of its elements is the last argument that the
+gradient (or function) is computed for.
+
+gradient
+********
+The argument *gradient* is a vector with four elements.
+The input value of its elements does not matter.
+The output value of its elements is the gradient of :math:`f(x)`
+at the output value of *x* .
+
+double
+======
+In the case where *package* is ``double`` ,
+only the first element of *gradient* is used and it is actually
+the function value :math:`f(x)` (the gradient value is not computed).
+
+{xrst_end link_rk_horizon}
+-----------------------------------------------------------------------------
+*/
+// ---------------------------------------------------------------------------
+// The routines below are documented in dev_link.omh
+// ---------------------------------------------------------------------------
+namespace {
+    void time_rk_horizon_callback(size_t size, size_t repeat)
+    {   std::string           job("run");
+        size_t                n = rk_horizon_n_x();
+        CppAD::vector<double> x(n);
+        CppAD::vector<double> gradient(n);
+        //
+        link_rk_horizon(job, size, repeat, x, gradient);
+        return;
+    }
+}
+// ---------------------------------------------------------------------------
+bool available_rk_horizon(void)
+{
+    size_t size   = 10;
+    size_t repeat = 0;
+    size_t n      = rk_horizon_n_x();
+    CppAD::vector<double> x(n);
+    CppAD::vector<double> gradient(n);
+    //
+    std::string job = "setup";
+    bool result = link_rk_horizon(job, size, repeat, x, gradient);
+    //
+    job = "teardown";
+    link_rk_horizon(job, size, repeat, x, gradient);
+    //
+    return result;
+}
+// ---------------------------------------------------------------------------
+bool correct_rk_horizon(bool is_package_double)
+{   bool ok       = true;
+    size_t size   = 10;
+    size_t repeat = 1;
+    size_t n      = rk_horizon_n_x();
+    CppAD::vector<double> x(n);
+    CppAD::vector<double> gradient(n);
+    //
+    std::string job = "setup";
+    link_rk_horizon(job, size, repeat, x, gradient);
+    //
+    job = "run";
+    link_rk_horizon(job, size, repeat, x, gradient);
+    //
+    CppAD::vector<double> y(1);
+    if( is_package_double )
+    {   rk_horizon<double>(size, x, y);
+        ok &= CppAD::NearEqual(y[0], gradient[0], 1e-10, 1e-10);
+    }
+    else
+    {   // check using central differences
+        double step = 1e-5;
+        CppAD::vector<double> x_step(x);
+        for(size_t j = 0; j < n; ++j)
+        {   x_step[j] = x[j] + step;
+            rk_horizon<double>(size, x_step, y);
+            double check = y[0];
+            x_step[j] = x[j] - step;
+            rk_horizon<double>(size, x_step, y);
+            check     = (check - y[0]) / (2.0 * step);
+            x_step[j] = x[j];
+            ok &= CppAD::NearEqual(check, gradient[j], 1e-6, 1e-6);
+        }
+    }
+    //
+    job = "teardown";
+    link_rk_horizon(job, size, repeat, x, gradient);
+    //
+    return ok;
+}
+double time_rk_horizon(double time_min, size_t size)
+{   CPPAD_ASSERT_UNKNOWN( size != 0 );
+    //
+    size_t                n = rk_horizon_n_x();
+    CppAD::vector<double> x(n);
+    CppAD::vector<double> gradient(n);
+    //
+    std::string job    = "setup";
+    size_t      repeat = 0;
+    link_rk_horizon(job, size, repeat, x, gradient);
+    //
+    // job is run in time_rk_horizon_callback
+    double time = CppAD::time_test(time_rk_horizon_callback, time_min, size);
+    //
+    job = "teardown";
+    link_rk_horizon(job, size, repeat, x, gradient);
+    //
+    return time;
+}
+// ---------------------------------------------------------------------------
@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+# include <cmath>
+# include <cppad/utility/vector.hpp>
+# include <cppad/utility/near_equal.hpp>
+# include <cppad/utility/time_test.hpp>
+# include "stencil_residual.hpp"
+// BEGIN PROTOTYPE
+extern bool link_stencil(
+    const std::string&         job       ,
+    size_t                     size      ,
+    size_t                     repeat    ,
+    CppAD::vector<double>&     x         ,
+    CppAD::vector<double>&     jacobian
+);
+// END PROTOTYPE
+/*
+-------------------------------------------------------------------------------
+{xrst_begin link_stencil}
+{xrst_spell
+    bratu
+}
+
+Speed Testing Sparse Jacobian of a Two Dimensional Stencil Residual
+###################################################################
+
+Prototype
+*********
+{xrst_literal
+    // BEGIN PROTOTYPE
+    // END PROTOTYPE
+}
+
+Purpose
+*******
+This is a large scale test that is representative of solving a
+partial differential equation using Newton's method; i.e.,
+the Jacobian of a finite difference residual is very sparse
+and has a regular structure.
+
+Method
+******
+The same template function ``stencil_residual`` in the file
+``speed/src/stencil_residual.hpp`` is used by the different AD packages.
+
+f
+*
+We use :math:`N` for the value of *size* , :math:`n = N^2` ,
+and :math:`u_{i,j} = x_{i N + j}` for :math:`i, j = 0 , \ldots , N-1` .
+The residual function :math:`f : \B{R}^n \rightarrow \B{R}^n`
+for the Bratu equation :math:`- \Delta u = \exp(u)` ,
+on the unit square with periodic boundary conditions, is
+
+.. math::
+
+    f_{i N + j} (x) = N^2 (
+        4 u_{i,j} - u_{i-1,j} - u_{i+1,j} - u_{i,j-1} - u_{i,j+1}
+    ) - \exp( u_{i,j} )
+
+where the indices :math:`i \pm 1` and :math:`j \pm 1` are modulo :math:`N` .
+The number of operations in the evaluation of :math:`f(x)`
+is about :math:`7 n` .
+
+job
+***
+See the standard link specifications for :ref:`link_routines@job` .
+The sparsity pattern for the Jacobian should be computed during the
+``setup`` job (when it is not known in advance for a package).
+
+size
+****
+See the standard link specifications for :ref:`link_routines@size`
+In addition, *size* is the number of grid points :math:`N`
+in each direction.
+It is greater than or equal three so that the five points in each
+stencil are distinct.
+
+repeat
+******
+See the standard link specifications for :ref:`link_routines@repeat` .
+
+x
+*
+The argument *x* is a vector with :math:`n` elements.
+The input value of its elements does not matter.
+The output value of its elements is the last argument that the
+Jacobian (or function) is computed for.
+
+jacobian
+********
+The argument *jacobian* is a vector with :math:`5 n` elements.
+The input value of its elements does not matter.
+For :math:`k = 0 , \ldots , n-1` , the output value of
+*jacobian* [ 5 * *k* + *ell* ] is the partial of
+:math:`f_k (x)` with respect to the *ell*-th point in its stencil:
+*ell* = 0 is :math:`u_{i,j}` , 1 is :math:`u_{i-1,j}` ,
+2 is :math:`u_{i+1,j}` , 3 is :math:`u_{i,j-1}` ,
+and 4 is :math:`u_{i,j+1}` where :math:`k = i N + j` .
+
+double
+======
+In the case where *package* is ``double`` ,
+only the first :math:`n` elements of *jacobian* are used and they are actually
+the function value :math:`f(x)` (the Jacobian is not computed).
+
+{xrst_end link_stencil}
+-----------------------------------------------------------------------------
+*/
+// ---------------------------------------------------------------------------
+// The routines below are documented in dev_link.omh
+// ---------------------------------------------------------------------------
+namespace {
+    void time_stencil_callback(size_t size, size_t repeat)
+    {   std::string           job("run");
+        size_t                n = size * size;
+        CppAD::vector<double> x(n);
+        CppAD::vector<double> jacobian(stencil_n_point() * n);
+        //
+        link_stencil(job, size, repeat, x, jacobian);
+        return;
+    }
+}
+// ---------------------------------------------------------------------------
+bool available_stencil(void)
+{
+    size_t size   = 4;
+    size_t repeat = 0;
+    size_t n      = size * size;
+    CppAD::vector<double> x(n);
+    CppAD::vector<double> jacobian(stencil_n_point() * n);
+    //
+    std::string job = "setup";
+    bool result = link_stencil(job, size, repeat, x, jacobian);
+    //
+    job = "teardown";
+    link_stencil(job, size, repeat, x, jacobian);
+    //
+    return result;
+}
+// ---------------------------------------------------------------------------
+bool correct_stencil(bool is_package_double)
+{   bool ok       = true;
+    size_t size   = 4;
+    size_t repeat = 1;
+    size_t n      = size * size;
+    CppAD::vector<double> x(n);
+    CppAD::vector<double> jacobian(stencil_n_point() * n);
+    //
+    std::string job = "setup";
+    link_stencil(job, size, repeat, x, jacobian);
+    //
+    job = "run";
+    link_stencil(job, size, repeat, x, jacobian);
+    //
+    double N_2 = double(size) * double(size);
+    if( is_package_double )
+    {   CppAD::vector<double> r(n);
+        stencil_residual<double>(size, x, r);
+        for(size_t k = 0; k < n; ++k)
+            ok &= CppAD::NearEqual(r[k], jacobian[k], 1e-10, 1e-10);
+    }
+    else
+    {   for(size_t k = 0; k < n; ++k)
+        {   size_t ell   = 0;
+            double check = 4.0 * N_2 - std::exp( x[k] );
+            ok &= CppAD::NearEqual(check, jacobian[5 * k + ell], 1e-10, 1e-10);
+            for(ell = 1; ell < stencil_n_point(); ++ell)
+            {   check = - N_2;
+                ok &= CppAD::NearEqual(
+                    check, jacobian[5 * k + ell], 1e-10, 1e-10
+                );
+            }
+        }
+    }
+    //
+    job = "teardown";
+    link_stencil(job, size, repeat, x, jacobian);
+    //
+    return ok;
+}
+double time_stencil(double time_min, size_t size)
+{   CPPAD_ASSERT_UNKNOWN( size >= 3 );
+    //
+    size_t                n = size * size;
+    CppAD::vector<double> x(n);
+    CppAD::vector<double> jacobian(stencil_n_point() * n);
+    //
+    std::string job    = "setup";
+    size_t      repeat = 0;
+    link_stencil(job, size, repeat, x, jacobian);
+    //
+    // job is run in time_stencil_callback
+    double time = CppAD::time_test(time_stencil_callback, time_min, size);
+    //
+    job = "teardown";
+    link_stencil(job, size, repeat, x, jacobian);
+    //
+    return time;
+}
+// ---------------------------------------------------------------------------
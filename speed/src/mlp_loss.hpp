@@ -0,0 +1,68 @@
+# ifndef CPPAD_SPEED_SRC_MLP_LOSS_HPP
+# define CPPAD_SPEED_SRC_MLP_LOSS_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+mlp_loss(size, x, loss)
+Loss function for a multilayer perceptron; see link_mlp for its definition.
+
+size: is the width of the hidden layers.
+x:    is the vector of weights and biases; see mlp_n_weight(size).
+loss: is a vector of size one, its element is set to the loss function value.
+*/
+# include <cmath>
+# include <cstddef>
+# include <cppad/utility/vector.hpp>
+
+// number of elements in x for a multilayer perceptron of width size
+inline size_t mlp_n_weight(size_t size)
+{   return 2 * size * size + 3 * size; }
+
+// number of data points used by the loss function
+inline size_t mlp_n_data(void)
+{   return 10; }
+
+template <class Float, class Vector>
+void mlp_loss(size_t size, const Vector& x, Vector& loss)
+{   using std::tanh;
+    using std::cos;
+    using std::sin;
+    size_t w = size;
+    //
+    // offsets in x for W1, b1, W2, b2, v
+    size_t W1 = 0;
+    size_t b1 = W1 + w * w;
+    size_t W2 = b1 + w;
+    size_t b2 = W2 + w * w;
+    size_t v  = b2 + w;
+    //
+    Float sum = Float(0.0);
+    CppAD::vector<Float> h1(w), h2(w);
+    for(size_t k = 0; k < mlp_n_data(); ++k)
+    {   // first hidden layer
+        for(size_t i = 0; i < w; ++i)
+        {   Float z = x[b1 + i];
+            for(size_t j = 0; j < w; ++j)
+                z += x[W1 + i * w + j] * cos( double(k * w + j) );
+            h1[i] = tanh(z);
+        }
+        // second hidden layer
+        for(size_t i = 0; i < w; ++i)
+        {   Float z = x[b2 + i];
+            for(size_t j = 0; j < w; ++j)
+                z += x[W2 + i * w + j] * h1[j];
+            h2[i] = tanh(z);
+        }
+        // output layer and squared residual
+        Float out = Float(0.0);
+        for(size_t i = 0; i < w; ++i)
+            out += x[v + i] * h2[i];
+        Float res = out - sin( double(k) );
+        sum      += res * res;
+    }
+    loss[0] = sum / double( mlp_n_data() );
+}
+
+# endif
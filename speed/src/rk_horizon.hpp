@@ -0,0 +1,63 @@
+# ifndef CPPAD_SPEED_SRC_RK_HORIZON_HPP
+# define CPPAD_SPEED_SRC_RK_HORIZON_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+rk_horizon(size, x, y)
+Fourth order Runge-Kutta solution of an ordinary differential equation
+over a long time horizon; see link_rk_horizon for its definition.
+
+size: is the number of Runge-Kutta steps.
+x:    is the vector ( z_0(0), z_1(0), a, b ).
+y:    is a vector of size one, its element is set to z_0(T) + z_1(T).
+*/
+# include <cstddef>
+
+// number of components in x
+inline size_t rk_horizon_n_x(void)
+{   return 4; }
+
+// final time T
+inline double rk_horizon_final_time(void)
+{   return 10.0; }
+
+template <class Float, class Vector>
+void rk_horizon(size_t size, const Vector& x, Vector& y)
+{   size_t n_step = size;
+    double dt     = rk_horizon_final_time() / double(n_step);
+    //
+    // Lotka-Volterra equations
+    // z_0'(t) = a * z_0(t) - z_0(t) * z_1(t)
+    // z_1'(t) = z_0(t) * z_1(t) - b * z_1(t)
+    Float a  = x[2];
+    Float b  = x[3];
+    Float z0 = x[0];
+    Float z1 = x[1];
+    for(size_t i_step = 0; i_step < n_step; ++i_step)
+    {   Float k1_0 = a * z0 - z0 * z1;
+        Float k1_1 = z0 * z1 - b * z1;
+        //
+        Float w0   = z0 + 0.5 * dt * k1_0;
+        Float w1   = z1 + 0.5 * dt * k1_1;
+        Float k2_0 = a * w0 - w0 * w1;
+        Float k2_1 = w0 * w1 - b * w1;
+        //
+        w0         = z0 + 0.5 * dt * k2_0;
+        w1         = z1 + 0.5 * dt * k2_1;
+        Float k3_0 = a * w0 - w0 * w1;
+        Float k3_1 = w0 * w1 - b * w1;
+        //
+        w0         = z0 + dt * k3_0;
+        w1         = z1 + dt * k3_1;
+        Float k4_0 = a * w0 - w0 * w1;
+        Float k4_1 = w0 * w1 - b * w1;
+        //
+        z0 += dt * (k1_0 + 2.0 * k2_0 + 2.0 * k3_0 + k4_0) / 6.0;
+        z1 += dt * (k1_1 + 2.0 * k2_1 + 2.0 * k3_1 + k4_1) / 6.0;
+    }
+    y[0] = z0 + z1;
+}
+
+# endif
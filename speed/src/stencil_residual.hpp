@@ -0,0 +1,67 @@
+# ifndef CPPAD_SPEED_SRC_STENCIL_RESIDUAL_HPP
+# define CPPAD_SPEED_SRC_STENCIL_RESIDUAL_HPP
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+/*
+stencil_residual(size, u, r)
+Residual for a finite difference approximation of a two dimensional
+partial differential equation; see link_stencil for its definition.
+
+size: is the number of grid points in each direction.
+u:    is the vector of size * size grid point values.
+r:    is the vector of size * size residual values.
+
+stencil_neighbor(size, k, ell)
+is the index of the ell-th point in the stencil for grid point k
+(ell = 0 is the point itself, 1 is west, 2 is east, 3 is south, 4 is north).
+*/
+# include <cmath>
+# include <cstddef>
+
+// number of points in the stencil
+inline size_t stencil_n_point(void)
+{   return 5; }
+
+inline size_t stencil_neighbor(size_t size, size_t k, size_t ell)
+{   size_t N = size;
+    size_t i = k / N;
+    size_t j = k % N;
+    switch( ell )
+    {   case 1:
+        i = (i + N - 1) % N;
+        break;
+
+        case 2:
+        i = (i + 1) % N;
+        break;
+
+        case 3:
+        j = (j + N - 1) % N;
+        break;
+
+        case 4:
+        j = (j + 1) % N;
+        break;
+
+        default:
+        break;
+    }
+    return i * N + j;
+}
+
+template <class Float, class Vector>
+void stencil_residual(size_t size, const Vector& u, Vector& r)
+{   using std::exp;
+    size_t N   = size;
+    double N_2 = double(N) * double(N);
+    for(size_t k = 0; k < N * N; ++k)
+    {   Float sum = 4.0 * u[k];
+        for(size_t ell = 1; ell < stencil_n_point(); ++ell)
+            sum -= u[ stencil_neighbor(size, k, ell) ];
+        r[k] = N_2 * sum - exp( u[k] );
+    }
+}
+
+# endif
@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+# include <cppad/cppad.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+    using CppAD::AD;
+    typedef CPPAD_TESTVECTOR(double)        d_vector;
+    typedef CPPAD_TESTVECTOR(float)         f_vector;
+    typedef CPPAD_TESTVECTOR( AD<double> )  ad_vector;
+    //
+    // eps99
+    const double eps99 = 99.0 * double( std::numeric_limits<float>::epsilon() );
+    //
+    // my_floor
+    double my_floor(const double& x)
+    {   return std::floor(x); }
+    CPPAD_DISCRETE_FUNCTION(double, my_floor)
+    //
+    // my_error_handler
+    void my_error_handler(
+        bool known           ,
+        int  line            ,
+        const char *file     ,
+        const char *exp      ,
+        const char *msg      )
+    {   // error handler must not return, so throw an exception
+        std::string message = msg;
+        throw message;
+    }
+    //
+    // base2float_error
+    // check that base2float reports an error for f
+    bool base2float_error(const CppAD::ADFun<double>& f)
+    {   // replace the default CppAD error handler
+        CppAD::ErrorHandler info(my_error_handler);
+        //
+        bool ok = false;
+        try
+        {   CppAD::ADFun<float> ff = f.base2float();
+        }
+        catch( std::string msg )
+        {   ok = msg.find("base2float:") != std::string::npos;
+        }
+        return ok;
+    }
+    // ------------------------------------------------------------------------
+    // discrete and atomic functions are not supported
+    bool not_supported(void)
+    {   bool ok = true;
+        //
+        // f: discrete function of a variable
+        ad_vector ax(1), ap(1), ay(1);
+        ax[0] = 1.5;
+        ap[0] = 2.5;
+        CppAD::Independent(ax);
+        ay[0] = my_floor( ax[0] ) * ax[0];
+        CppAD::ADFun<double> f(ax, ay);
+        ok &= base2float_error(f);
+        //
+        // f: discrete function of a dynamic parameter
+        CppAD::Independent(ax, ap);
+        ay[0] = my_floor( ap[0] ) * ax[0];
+        f.Dependent(ax, ay);
+        ok &= base2float_error(f);
+        //
+        // g: atomic function
+        CppAD::Independent(ax);
+        ay[0] = sin( ax[0] );
+        CppAD::ADFun<double> g_fun(ax, ay);
+        bool internal_bool    = false;
+        bool use_hes_sparsity = false;
+        bool use_base2ad      = false;
+        bool use_in_parallel  = false;
+        CppAD::chkpoint_two<double> g(g_fun, "g",
+            internal_bool, use_hes_sparsity, use_base2ad, use_in_parallel
+        );
+        CppAD::Independent(ax);
+        g(ax, ay);
+        f.Dependent(ax, ay);
+        ok &= base2float_error(f);
+        //
+        return ok;
+    }
+    // ------------------------------------------------------------------------
+    // dynamic parameters
+    bool dynamic(void)
+    {   bool ok = true;
+        //
+        // f
+        ad_vector ax(1), ap(2), ay(2);
+        ax[0] = 0.5;
+        ap[0] = 1.0;
+        ap[1] = 2.0;
+        CppAD::Independent(ax, ap);
+        AD<double> aq = exp( ap[0] ) * ap[1];
+        ay[0] = aq * sin( ax[0] );
+        ay[1] = aq + ap[1] * ax[0];
+        CppAD::ADFun<double> f(ax, ay);
+        //
+        // ff
+        CppAD::ADFun<float> ff = f.base2float();
+        ok &= ff.size_dyn_ind() == f.size_dyn_ind();
+        //
+        // check zero order forward for two values of the dynamic parameters
+        for(size_t k = 0; k < 2; ++k)
+        {   d_vector p(2), x(1), y;
+            f_vector pf(2), xf(1), yf;
+            pf[0] = float(k + 1) / 4.0f;
+            pf[1] = float(k + 3) / 4.0f;
+            xf[0] = 0.75f;
+            p[0]  = double( pf[0] );
+            p[1]  = double( pf[1] );
+            x[0]  = double( xf[0] );
+            f.new_dynamic(p);
+            ff.new_dynamic(pf);
+            y  = f.Forward(0, x);
+            yf = ff.Forward(0, xf);
+            for(size_t i = 0; i < 2; ++i)
+                ok &= CppAD::NearEqual( double(yf[i]), y[i], eps99, eps99);
+        }
+        return ok;
+    }
+    // ------------------------------------------------------------------------
+    // comparison operators
+    bool compare(void)
+    {   bool ok = true;
+        //
+        // f
+        ad_vector ax(2), ay(1);
+        ax[0] = 0.0;
+        ax[1] = 1.0;
+        CppAD::Independent(ax);
+        if( ax[0] < ax[1] )
+            ay[0] = ax[0];
+        else
+            ay[0] = ax[1];
+        CppAD::ADFun<double> f(ax, ay);
+        //
+        // ff
+        CppAD::ADFun<float> ff = f.base2float();
+        //
+        // same comparison result
+        f_vector xf(2), yf;
+        xf[0] = 1.0f;
+        xf[1] = 2.0f;
+        yf    = ff.Forward(0, xf);
+        ok   &= yf[0] == 1.0f;
+        ok   &= ff.compare_change_number() == 0;
+        //
+        // different comparison result
+        xf[0] = 3.0f;
+        yf    = ff.Forward(0, xf);
+        ok   &= yf[0] == 3.0f;
+        ok   &= ff.compare_change_number() == 1;
+        ok   &= ff.compare_change_op_index() > 0;
+        //
+        // compare_change_count is copied from f
+        f.compare_change_count(0);
+        ff    = f.base2float();
+        yf    = ff.Forward(0, xf);
+        ok   &= ff.compare_change_number() == 0;
+        //
+        return ok;
+    }
+    // ------------------------------------------------------------------------
+    // n_task_total
+    size_t n_task_total = 0;
+    //
+    // reverse_for
+    // executes the tasks in reverse order to check that the order does not
+    // matter
+    void reverse_for(
+        size_t n_task, void (*task)(size_t i_task, void* info), void* info
+    )
+    {   size_t i_task = n_task;
+        while( i_task-- )
+        {   task(i_task, info);
+            ++n_task_total;
+        }
+    }
+    //
+    // parallel_for
+    bool parallel_for(void)
+    {   bool ok = true;
+        //
+        // f
+        size_t n = 1000;
+        ad_vector ax(n), ay(n);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = 0.0;
+        CppAD::Independent(ax);
+        for(size_t i = 0; i < n; ++i)
+        {   size_t ip1 = (i + 1) % n;
+            ay[i] = exp( ax[i] ) * cos( ax[ip1] ) + ax[i] * ax[i];
+        }
+        CppAD::ADFun<double> f(ax, ay);
+        //
+        // ff, gg
+        // ff uses parallel_for and gg does not
+        CppAD::ADFun<float> ff = f.base2float();
+        CppAD::ADFun<float> gg = f.base2float();
+        ff.parallel_for(reverse_for);
+        ff.parallel_reverse("deterministic");
+        //
+        // xf, wf
+        f_vector xf(n), wf(n);
+        for(size_t j = 0; j < n; ++j)
+        {   xf[j] = float(j) / float(n);
+            wf[j] = 1.0f;
+        }
+        //
+        // check zero order forward
+        n_task_total     = 0;
+        f_vector yf      = ff.Forward(0, xf);
+        f_vector check   = gg.Forward(0, xf);
+        ok &= n_task_total > 0;
+        for(size_t i = 0; i < n; ++i)
+            ok &= CppAD::IdenticalEqualCon(yf[i], check[i]);
+        //
+        // check first order reverse
+        n_task_total     = 0;
+        f_vector dwf     = ff.Reverse(1, wf);
+        check            = gg.Reverse(1, wf);
+        ok &= n_task_total > 0;
+        for(size_t j = 0; j < n; ++j)
+            ok &= CppAD::IdenticalEqualCon(dwf[j], check[j]);
+        //
+        return ok;
+    }
+} // END_EMPTY_NAMESPACE
+
+bool base2float(void)
+{   bool ok = true;
+    ok     &= not_supported();
+    ok     &= dynamic();
+    ok     &= compare();
+    ok     &= parallel_for();
+    return ok;
+}
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 /*
 @begin graph_unary_op.cpp$$
@@ -102,6 +102,41 @@ bool test_unary_fun(unary_fun_t fun, CppAD::graph::graph_op_enum op_enum)
     return ok;
 }
 
+// comparison between a variable and a constant
+bool test_compare_constant(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    CPPAD_TESTVECTOR( AD<double> ) ax(1), ay(1);
+    ax[0] = 1.0;
+    CppAD::Independent(ax);
+    if( ax[0] < 2.0 )
+        ay[0] = 3.0 * ax[0];
+    else
+        ay[0] = 4.0 * ax[0];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // g is f converted to a graph and back
+    CppAD::cpp_graph graph_obj;
+    f.to_graph(graph_obj);
+    CppAD::ADFun<double> g;
+    g.from_graph(graph_obj);
+    //
+    // comparison has same result as during recording
+    CPPAD_TESTVECTOR(double) x(1), y(1);
+    x[0] = 1.5;
+    y    = g.Forward(0, x);
+    ok  &= y[0] == 3.0 * x[0];
+    ok  &= g.compare_change_number() == 0;
+    //
+    // comparison has different result
+    x[0] = 2.5;
+    y    = g.Forward(0, x);
+    ok  &= g.compare_change_number() == 1;
+    //
+    return ok;
+}
+
 double sign(double x)
 {   return CppAD::sign(x);
 }
@@ -132,6 +167,7 @@ bool cpp_graph(void)
     ok     &= test_unary_fun(std::acosh,  CppAD::graph::acosh_graph_op);
     ok     &= test_unary_fun(std::acosh,  CppAD::graph::acosh_graph_op);
     ok     &= test_unary_fun(std::sin,    CppAD::graph::sin_graph_op);
+    ok     &= test_compare_constant();
     //
     return ok;
 }
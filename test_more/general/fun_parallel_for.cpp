@@ -0,0 +1,268 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+# include <cppad/cppad.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+
+typedef CPPAD_TESTVECTOR(double)                d_vector;
+typedef CPPAD_TESTVECTOR( CppAD::AD<double> )   ad_vector;
+//
+// n_task_total
+size_t n_task_total = 0;
+//
+// reverse_for
+// executes the tasks in reverse order to check that the order does not matter
+void reverse_for(
+    size_t n_task, void (*task)(size_t i_task, void* info), void* info
+)
+{   size_t i_task = n_task;
+    while( i_task-- )
+    {   task(i_task, info);
+        ++n_task_total;
+    }
+}
+//
+// check_same
+// check that f, with parallel_for, and a copy of f, without it,
+// have the same zero order results
+bool check_same(CppAD::ADFun<double>& f, const d_vector& x)
+{   bool ok = true;
+    CppAD::ADFun<double> g;
+    g = f;
+    g.parallel_for(nullptr);
+    f.parallel_for(reverse_for);
+    d_vector y     = f.Forward(0, x);
+    d_vector check = g.Forward(0, x);
+    for(size_t i = 0; i < y.size(); ++i)
+        ok &= CppAD::IdenticalEqualCon(y[i], check[i]);
+    ok &= f.compare_change_number() == g.compare_change_number();
+    ok &= f.compare_change_op_index() == g.compare_change_op_index();
+    return ok;
+}
+//
+// check_reverse
+// check that f, with parallel_for and parallel_reverse(mode), and a copy of f,
+// without them, have the same first order reverse results
+bool check_reverse(
+    CppAD::ADFun<double>& f    ,
+    const d_vector&       x    ,
+    const d_vector&       w    ,
+    const std::string&    mode )
+{   bool ok = true;
+    CppAD::ADFun<double> g;
+    g = f;
+    g.parallel_for(nullptr);
+    f.parallel_for(reverse_for);
+    f.parallel_reverse(mode);
+    f.Forward(0, x);
+    g.Forward(0, x);
+    d_vector dw    = f.Reverse(1, w);
+    d_vector check = g.Reverse(1, w);
+    double   eps   = 100. * std::numeric_limits<double>::epsilon();
+    for(size_t j = 0; j < dw.size(); ++j)
+    {   if( mode == "accumulate" )
+            ok &= CppAD::NearEqual(dw[j], check[j], eps, eps);
+        else
+        {   // requires -ffp-contract=off; see test_more/general/CMakeLists.txt
+            ok &= CppAD::IdenticalEqualCon(dw[j], check[j]);
+        }
+    }
+    return ok;
+}
+// ----------------------------------------------------------------------------
+// wide function with many different operators and dynamic parameters
+bool many_operators(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    size_t n = 1000;
+    ad_vector ax(n), ap(1), ay(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = 0.5 + double(j) / double(2 * n);
+    ap[0] = 2.0;
+    CppAD::Independent(ax, ap);
+    for(size_t i = 0; i < n; ++i)
+    {   AD<double> u = ax[i];
+        AD<double> v = ax[ (i + 1) % n ];
+        AD<double> w = CppAD::CondExpLt(u, v, exp(u) / v, log(v) - u);
+        w           += pow(u, v) + pow(u, ap[0]) + erf(v) * ap[0];
+        w           += CppAD::azmul(u, sqrt(v)) + atan(u) - tanh(v);
+        ay[i]        = w;
+    }
+    // comparisons between variables and parameters
+    if( ax[0] < ax[1] )
+        ay[0] += 1.0;
+    if( ax[2] > ap[0] )
+        ay[1] += 1.0;
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // x
+    d_vector x(n);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = 0.25 + double(j) / double(n);
+    //
+    // check_same
+    size_t n_task = n_task_total;
+    ok &= check_same(f, x);
+    ok &= n_task < n_task_total;
+    //
+    // change the result of the first comparison
+    x[0]   = 2.0;
+    n_task = n_task_total;
+    ok    &= check_same(f, x);
+    ok    &= f.compare_change_number() == 1;
+    ok    &= n_task < n_task_total;
+    //
+    // optimize creates cumulative summations for the sums above
+    f.optimize("no_conditional_skip");
+    n_task = n_task_total;
+    ok    &= check_same(f, x);
+    ok    &= n_task < n_task_total;
+    //
+    // change a dynamic parameter so only some operators are evaluated
+    d_vector p(1);
+    p[0] = 3.0;
+    f.new_dynamic(p);
+    CppAD::ADFun<double> g;
+    g = f;
+    g.parallel_for(nullptr);
+    f.parallel_for(reverse_for);
+    n_task         = n_task_total;
+    d_vector y     = f.Forward(0, x);
+    d_vector check = g.Forward(0, x);
+    for(size_t i = 0; i < n; ++i)
+        ok &= CppAD::IdenticalEqualCon(y[i], check[i]);
+    ok &= n_task < n_task_total;
+    //
+    return ok;
+}
+// ----------------------------------------------------------------------------
+// first order reverse where some variables are used by many operators
+bool reverse_shared(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    size_t n = 1000;
+    ad_vector ax(n), ap(1), ay(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = 0.5 + double(j) / double(2 * n);
+    ap[0] = 2.0;
+    CppAD::Independent(ax, ap);
+    for(size_t i = 0; i < n; ++i)
+    {   AD<double> u = ax[i];
+        AD<double> v = ax[ (i + 1) % n ];
+        AD<double> d = u - v;
+        AD<double> z = d * d;
+        //
+        // ax[0] is used by every residual, u and v are used twice by one
+        // operator, and z is an argument to pow(z, 2.5)
+        AD<double> w = CppAD::CondExpLt(u, v, exp(u) / v, log(v) - u);
+        w           += u * u + pow(v, v) + pow(exp(u), ap[0]) + ax[0] * v;
+        w           += CppAD::azmul(z, z) + pow(z, 2.5) + z * sin(u);
+        ay[i]        = w;
+    }
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // x, w
+    // x[3] == x[4] so z == 0 for the case i = 3
+    d_vector x(n), w(n);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = 0.25 + double(j) / double(n);
+    x[3] = x[4];
+    for(size_t i = 0; i < n; ++i)
+        w[i] = 1.0 + double(i) / double(n);
+    //
+    // check_reverse
+    // switching the mode recomputes the reverse levels
+    const char* mode_list[] =
+        { "deterministic", "accumulate", "deterministic" };
+    for(size_t k = 0; k < 3; ++k)
+    {   size_t n_task = n_task_total;
+        ok    &= check_reverse(f, x, w, mode_list[k]);
+        ok    &= n_task < n_task_total;
+    }
+    //
+    // optimize creates cumulative summations for the sums above
+    f.optimize("no_conditional_skip");
+    for(size_t k = 0; k < 2; ++k)
+    {   size_t n_task = n_task_total;
+        ok    &= check_reverse(f, x, w, mode_list[k]);
+        ok    &= n_task < n_task_total;
+    }
+    //
+    // mode none (zero order forward still uses tasks)
+    ok &= check_reverse(f, x, w, "none");
+    //
+    return ok;
+}
+// ----------------------------------------------------------------------------
+// narrow function, the tasks are not used
+bool narrow(void)
+{   bool ok = true;
+    size_t n = 2;
+    ad_vector ax(n), ay(1);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+    CppAD::Independent(ax);
+    ay[0] = ax[0];
+    for(size_t k = 0; k < 2000; ++k)
+        ay[0] = sin( ay[0] ) + ax[1];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    d_vector x(n);
+    x[0] = 0.25;
+    x[1] = 0.75;
+    d_vector w(1);
+    w[0] = 1.0;
+    size_t n_task = n_task_total;
+    ok &= check_same(f, x);
+    ok &= check_reverse(f, x, w, "deterministic");
+    ok &= n_task == n_task_total;
+    //
+    return ok;
+}
+// ----------------------------------------------------------------------------
+// function with VecAD operators, the tasks are not used
+bool vecad(void)
+{   bool ok = true;
+    using CppAD::AD;
+    size_t n = 1000;
+    ad_vector ax(n), ay(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j) / double(n);
+    CppAD::Independent(ax);
+    CppAD::VecAD<double> av(2);
+    av[ AD<double>(0) ] = ax[0];
+    av[ AD<double>(1) ] = ax[1];
+    for(size_t i = 0; i < n; ++i)
+        ay[i] = exp( ax[i] ) * av[ AD<double>(i % 2) ];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    d_vector x(n);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = 1.0 / double(j + 1);
+    d_vector w(n);
+    for(size_t i = 0; i < n; ++i)
+        w[i] = 1.0;
+    size_t n_task = n_task_total;
+    ok &= check_same(f, x);
+    ok &= check_reverse(f, x, w, "accumulate");
+    ok &= n_task == n_task_total;
+    //
+    return ok;
+}
+
+} // END_EMPTY_NAMESPACE
+
+// ----------------------------------------------------------------------------
+bool fun_parallel_for(void)
+{   bool ok = true;
+    ok     &= many_operators();
+    ok     &= reverse_shared();
+    ok     &= narrow();
+    ok     &= vecad();
+    //
+    return ok;
+}
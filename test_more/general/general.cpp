@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 // CPPAD_HAS_* defines
@@ -42,6 +42,7 @@ extern bool PowInt(void);
 extern bool RevTwo(void);
 extern bool RombergOne(void);
 extern bool Rosen34(void);
+extern bool Rosen34Sparse(void);
 extern bool Runge45(void);
 extern bool SimpleVector(void);
 extern bool Sin(void);
@@ -70,6 +71,7 @@ extern bool atomic_four(void);
 extern bool atomic_three(void);
 extern bool azmul(void);
 extern bool base2ad(void);
+extern bool base2float(void);
 extern bool base_adolc(void);
 extern bool base_alloc_test(void);
 extern bool base_complex(void);
@@ -93,6 +95,7 @@ extern bool for_hes_sparsity(void);
 extern bool for_jac_sparsity(void);
 extern bool forward_dir(void);
 extern bool forward_order(void);
+extern bool fun_parallel_for(void);
 extern bool hes_sparsity(void);
 extern bool ipopt_solve(void);
 extern bool jacobian(void);
@@ -118,6 +121,7 @@ extern bool sparse_jac_work(void);
 extern bool sparse_jacobian(void);
 extern bool sparse_sub_hes(void);
 extern bool sparse_vec_ad(void);
+extern bool sparsity_cache(void);
 extern bool std_math(void);
 extern bool subgraph_1(void);
 extern bool subgraph_2(void);
@@ -169,6 +173,7 @@ int main(void)
     Run( RevTwo,          "RevTwo"         );
     Run( RombergOne,      "RombergOne"     );
     Run( Rosen34,         "Rosen34"        );
+    Run( Rosen34Sparse,   "Rosen34Sparse"  );
     Run( Runge45,         "Runge45"        );
     Run( SimpleVector,    "SimpleVector"   );
     Run( Sin,             "Sin"            );
@@ -196,6 +201,7 @@ int main(void)
     Run( atomic_three,    "atomic_three"   );
     Run( azmul,           "azmul"          );
     Run( base2ad,         "base2ad"        );
+    Run( base2float,      "base2float"     );
     Run( base_complex,    "base_complex"   );
     Run( bool_sparsity,   "bool_sparsity"  );
     Run( check_simple_vector, "check_simple_vector" );
@@ -215,6 +221,7 @@ int main(void)
     Run( for_jac_sparsity, "for_jac_sparsity" );
     Run( forward_dir,     "forward_dir"    );
     Run( forward_order,   "forward_order"  );
+    Run( fun_parallel_for, "fun_parallel_for" );
     Run( hes_sparsity,    "hes_sparsity"   );
     Run( jacobian,        "jacobian"       );
     Run( json_graph,      "json_graph"     );
@@ -239,6 +246,7 @@ int main(void)
     Run( sparse_jacobian, "sparse_jacobian");
     Run( sparse_sub_hes,  "sparse_sub_hes" );
     Run( sparse_vec_ad,   "sparse_vec_ad"  );
+    Run( sparsity_cache,  "sparsity_cache" );
     Run( std_math,        "std_math"       );
     Run( subgraph_1,      "subgraph_1"     );
     Run( subgraph_2,      "subgraph_2"     );
@@ -1,7 +1,8 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-22 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
+# include <sstream>
 # include <cppad/cppad.hpp>
 
 namespace { // BEGIN_EMPTY_NAMESPACE
@@ -2541,6 +2542,53 @@ bool cumulative_sum(void)
     return ok;
 }
 // ---------------------------------------------------------------------------
+// Test reading a graph that is larger than one stream chunk
+bool stream_chunks(void)
+{   bool ok   = true;
+    using CppAD::AD;
+    //
+    size_t nx = 100;
+    size_t ny = 1;
+    CPPAD_TESTVECTOR(double)       x(nx);
+    CPPAD_TESTVECTOR( AD<double> ) ax(nx), ay(ny);
+    for(size_t i = 0; i < nx; ++i)
+    {   ax[i] = 0.5;
+        x[i]  = double(i + 1) / double(nx);
+    }
+    CppAD::Independent(ax);
+    //
+    // constants with exponents and signs
+    AD<double> asum = 0.0;
+    for(size_t k = 0; k < 50; ++k)
+    {   for(size_t i = 0; i < nx; ++i)
+        {   double c = double(k + 1) * 1e-7 - double(i) * 3e+5;
+            asum += c * sin( ax[i] + double(k) );
+        }
+    }
+    ay[0] = asum;
+    //
+    // Create function
+    CppAD::ADFun<double> f(ax, ay);
+    CPPAD_TESTVECTOR(double) y_before = f.Forward(0, x);
+    //
+    // Json for this function is more than one chunk
+    std::string json = f.to_json();
+    ok &= json.size() > 4 * 65536;
+    //
+    // Read it from a stream
+    std::istringstream is(json);
+    CppAD::ADFun<double> g;
+    g.from_json(is);
+    CPPAD_TESTVECTOR(double) y_after = g.Forward(0, x);
+    //
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    for(size_t i = 0; i < ny; ++i)
+        ok &= CppAD::NearEqual( y_before[i], y_after[i], eps99, eps99 );
+    ok &= f.size_var() == g.size_var();
+    //
+    return ok;
+}
+// ---------------------------------------------------------------------------
 // Test unary operators
 bool unary(bool p_first)
 {   bool ok   = true;
@@ -2660,6 +2708,7 @@ bool json_graph(void)
     ok     &= to_json_and_back();
     ok     &= binary_operators();
     ok     &= cumulative_sum();
+    ok     &= stream_chunks();
     ok     &= unary(true);
     ok     &= unary(false);
     //
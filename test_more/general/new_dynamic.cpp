@@ -1,7 +1,7 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
-// SPDX-FileContributor: 2003-25 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 # include <limits>
@@ -912,6 +912,112 @@ bool dynamic_optimize(void)
     return ok;
 }
 
+// ----------------------------------------------------------------------------
+// count_eval
+size_t count_eval_number = 0;
+double count_eval(const double& x)
+{   ++count_eval_number;
+    return 2.0 * x;
+}
+CPPAD_DISCRETE_FUNCTION(double, count_eval)
+//
+bool dynamic_incremental(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    // f(x) = [ count_eval(x[0]) * count_eval( dynamic[0] ) ,
+    //          count_eval( x[1] + count_eval( dynamic[1] ) ) ,
+    //          x[0] * dynamic[0] ]
+    size_t nx = 2, nd = 2, ny = 3;
+    ADvector ax(nx), adynamic(nd), ay(ny);
+    for(size_t j = 0; j < nx; ++j)
+        ax[j] = double(j + 1);
+    for(size_t j = 0; j < nd; ++j)
+        adynamic[j] = double(j + 3);
+    size_t abort_op_index = 0;
+    bool   record_compare = true;
+    Independent(ax, abort_op_index, record_compare, adynamic);
+    ay[0] = count_eval( ax[0] ) * count_eval( adynamic[0] );
+    ay[1] = count_eval( ax[1] + count_eval( adynamic[1] ) );
+    ay[2] = ax[0] * adynamic[0];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // x, dynamic
+    CPPAD_TESTVECTOR(double) x(nx), y(ny), dynamic(nd);
+    for(size_t j = 0; j < nx; ++j)
+        x[j] = double(j + 1);
+    for(size_t j = 0; j < nd; ++j)
+        dynamic[j] = double(j + 3);
+    //
+    // check_y
+    auto check_y = [&]()
+    {   bool result = true;
+        double check = 2.0 * x[0] * 2.0 * dynamic[0];
+        result &= NearEqual(y[0], check, eps99, eps99);
+        check = 2.0 * ( x[1] + 2.0 * dynamic[1] );
+        result &= NearEqual(y[1], check, eps99, eps99);
+        check = x[0] * dynamic[0];
+        result &= NearEqual(y[2], check, eps99, eps99);
+        return result;
+    };
+    //
+    // change dynamic[0]: one dynamic and no variable count_eval
+    size_t count = count_eval_number;
+    dynamic[0] = 5.0;
+    f.new_dynamic(dynamic);
+    ok &= count_eval_number == count + 1;
+    y   = f.Forward(0, x);
+    ok &= count_eval_number == count + 1;
+    ok &= check_y();
+    //
+    // change dynamic[1]: one dynamic and one variable count_eval
+    count = count_eval_number;
+    dynamic[1] = 6.0;
+    f.new_dynamic(dynamic);
+    ok &= count_eval_number == count + 1;
+    y   = f.Forward(0, x);
+    ok &= count_eval_number == count + 2;
+    ok &= check_y();
+    //
+    // same values: no count_eval
+    count = count_eval_number;
+    f.new_dynamic(dynamic);
+    y   = f.Forward(0, x);
+    ok &= count_eval_number == count;
+    ok &= check_y();
+    //
+    // change dynamic[0] and x[1]: one dynamic and one variable count_eval
+    count = count_eval_number;
+    dynamic[0] = 7.0;
+    f.new_dynamic(dynamic);
+    x[1] = 8.0;
+    y   = f.Forward(0, x);
+    ok &= count_eval_number == count + 2;
+    ok &= check_y();
+    //
+    // no call to new_dynamic: all variable count_eval
+    count = count_eval_number;
+    y   = f.Forward(0, x);
+    ok &= count_eval_number == count + 2;
+    ok &= check_y();
+    //
+    // derivatives use the zero order results
+    CPPAD_TESTVECTOR(double) dx(nx), dy(ny);
+    dynamic[1] = 9.0;
+    f.new_dynamic(dynamic);
+    y     = f.Forward(0, x);
+    ok   &= check_y();
+    dx[0] = 1.0;
+    dx[1] = 0.0;
+    dy    = f.Forward(1, dx);
+    ok   &= dy[0] == 0.0;
+    ok   &= dy[1] == 0.0;
+    ok   &= NearEqual(dy[2], dynamic[0], eps99, eps99);
+    //
+    return ok;
+}
 
 } // END_EMPTY_NAMESPACE
 
@@ -927,6 +1033,7 @@ bool new_dynamic(void)
     ok     &= dynamic_atomic();
     ok     &= dynamic_discrete();
     ok     &= dynamic_optimize();
+    ok     &= dynamic_incremental();
     //
     return ok;
 }
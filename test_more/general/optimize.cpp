@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 // 2DO: Test that optimize.hpp use of atomic_base<Base>::rev_sparse_jac works.
 
@@ -2196,6 +2196,62 @@ namespace {
         return ok;
     }
 
+    // -----------------------------------------------------------------------
+    // Test case where each case of a conditional expression is a long
+    // block of consecutive operators (so the sweeps jump over the block).
+    bool cond_exp_skip_block(void)
+    {   bool ok = true;
+        using CppAD::vector;
+        using CppAD::AD;
+        using CppAD::NearEqual;
+        double eps10 = 10.0 * std::numeric_limits<double>::epsilon();
+
+        // f(x) = x_0 * ( x_0 < 0 ? t(x_1) : s(x_1) )
+        vector< AD<double> > ax(2), ay(1);
+        ax[0] = 1.0;
+        ax[1] = 2.0;
+        Independent(ax);
+        AD<double> t = ax[1];
+        AD<double> s = ax[1];
+        for(size_t i = 0; i < 20; ++i)
+        {   t = sin(t) + ax[1];
+            s = cos(s) * ax[1];
+        }
+        AD<double> zero = 0.0;
+        AD<double> cexp = CondExpLt(ax[0], zero, t, s);
+        ay[0] = ax[0] * cexp;
+        CppAD::ADFun<double> f(ax, ay), g;
+        g = f;
+
+        // optimize
+        optimize_with_options(f);
+
+        // compare the optimized and original functions for both cases
+        vector<double> x(2), dx(2), w(1), dw(4), check(4);
+        for(size_t k = 0; k < 4; ++k)
+        {   x[0] = 1.0;
+            if( k % 2 == 1 )
+                x[0] = -1.0;
+            x[1]  = 0.5 + double(k);
+            dx[0] = 0.3;
+            dx[1] = 1.0;
+            w[0]  = 2.0;
+            //
+            ok   &= NearEqual(f.Forward(0, x)[0], g.Forward(0, x)[0],
+                eps10, eps10
+            );
+            ok   &= NearEqual(f.Forward(1, dx)[0], g.Forward(1, dx)[0],
+                eps10, eps10
+            );
+            dw    = f.Reverse(2, w);
+            check = g.Reverse(2, w);
+            for(size_t j = 0; j < 4; ++j)
+                ok &= NearEqual(dw[j], check[j], eps10, eps10);
+        }
+        if( conditional_skip_ && ! use_val_optimize_ )
+            ok &= f.number_skip() > 0;
+        return ok;
+    }
     // -----------------------------------------------------------------------
     // Test case where if_false case is not used by conditional expression
     // but is use after conditional expression.
@@ -2413,6 +2469,43 @@ namespace {
         }
         return ok;
     }
+    // ----------------------------------------------------------------
+    // Test optimizing a cumulative summation that was recorded with
+    // dynamic parameter arguments
+    bool csum_dynamic_argument(void)
+    {   bool ok = true;
+        using CppAD::AD;
+        using CppAD::NearEqual;
+        double eps10 = 10.0 * std::numeric_limits<double>::epsilon();
+        using CppAD::vector;
+
+        // independent variable and dynamic parameter vectors
+        vector< AD<double> > ax(3), ap(2), ay(1);
+        for(size_t j = 0; j < 3; ++j)
+            ax[j] = double(j + 1);
+        ap[0] = 4.0;
+        ap[1] = 5.0;
+        Independent(ax, ap);
+
+        // the dynamic parameters are only used by the CSumOp
+        ay[0] = CppAD::lazy(ax[0]) + ap[0] - ax[1] + 7.0 - ap[1] + ax[2];
+        CppAD::ADFun<double> f(ax, ay);
+
+        // optimize
+        optimize_with_options(f);
+
+        // zero order forward
+        vector<double> x(3), p(2), y(1);
+        for(size_t j = 0; j < 3; ++j)
+            x[j] = double(j + 2);
+        p[0] = 6.0;
+        p[1] = 9.0;
+        f.new_dynamic(p);
+        y = f.Forward(0, x);
+        double check = x[0] + p[0] - x[1] + 7.0 - p[1] + x[2];
+        ok &= NearEqual(y[0], check, eps10, eps10);
+        return ok;
+    }
 }
 
 bool optimize(void)
@@ -2549,6 +2642,8 @@ bool optimize(void)
         // check case were a variable in left or right expressions
         // is removed during the optimization
         ok     &= cond_exp_skip_remove_var();
+        // check case where each case is a long block of operators
+        ok     &= cond_exp_skip_block();
         // check case where an if case is used after the conditional expression
         ok     &= cond_exp_if_false_used_after();
         // check case that has non-empty binary intersection operation
@@ -2557,6 +2652,8 @@ bool optimize(void)
 
     // not using conditional_skip or atomic functions
     ok &= only_check_variables_when_hash_codes_match();
+    // CSumOp with dynamic parameter arguments
+    ok &= csum_dynamic_argument();
     // -----------------------------------------------------------------------
     //
     CppAD::user_atomic<double>::clear();
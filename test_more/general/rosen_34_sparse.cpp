@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+
+/*
+Validation tests of Rosen34Sparse where h * || f_x || is large.
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+namespace {  // BEGIN Empty namespace
+    typedef CPPAD_TESTVECTOR(size_t)              s_vector;
+    typedef CPPAD_TESTVECTOR(double)              d_vector;
+    typedef CppAD::sparse_rc<s_vector>            sparsity;
+    typedef CppAD::sparse_rcv<s_vector, d_vector> sparse_matrix;
+    //
+    // F(t, x) = A * x where A is a constant sparse matrix
+    class LinearFun {
+    private:
+        const sparse_matrix& A_;
+    public:
+        LinearFun(const sparse_matrix& A) : A_(A)
+        { }
+        void Ode(const double& /* t */, const d_vector& x, d_vector& f)
+        {   for(size_t i = 0; i < x.size(); i++)
+                f[i] = 0.0;
+            for(size_t k = 0; k < A_.nnz(); k++)
+                f[ A_.row()[k] ] += A_.val()[k] * x[ A_.col()[k] ];
+        }
+        void Ode_ind(const double& /* t */, const d_vector& x, d_vector& f_t)
+        {   for(size_t i = 0; i < x.size(); i++)
+                f_t[i] = 0.0;
+        }
+        void Ode_dep(
+            const double& /* t */, const d_vector& /* x */, sparse_matrix& f_x
+        )
+        {   for(size_t k = 0; k < A_.nnz(); k++)
+                f_x.set(k, A_.val()[k]);
+        }
+    };
+    // ------------------------------------------------------------------------
+    // Diffusion with zero boundary conditions:
+    // x_i'(t) = kappa * ( x_{i-1} - 2 x_i + x_{i+1} ) , x_{-1} = x_n = 0.
+    // The initial value is the eigenvector v corresponding to the eigenvalue
+    // lambda with smallest absolute value and X(t) = exp(lambda * t) * v.
+    bool stiff_diffusion(void)
+    {   bool ok = true;
+        double pi = 4.0 * std::atan(1.0);
+        //
+        size_t n     = 1000;    // number of components in X(t)
+        size_t M     = 10;      // number of steps in [ti, tf]
+        double ti    = 0.0;     // initial time
+        double tf    = 1.0;     // final time
+        double h     = (tf - ti) / double(M);
+        //
+        // kappa: chosen so that lambda = -1
+        double theta  = pi / double(n + 1);
+        double kappa  = 1.0 / ( 2.0 - 2.0 * std::cos(theta) );
+        double lambda = -1.0;
+        //
+        // h * || f_x ||_infinity / 2 is greater than 10^4
+        ok &= h * 4.0 * kappa / 2.0 > 1e4;
+        //
+        // A
+        sparsity pattern(n, n, 3 * n - 2);
+        size_t k = 0;
+        for(size_t i = 0; i < n; i++)
+        {   if( i > 0 )
+                pattern.set(k++, i, i - 1);
+            pattern.set(k++, i, i);
+            if( i + 1 < n )
+                pattern.set(k++, i, i + 1);
+        }
+        sparse_matrix A(pattern);
+        for(k = 0; k < pattern.nnz(); k++)
+        {   if( pattern.row()[k] == pattern.col()[k] )
+                A.set(k, - 2.0 * kappa);
+            else
+                A.set(k, kappa);
+        }
+        //
+        // xi = v
+        d_vector xi(n);
+        for(size_t i = 0; i < n; i++)
+            xi[i] = std::sin( double(i + 1) * theta );
+        //
+        // xf
+        LinearFun F(A);
+        d_vector xf(n), e(n);
+        xf = CppAD::Rosen34Sparse(F, M, ti, tf, xi, pattern, e);
+        //
+        // check result
+        double rel = 1e-4;
+        double x_max = 0.0;
+        for(size_t i = 0; i < n; i++)
+            x_max = std::max(x_max, std::fabs( xi[i] ) );
+        for(size_t i = 0; i < n; i++)
+        {   double check = std::exp( lambda * tf ) * xi[i];
+            ok &= std::fabs( xf[i] - check ) <= rel * x_max;
+            ok &= std::fabs( e[i] ) <= rel * x_max;
+        }
+        return ok;
+    }
+    // ------------------------------------------------------------------------
+    // The first pivot for I - A * h / 2 is zero so Rosen34Sparse returns nan
+    // (this does not depend on NDEBUG)
+    bool zero_pivot(void)
+    {   bool ok = true;
+        //
+        size_t n     = 2;       // number of components in X(t)
+        size_t M     = 4;       // number of steps in [ti, tf]
+        double ti    = 0.0;     // initial time
+        double tf    = 1.0;     // final time
+        double h     = (tf - ti) / double(M);
+        //
+        // A
+        sparsity pattern(n, n, 4);
+        pattern.set(0, 0, 0);
+        pattern.set(1, 0, 1);
+        pattern.set(2, 1, 0);
+        pattern.set(3, 1, 1);
+        sparse_matrix A(pattern);
+        A.set(0, 2.0 / h);
+        A.set(1, 1.0);
+        A.set(2, 1.0);
+        A.set(3, -1.0);
+        //
+        // xi
+        d_vector xi(n);
+        xi[0] = 1.0;
+        xi[1] = 1.0;
+        //
+        // xf
+        LinearFun F(A);
+        d_vector xf(n), e(n);
+        xf = CppAD::Rosen34Sparse(F, M, ti, tf, xi, pattern, e);
+        //
+        for(size_t i = 0; i < n; i++)
+        {   ok &= CppAD::isnan( xf[i] );
+            ok &= CppAD::isnan( e[i] );
+        }
+        return ok;
+    }
+} // END Empty namespace
+
+bool Rosen34Sparse(void)
+{   bool ok = true;
+    ok     &= stiff_diffusion();
+    ok     &= zero_pivot();
+    return ok;
+}
+// END C++
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
+// ----------------------------------------------------------------------------
+# include <cppad/cppad.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+    using CppAD::vector;
+    //
+    // y = p * x where p is a parameter; the Jacobian sparsity pattern is
+    // empty when p is zero.
+    class atomic_scale : public CppAD::atomic_three<double> {
+    public:
+        atomic_scale(const std::string& name) :
+        CppAD::atomic_three<double>(name)
+        { }
+    private:
+        bool for_type(
+            const vector<double>&               parameter_x ,
+            const vector<CppAD::ad_type_enum>&  type_x      ,
+            vector<CppAD::ad_type_enum>&        type_y      ) override
+        {   type_y[0] = std::max(type_x[0], type_x[1]);
+            return true;
+        }
+        bool forward(
+            const vector<double>&              parameter_x  ,
+            const vector<CppAD::ad_type_enum>& type_x       ,
+            size_t                             need_y       ,
+            size_t                             order_low    ,
+            size_t                             order_up     ,
+            const vector<double>&              taylor_x     ,
+            vector<double>&                    taylor_y     ) override
+        {   if( order_up != 0 )
+                return false;
+            taylor_y[0] = taylor_x[0] * taylor_x[1];
+            return true;
+        }
+        bool jac_sparsity(
+            const vector<double>&               parameter_x ,
+            const vector<CppAD::ad_type_enum>&  type_x      ,
+            bool                                dependency  ,
+            const vector<bool>&                 select_x    ,
+            const vector<bool>&                 select_y    ,
+            CppAD::sparse_rc< vector<size_t> >& pattern_out ) override
+        {   // the first argument is the parameter p
+            bool nonzero = select_y[0] && select_x[1];
+            if( type_x[0] <= CppAD::dynamic_enum )
+                nonzero &= parameter_x[0] != 0.0;
+            pattern_out.resize(1, 2, size_t(nonzero) );
+            if( nonzero )
+                pattern_out.set(0, 0, 1);
+            return true;
+        }
+    };
+} // END_EMPTY_NAMESPACE
+
+bool sparsity_cache(void)
+{   bool ok = true;
+    using CppAD::AD;
+    typedef CPPAD_TESTVECTOR(size_t)     SizeVector;
+    typedef CppAD::sparse_rc<SizeVector> sparsity;
+    //
+    // f(x) = p * x
+    atomic_scale afun("atomic_scale");
+    vector< AD<double> > ap(1), ax(1), au(2), ay(1);
+    ap[0] = 1.0;
+    ax[0] = 2.0;
+    size_t abort_op_index = 0;
+    bool   record_compare = true;
+    CppAD::Independent(ax, abort_op_index, record_compare, ap);
+    au[0] = ap[0];
+    au[1] = ax[0];
+    afun(au, ay);
+    CppAD::ADFun<double> f(ax, ay);
+    f.sparsity_cache(true);
+    //
+    // pattern_in
+    sparsity pattern_in(1, 1, 1);
+    pattern_in.set(0, 0, 0);
+    //
+    bool transpose     = false;
+    bool dependency    = false;
+    bool internal_bool = false;
+    sparsity pattern_out;
+    //
+    // p = 1
+    f.for_jac_sparsity(
+        pattern_in, transpose, dependency, internal_bool, pattern_out
+    );
+    ok &= pattern_out.nnz() == 1;
+    ok &= f.sparsity_cache_miss() == 1;
+    //
+    // p = 0: new_dynamic removes the patterns from the cache
+    vector<double> p(1);
+    p[0] = 0.0;
+    f.new_dynamic(p);
+    f.for_jac_sparsity(
+        pattern_in, transpose, dependency, internal_bool, pattern_out
+    );
+    ok &= pattern_out.nnz() == 0;
+    ok &= f.sparsity_cache_miss() == 2;
+    ok &= f.sparsity_cache_hit()  == 0;
+    //
+    // the cache is used when new_dynamic is not called
+    f.for_jac_sparsity(
+        pattern_in, transpose, dependency, internal_bool, pattern_out
+    );
+    ok &= pattern_out.nnz() == 0;
+    ok &= f.sparsity_cache_hit()  == 1;
+    //
+    return ok;
+}
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
 // SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
-// SPDX-FileContributor: 2003-24 Bradley M. Bell
+// SPDX-FileContributor: 2003-26 Bradley M. Bell
 // ----------------------------------------------------------------------------
 
 /*
@@ -611,6 +611,48 @@ bool hes_sparsity_test_function(CppAD::ADFun<double>& fun)
     return ok;
 }
 
+// The VecAD state is kept between zero order forward sweeps.
+// Check that the values stored during one sweep do not affect the next.
+bool repeat_forward_zero(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    // f(x) = v[0] + v[1] + v[2] where v is initially (1, 2, 3) and
+    // then v[ x[0] ] = x[1] and v[ x[2] ] = x[1] * x[1]
+    size_t n = 3;
+    CPPAD_TESTVECTOR( AD<double> ) ax(n), ay(1);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = 0.0;
+    CppAD::Independent(ax);
+    CppAD::VecAD<double> av(3);
+    for(size_t i = 0; i < 3; ++i)
+    {   AD<double> ai = double(i);
+        av[ai] = double(i + 1);
+    }
+    av[ ax[0] ] = ax[1];
+    av[ ax[2] ] = ax[1] * ax[1];
+    AD<double> a0 = 0.0, a1 = 1.0, a2 = 2.0;
+    ay[0] = av[a0] + av[a1] + av[a2];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // evaluate f for different indices in each sweep
+    CPPAD_TESTVECTOR(double) x(n), y(1);
+    for(size_t k = 0; k < 6; ++k)
+    {   size_t i0 = k % 3;
+        size_t i2 = (k / 2) % 3;
+        x[0] = double(i0);
+        x[1] = double(k + 4);
+        x[2] = double(i2);
+        y    = f.Forward(0, x);
+        //
+        double v[3] = {1.0, 2.0, 3.0};
+        v[i0] = x[1];
+        v[i2] = x[1] * x[1];
+        ok &= y[0] == v[0] + v[1] + v[2];
+    }
+    return ok;
+}
+
 } // END empty namespace
 
 bool VecAD(void)
@@ -619,6 +661,7 @@ bool VecAD(void)
     ok &= VecADTestOne();
     ok &= VecADTestTwo();
     ok &= SecondOrderReverse();
+    ok &= repeat_forward_zero();
     //
     // fun, x
     CppAD::ADFun<double>     fun = get_test_function();